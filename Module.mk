@@ -20,9 +20,19 @@ ARIES_CFLAGS := -Wstrict-prototypes -Wpointer-arith -Wcast-qual \
 		-Wmissing-prototypes -I./aries-sdk-c/include \
 		-I./aries-sdk-c/examples/include -I./include
 
+# Uncomment to issue Astera format I2C accesses as multi-message transfers
+# (requires asteraI2CTransfer() in the I2C backend, e.g. aspeed.c or sim.c)
+#ARIES_CFLAGS += -DARIES_I2C_BATCH
+
+# Uncomment to poll EEPROM page program completion instead of waiting a fixed
+# ARIES_DATA_BLOCK_PROGRAM_TIME_USEC (not yet validated on hardware)
+#ARIES_CFLAGS += -DARIES_EEPROM_PROGRAM_POLL
+
 
 # By default, create executables for these directories
-ARIES_TARGETS	:= aries_test eeprom_update eeprom_test link_example link_test margin_test prbs
+ARIES_TARGETS	:= aries_test eeprom_update eeprom_test link_example link_test margin_test prbs \
+		   sim_bench pec_bench async_example shm_reader aries_monitord \
+		   ltssm_decode ltssm_decode_test snapshot_convert fleet_update
 
 # Libraries to include
 #    -lpigpio pigpio.h library for RPI
@@ -31,7 +41,16 @@ RPI_LDFLAGS := -lpigpio -lrt
 
 # Libraries to include
 #    -lm math.h library
-ARIES_LDFLAGS := -lm
+#    -lpthread pthread.h library for the I2C driver lock
+ARIES_LDFLAGS := -lm -lpthread
+
+# Libraries to include
+#    -lpthread pthread.h library for the simulated Retimer
+SIM_LDFLAGS := -lpthread
+
+# Libraries to include
+#    -lrt shm_open() for shared memory state publication
+SHM_LDFLAGS := -lrt
 
 ################################
 ########### Programs ###########
@@ -71,8 +90,10 @@ $(ARIES_EXAMPLES)/link_example: $(ARIES_EXAMPLES)/link_example.o \
 	$(ARIES_SRC)/aries_i2c.o \
 	$(ARIES_SRC)/aries_link.o \
 	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/aries_telemetry.o \
+	$(ARIES_SRC)/aries_shm.o \
 	$(ARIES_SRC)/astera_log.o
-	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) -o $@ $^
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) $(SHM_LDFLAGS) -o $@ $^
 
 $(ARIES_EXAMPLES)/link_test: $(ARIES_EXAMPLES)/link_test.o \
 	$(ARIES_EXAMPLES_SRC)/aspeed.o \
@@ -102,6 +123,83 @@ $(ARIES_EXAMPLES)/prbs: $(ARIES_EXAMPLES)/prbs.o \
 	$(ARIES_SRC)/astera_log.o
 	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) -o $@ $^
 
+$(ARIES_EXAMPLES)/sim_bench: $(ARIES_EXAMPLES)/sim_bench.o \
+	$(ARIES_EXAMPLES_SRC)/sim.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) $(SIM_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/pec_bench: $(ARIES_EXAMPLES)/pec_bench.o \
+	$(ARIES_EXAMPLES_SRC)/sim.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) $(SIM_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/async_example: $(ARIES_EXAMPLES)/async_example.o \
+	$(ARIES_EXAMPLES_SRC)/sim.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_async.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) $(SIM_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/fleet_update: $(ARIES_EXAMPLES)/fleet_update.o \
+	$(ARIES_EXAMPLES_SRC)/sim.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_async.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) $(SIM_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/shm_reader: $(ARIES_EXAMPLES)/shm_reader.o \
+	$(ARIES_SRC)/aries_shm.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(SHM_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/ltssm_decode: $(ARIES_EXAMPLES)/ltssm_decode.o \
+	$(ARIES_EXAMPLES_SRC)/aspeed.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_ltssm.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/ltssm_decode_test: $(ARIES_EXAMPLES)/ltssm_decode_test.o \
+	$(ARIES_EXAMPLES_SRC)/sim.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_ltssm.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) $(SIM_LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/snapshot_convert: $(ARIES_EXAMPLES)/snapshot_convert.o \
+	$(ARIES_SRC)/aries_snapshot.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) -o $@ $^
+
+$(ARIES_EXAMPLES)/aries_monitord: $(ARIES_EXAMPLES)/aries_monitord.o \
+	$(ARIES_EXAMPLES_SRC)/aspeed.o \
+	$(ARIES_SRC)/aries_api.o \
+	$(ARIES_SRC)/aries_i2c.o \
+	$(ARIES_SRC)/aries_link.o \
+	$(ARIES_SRC)/aries_misc.o \
+	$(ARIES_SRC)/astera_log.o
+	$(CC) $(LDFLAGS) $(ARIES_LDFLAGS) -o $@ $^
+
 ###############################
 ########### Objects ###########
 ###############################
@@ -127,9 +225,36 @@ $(ARIES_EXAMPLES)/margin_test.o: $(ARIES_EXAMPLES)/margin_test.c
 $(ARIES_EXAMPLES)/prbs.o: $(ARIES_EXAMPLES)/prbs.c
 	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
 
+$(ARIES_EXAMPLES)/sim_bench.o: $(ARIES_EXAMPLES)/sim_bench.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/pec_bench.o: $(ARIES_EXAMPLES)/pec_bench.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/async_example.o: $(ARIES_EXAMPLES)/async_example.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/fleet_update.o: $(ARIES_EXAMPLES)/fleet_update.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/shm_reader.o: $(ARIES_EXAMPLES)/shm_reader.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/aries_monitord.o: $(ARIES_EXAMPLES)/aries_monitord.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/ltssm_decode.o: $(ARIES_EXAMPLES)/ltssm_decode.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_EXAMPLES)/snapshot_convert.o: $(ARIES_EXAMPLES)/snapshot_convert.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
 $(ARIES_SRC)/aries_api.o: $(ARIES_SRC)/aries_api.c
 	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
 
+$(ARIES_SRC)/aries_async.o: $(ARIES_SRC)/aries_async.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
 $(ARIES_SRC)/aries_i2c.o: $(ARIES_SRC)/aries_i2c.c
 	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
 
@@ -142,6 +267,18 @@ $(ARIES_SRC)/aries_misc.o: $(ARIES_SRC)/aries_misc.c
 $(ARIES_SRC)/aries_margin.o: $(ARIES_SRC)/aries_margin.c
 	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
 
+$(ARIES_SRC)/aries_ltssm.o: $(ARIES_SRC)/aries_ltssm.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_SRC)/aries_telemetry.o: $(ARIES_SRC)/aries_telemetry.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_SRC)/aries_shm.o: $(ARIES_SRC)/aries_shm.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
+$(ARIES_SRC)/aries_snapshot.o: $(ARIES_SRC)/aries_snapshot.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
 $(ARIES_SRC)/astera_log.o: $(ARIES_SRC)/astera_log.c
 	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
 
@@ -151,6 +288,9 @@ $(ARIES_EXAMPLES_SRC)/aspeed.o: $(ARIES_EXAMPLES_SRC)/aspeed.c
 $(ARIES_EXAMPLES_SRC)/eeprom.o: $(ARIES_EXAMPLES_SRC)/eeprom.c
 	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
 
+$(ARIES_EXAMPLES_SRC)/sim.o: $(ARIES_EXAMPLES_SRC)/sim.c
+	$(CC) $(CFLAGS) $(ARIES_CFLAGS) -c $< -o $@
+
 ################################
 ########### Commands ###########
 ################################
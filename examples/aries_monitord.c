@@ -0,0 +1,791 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_monitord.c
+ * @brief Monitoring daemon which owns all configured Retimers. It polls link
+ * health (with the multi-rate health scheduler) and LTSSM logs in the
+ * background, and serves queries over a local Unix socket with the binary
+ * protocol in include/monitord.h.
+ *
+ * Every query kind of every Retimer/link has a cache entry. A query is served
+ * from the cache if the data is younger than the query's staleness bound;
+ * otherwise the data is read from the Retimer. Identical queries arriving
+ * while such a read is in flight wait for it and share its result, rather
+ * than each walking the bus.
+ *
+ * Usage: aries-monitord [-s socketPath] [-a maxAgeMs] [-l logPeriodMs]
+ *                       bus:addr[:numLinks] ...
+ */
+
+#include "../include/aries_api.h"
+#include "../include/aries_link.h"
+#include "include/aspeed.h"
+#include "include/monitord.h"
+
+#include <getopt.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define MONITORD_MAX_DEVICES 16
+#define MONITORD_MAX_LINKS 8
+#define MONITORD_NUM_LINK_CMDS 3
+#define MONITORD_MAX_PAYLOAD (MONITORD_MAX_LOG_ENTRIES * \
+    sizeof(MonitordLogEntryType))
+
+/*
+ * Cached result of one query kind
+ */
+typedef struct MonitordCacheEntry
+{
+    bool valid;             /**< Holds a result */
+    bool inFlight;          /**< A read from the Retimer is in progress */
+    uint64_t timestampUs;   /**< Time of the result */
+    int32_t rc;             /**< Return code of the read */
+    uint32_t payloadLen;    /**< Num payload bytes */
+    uint8_t payload[MONITORD_MAX_PAYLOAD];
+} MonitordCacheEntryType;
+
+/*
+ * A Retimer owned by the daemon
+ */
+typedef struct MonitordDevice
+{
+    int handle;
+    AriesI2CDriverType i2cDriver;
+    AriesDeviceType device;
+    int numLinks;
+    AriesLinkType links[MONITORD_MAX_LINKS];
+    AriesHealthSchedType sched[MONITORD_MAX_LINKS];
+    uint64_t lastLogPollUs;
+    pthread_t poller;
+    // Serializes all SDK calls on this Retimer (poller and queries)
+    pthread_mutex_t sdkMutex;
+    MonitordCacheEntryType deviceCache;
+    MonitordCacheEntryType linkCache[MONITORD_MAX_LINKS]
+        [MONITORD_NUM_LINK_CMDS];
+} MonitordDeviceType;
+
+static MonitordDeviceType* monitordDevices[MONITORD_MAX_DEVICES];
+static int monitordNumDevices = 0;
+static uint32_t monitordMaxAgeMs = 2000;
+static uint32_t monitordLogPeriodMs = 10000;
+
+// Protects all cache entries and the stats
+static pthread_mutex_t monitordCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t monitordCacheCond = PTHREAD_COND_INITIALIZER;
+
+// Wakes the pollers on shutdown
+static pthread_mutex_t monitordStopMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t monitordStopCond = PTHREAD_COND_INITIALIZER;
+static volatile sig_atomic_t monitordStop = 0;
+
+static uint64_t monitordNumQueries = 0;
+static uint64_t monitordNumCached = 0;
+static uint64_t monitordNumCoalesced = 0;
+static uint64_t monitordNumReads = 0;
+
+static uint64_t monitordTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+/*
+ * Age of a cache entry, in us
+ */
+static uint64_t monitordAgeUs(
+        MonitordCacheEntryType* entry,
+        uint64_t nowUs)
+{
+    if (entry->timestampUs >= nowUs)
+    {
+        return 0;
+    }
+    return nowUs - entry->timestampUs;
+}
+
+static void monitordSignal(
+        int sig)
+{
+    (void) sig;
+    monitordStop = 1;
+}
+
+/*
+ * Fill device payload from the last read device state
+ */
+static uint32_t monitordFillDevice(
+        MonitordDeviceType* dev,
+        uint8_t* payload)
+{
+    MonitordDevicePayloadType* out = (MonitordDevicePayloadType*) payload;
+
+    out->currentTempC = dev->device.currentTempC;
+    out->maxTempC = dev->device.maxTempC;
+    out->deviceOkay = dev->device.deviceOkay;
+    out->overtempAlert = dev->device.overtempAlert;
+    out->fwMajor = dev->device.fwVersion.major;
+    out->fwMinor = dev->device.fwVersion.minor;
+    out->fwBuild = dev->device.fwVersion.build;
+    return sizeof(MonitordDevicePayloadType);
+}
+
+/*
+ * Fill link state payload from the last read link state
+ */
+static uint32_t monitordFillLinkState(
+        AriesLinkType* link,
+        uint8_t* payload)
+{
+    MonitordLinkStatePayloadType* out =
+        (MonitordLinkStatePayloadType*) payload;
+
+    memset(out, 0, sizeof(MonitordLinkStatePayloadType));
+    out->state = link->state.state;
+    out->rate = link->state.rate;
+    out->width = link->state.width;
+    out->curWidth = link->state.curWidth;
+    out->linkOkay = link->state.linkOkay;
+    out->linkMinFoM = link->state.linkMinFoM;
+    out->recoveryCount = link->state.recoveryCount;
+    out->usppMinDPLLCode = link->state.usppState.minDPLLCode;
+    out->usppMaxDPLLCode = link->state.usppState.maxDPLLCode;
+    out->dsppMinDPLLCode = link->state.dsppState.minDPLLCode;
+    out->dsppMaxDPLLCode = link->state.dsppState.maxDPLLCode;
+    if (link->state.linkMinFoMRx != NULL)
+    {
+        strncpy(out->linkMinFoMRx, link->state.linkMinFoMRx,
+            sizeof(out->linkMinFoMRx) - 1);
+    }
+    return sizeof(MonitordLinkStatePayloadType);
+}
+
+/*
+ * Read Main Micro LTSSM log of a link
+ */
+static AriesErrorType monitordReadLog(
+        AriesLinkType* link,
+        uint8_t* payload,
+        uint32_t* payloadLen)
+{
+    MonitordLogEntryType* out = (MonitordLogEntryType*) payload;
+    AriesLTSSMEntryType entries[MONITORD_MAX_LOG_ENTRIES];
+    AriesErrorType rc;
+    int numEntries;
+    int index;
+    bool complete;
+    bool atBoundary;
+
+    *payloadLen = 0;
+    rc = ariesReadLog(link, ARIES_LTSSM_LINK_LOGGER, entries, &numEntries,
+        &complete, &atBoundary);
+    CHECK_SUCCESS(rc);
+
+    for (index = 0; index < numEntries; index++)
+    {
+        out[index].offset = entries[index].offset;
+        out[index].data = entries[index].data;
+    }
+
+    *payloadLen = numEntries * sizeof(MonitordLogEntryType);
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Read the data of a query from the Retimer. Called with sdkMutex held.
+ */
+static AriesErrorType monitordRead(
+        MonitordDeviceType* dev,
+        int linkIndex,
+        int cmd,
+        uint8_t* payload,
+        uint32_t* payloadLen)
+{
+    AriesLinkType* link = &dev->links[linkIndex];
+    MonitordEyePayloadType* eye;
+    AriesErrorType rc;
+    int laneIndex;
+
+    *payloadLen = 0;
+
+    switch (cmd)
+    {
+        case MONITORD_CMD_DEVICE:
+            rc = ariesCheckDeviceHealth(&dev->device);
+            CHECK_SUCCESS(rc);
+            rc = ariesGetCurrentTemp(&dev->device);
+            CHECK_SUCCESS(rc);
+            rc = ariesGetMaxTemp(&dev->device);
+            CHECK_SUCCESS(rc);
+            *payloadLen = monitordFillDevice(dev, payload);
+            break;
+        case MONITORD_CMD_LINK_STATE:
+            rc = ariesCheckLinkHealth(link);
+            CHECK_SUCCESS(rc);
+            *payloadLen = monitordFillLinkState(link, payload);
+            break;
+        case MONITORD_CMD_EYE:
+            rc = ariesGetLinkStateDetailed(link);
+            CHECK_SUCCESS(rc);
+            eye = (MonitordEyePayloadType*) payload;
+            memset(eye, 0, sizeof(MonitordEyePayloadType));
+            eye->width = link->state.width;
+            for (laneIndex = 0; laneIndex < link->state.width; laneIndex++)
+            {
+                eye->usppFoM[laneIndex] =
+                    link->state.usppState.rxState[laneIndex].FoM;
+                eye->dsppFoM[laneIndex] =
+                    link->state.dsppState.rxState[laneIndex].FoM;
+            }
+            *payloadLen = sizeof(MonitordEyePayloadType);
+            break;
+        case MONITORD_CMD_LTSSM_LOG:
+            rc = monitordReadLog(link, payload, payloadLen);
+            CHECK_SUCCESS(rc);
+            break;
+        default:
+            return ARIES_INVALID_ARGUMENT;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Store a result in a cache entry. Called with monitordCacheMutex held.
+ */
+static void monitordStore(
+        MonitordCacheEntryType* entry,
+        int32_t rc,
+        uint8_t* payload,
+        uint32_t payloadLen,
+        uint64_t timestampUs)
+{
+    entry->rc = rc;
+    entry->payloadLen = payloadLen;
+    memcpy(entry->payload, payload, payloadLen);
+    entry->timestampUs = timestampUs;
+    entry->valid = true;
+    pthread_cond_broadcast(&monitordCacheCond);
+}
+
+/*
+ * Serve a query: from the cache if fresh enough, else from the Retimer,
+ * sharing a read already in flight for the same query
+ */
+static void monitordQuery(
+        MonitordDeviceType* dev,
+        int linkIndex,
+        int cmd,
+        uint32_t maxAgeMs,
+        MonitordResponseHeaderType* header,
+        uint8_t* payload)
+{
+    MonitordCacheEntryType* entry;
+    uint8_t readPayload[MONITORD_MAX_PAYLOAD];
+    uint32_t readLen;
+    uint64_t queryUs;
+    uint64_t nowUs;
+    int32_t rc;
+
+    if (cmd == MONITORD_CMD_DEVICE)
+    {
+        entry = &dev->deviceCache;
+    }
+    else
+    {
+        entry = &dev->linkCache[linkIndex][cmd - MONITORD_CMD_LINK_STATE];
+    }
+
+    queryUs = monitordTimeUs();
+
+    pthread_mutex_lock(&monitordCacheMutex);
+    monitordNumQueries++;
+    while (true)
+    {
+        nowUs = monitordTimeUs();
+        // Served from the cache if within the staleness bound, or if it was
+        // read after this query arrived (i.e. by a read this query waited on)
+        if (entry->valid && ((monitordAgeUs(entry, nowUs) <=
+            ((uint64_t) maxAgeMs * 1000)) || (entry->timestampUs >= queryUs)))
+        {
+            break;
+        }
+        if (entry->inFlight)
+        {
+            monitordNumCoalesced++;
+            while (entry->inFlight)
+            {
+                pthread_cond_wait(&monitordCacheCond, &monitordCacheMutex);
+            }
+            continue;
+        }
+
+        entry->inFlight = true;
+        monitordNumReads++;
+        pthread_mutex_unlock(&monitordCacheMutex);
+
+        pthread_mutex_lock(&dev->sdkMutex);
+        rc = monitordRead(dev, linkIndex, cmd, readPayload, &readLen);
+        pthread_mutex_unlock(&dev->sdkMutex);
+
+        pthread_mutex_lock(&monitordCacheMutex);
+        entry->inFlight = false;
+        monitordStore(entry, rc, readPayload, readLen, monitordTimeUs());
+    }
+    if (entry->timestampUs < queryUs)
+    {
+        monitordNumCached++;
+    }
+
+    header->rc = entry->rc;
+    header->payloadLen = entry->payloadLen;
+    header->ageMs = monitordAgeUs(entry, nowUs) / 1000;
+    memcpy(payload, entry->payload, entry->payloadLen);
+    pthread_mutex_unlock(&monitordCacheMutex);
+}
+
+/*
+ * Background poller of one Retimer: health metrics as they fall due, and
+ * LTSSM logs every monitordLogPeriodMs
+ */
+static void* monitordPoller(
+        void* arg)
+{
+    MonitordDeviceType* dev = (MonitordDeviceType*) arg;
+    uint8_t payload[MONITORD_MAX_PAYLOAD];
+    uint32_t payloadLen;
+    uint32_t mask;
+    uint32_t waitMs;
+    uint32_t dueMs;
+    uint64_t nowUs;
+    struct timespec deadline;
+    bool tempUpdated;
+    bool pollLog;
+    int linkIndex;
+    int32_t rc;
+
+    while (!monitordStop)
+    {
+        nowUs = monitordTimeUs();
+        pollLog = ((nowUs - dev->lastLogPollUs) >=
+            ((uint64_t) monitordLogPeriodMs * 1000));
+        tempUpdated = false;
+
+        for (linkIndex = 0; linkIndex < dev->numLinks; linkIndex++)
+        {
+            pthread_mutex_lock(&dev->sdkMutex);
+            rc = ariesHealthSchedPoll(&dev->sched[linkIndex], &mask);
+            payloadLen = monitordFillLinkState(&dev->links[linkIndex],
+                payload);
+            pthread_mutex_unlock(&dev->sdkMutex);
+
+            if ((rc == ARIES_SUCCESS) &&
+                (mask & (1 << ARIES_HEALTH_METRIC_LINK_STATE)))
+            {
+                pthread_mutex_lock(&monitordCacheMutex);
+                monitordStore(&dev->linkCache[linkIndex]
+                    [MONITORD_CMD_LINK_STATE - MONITORD_CMD_LINK_STATE],
+                    rc, payload, payloadLen, monitordTimeUs());
+                pthread_mutex_unlock(&monitordCacheMutex);
+            }
+            if ((rc == ARIES_SUCCESS) &&
+                (mask & (1 << ARIES_HEALTH_METRIC_TEMP)))
+            {
+                tempUpdated = true;
+            }
+
+            if (pollLog)
+            {
+                pthread_mutex_lock(&dev->sdkMutex);
+                rc = monitordReadLog(&dev->links[linkIndex], payload,
+                    &payloadLen);
+                pthread_mutex_unlock(&dev->sdkMutex);
+
+                pthread_mutex_lock(&monitordCacheMutex);
+                monitordStore(&dev->linkCache[linkIndex]
+                    [MONITORD_CMD_LTSSM_LOG - MONITORD_CMD_LINK_STATE],
+                    rc, payload, payloadLen, monitordTimeUs());
+                pthread_mutex_unlock(&monitordCacheMutex);
+            }
+        }
+        if (pollLog)
+        {
+            dev->lastLogPollUs = nowUs;
+        }
+
+        // Device temperatures were just read with the link health metrics
+        if (tempUpdated)
+        {
+            pthread_mutex_lock(&dev->sdkMutex);
+            rc = ariesCheckDeviceHealth(&dev->device);
+            payloadLen = monitordFillDevice(dev, payload);
+            pthread_mutex_unlock(&dev->sdkMutex);
+
+            pthread_mutex_lock(&monitordCacheMutex);
+            monitordStore(&dev->deviceCache, rc, payload, payloadLen,
+                monitordTimeUs());
+            pthread_mutex_unlock(&monitordCacheMutex);
+        }
+
+        // Sleep until the next metric or log poll is due
+        waitMs = monitordLogPeriodMs;
+        for (linkIndex = 0; linkIndex < dev->numLinks; linkIndex++)
+        {
+            dueMs = ariesHealthSchedNextDueMs(&dev->sched[linkIndex]);
+            if (dueMs < waitMs)
+            {
+                waitMs = dueMs;
+            }
+        }
+
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += waitMs / 1000;
+        deadline.tv_nsec += (waitMs % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+        pthread_mutex_lock(&monitordStopMutex);
+        if (!monitordStop)
+        {
+            pthread_cond_timedwait(&monitordStopCond, &monitordStopMutex,
+                &deadline);
+        }
+        pthread_mutex_unlock(&monitordStopMutex);
+    }
+
+    return NULL;
+}
+
+static int monitordReadAll(
+        int fd,
+        void* buf,
+        size_t len)
+{
+    size_t done = 0;
+    ssize_t n;
+
+    while (done < len)
+    {
+        n = read(fd, (uint8_t*) buf + done, len - done);
+        if (n <= 0)
+        {
+            if ((n < 0) && (errno == EINTR) && !monitordStop)
+            {
+                continue;
+            }
+            return -1;
+        }
+        done += n;
+    }
+    return 0;
+}
+
+static int monitordWriteAll(
+        int fd,
+        void* buf,
+        size_t len)
+{
+    size_t done = 0;
+    ssize_t n;
+
+    while (done < len)
+    {
+        n = write(fd, (uint8_t*) buf + done, len - done);
+        if (n <= 0)
+        {
+            if ((n < 0) && (errno == EINTR))
+            {
+                continue;
+            }
+            return -1;
+        }
+        done += n;
+    }
+    return 0;
+}
+
+/*
+ * Serve queries of one client until it disconnects
+ */
+static void* monitordClient(
+        void* arg)
+{
+    int fd = (int) (intptr_t) arg;
+    MonitordRequestType request;
+    MonitordResponseHeaderType header;
+    uint8_t payload[MONITORD_MAX_PAYLOAD];
+    MonitordDeviceType* dev;
+    uint32_t maxAgeMs;
+
+    while (monitordReadAll(fd, &request, sizeof(request)) == 0)
+    {
+        memset(&header, 0, sizeof(header));
+        header.magic = MONITORD_MAGIC;
+        header.version = MONITORD_VERSION;
+        header.cmd = request.cmd;
+
+        if ((request.magic != MONITORD_MAGIC) ||
+            (request.version != MONITORD_VERSION))
+        {
+            header.rc = ARIES_INVALID_ARGUMENT;
+            monitordWriteAll(fd, &header, sizeof(header));
+            break;
+        }
+
+        if ((request.device >= monitordNumDevices) ||
+            (request.cmd < MONITORD_CMD_DEVICE) ||
+            (request.cmd > MONITORD_CMD_LTSSM_LOG) ||
+            ((request.cmd != MONITORD_CMD_DEVICE) &&
+            (request.link >= monitordDevices[request.device]->numLinks)))
+        {
+            header.rc = ARIES_INVALID_ARGUMENT;
+        }
+        else
+        {
+            dev = monitordDevices[request.device];
+            if (request.cmd == MONITORD_CMD_DEVICE)
+            {
+                request.link = 0;
+            }
+            maxAgeMs = request.maxAgeMs;
+            if (maxAgeMs == MONITORD_MAX_AGE_DEFAULT)
+            {
+                maxAgeMs = monitordMaxAgeMs;
+            }
+            monitordQuery(dev, request.link, request.cmd, maxAgeMs, &header,
+                payload);
+        }
+
+        if ((monitordWriteAll(fd, &header, sizeof(header)) != 0) ||
+            (monitordWriteAll(fd, payload, header.payloadLen) != 0))
+        {
+            break;
+        }
+    }
+
+    close(fd);
+    return NULL;
+}
+
+/*
+ * Open and initialize a Retimer given as bus:addr[:numLinks]
+ */
+static AriesErrorType monitordAddDevice(
+        const char* spec)
+{
+    MonitordDeviceType* dev;
+    AriesErrorType rc;
+    int i2cBus;
+    int slaveAddr;
+    int numLinks = 1;
+    int linkIndex;
+    int width;
+
+    if ((sscanf(spec, "%d:%i:%d", &i2cBus, &slaveAddr, &numLinks) < 2) ||
+        (numLinks < 1) || (numLinks > MONITORD_MAX_LINKS) ||
+        ((16 % numLinks) != 0))
+    {
+        ASTERA_ERROR("Invalid Retimer %s, expected bus:addr[:numLinks]", spec);
+        return ARIES_INVALID_ARGUMENT;
+    }
+    if (monitordNumDevices >= MONITORD_MAX_DEVICES)
+    {
+        ASTERA_ERROR("Up to %d Retimers supported", MONITORD_MAX_DEVICES);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    dev = (MonitordDeviceType*) calloc(1, sizeof(MonitordDeviceType));
+    if (dev == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+
+    dev->handle = asteraI2COpenConnection(i2cBus, slaveAddr);
+    if (dev->handle < 0)
+    {
+        ASTERA_ERROR("Could not open Retimer %s", spec);
+        free(dev);
+        return ARIES_I2C_OPEN_FAILURE;
+    }
+
+    dev->i2cDriver.handle = dev->handle;
+    dev->i2cDriver.slaveAddr = slaveAddr;
+    dev->i2cDriver.pecEnable = ARIES_I2C_PEC_DISABLE;
+    dev->i2cDriver.i2cFormat = ARIES_I2C_FORMAT_ASTERA;
+    dev->i2cDriver.lockInit = 0;
+
+    dev->device.i2cDriver = &dev->i2cDriver;
+    dev->device.i2cBus = i2cBus;
+    dev->device.partNumber = ARIES_PTX16;
+    dev->device.tempAlertThreshC = 110.0;
+    dev->device.tempWarnThreshC = 100.0;
+    dev->device.minLinkFoMAlert = 0x55;
+    dev->device.minDPLLFreqAlert = 2*1024;
+    dev->device.maxDPLLFreqAlert = 14*1024;
+
+    rc = ariesInitDevice(&dev->device, slaveAddr);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Init device %s failed: %d", spec, rc);
+        closeI2CConnection(dev->handle);
+        free(dev);
+        return rc;
+    }
+
+    width = 16 / numLinks;
+    dev->numLinks = numLinks;
+    for (linkIndex = 0; linkIndex < numLinks; linkIndex++)
+    {
+        dev->links[linkIndex].device = &dev->device;
+        dev->links[linkIndex].config.linkId = linkIndex;
+        dev->links[linkIndex].config.partNumber = dev->device.partNumber;
+        dev->links[linkIndex].config.maxWidth = width;
+        dev->links[linkIndex].config.startLane = linkIndex * width;
+        ariesHealthSchedInit(&dev->sched[linkIndex], &dev->links[linkIndex]);
+    }
+
+    pthread_mutex_init(&dev->sdkMutex, NULL);
+    monitordDevices[monitordNumDevices++] = dev;
+
+    ASTERA_INFO("Retimer %d: bus %d addr 0x%x, FW %d.%d.%d, %d link(s)",
+        monitordNumDevices - 1, i2cBus, slaveAddr,
+        dev->device.fwVersion.major, dev->device.fwVersion.minor,
+        dev->device.fwVersion.build, numLinks);
+
+    return ARIES_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* socketPath = MONITORD_DEFAULT_SOCKET;
+    struct sockaddr_un addr;
+    struct sigaction sa;
+    pthread_t thread;
+    AriesErrorType rc;
+    int listenFd;
+    int clientFd;
+    int opt;
+    int index;
+
+    while ((opt = getopt(argc, argv, "s:a:l:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                socketPath = optarg;
+                break;
+            case 'a':
+                monitordMaxAgeMs = strtoul(optarg, NULL, 0);
+                break;
+            case 'l':
+                monitordLogPeriodMs = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-s socketPath] [-a maxAgeMs] "
+                    "[-l logPeriodMs] bus:addr[:numLinks] ...\n", argv[0]);
+                return ARIES_INVALID_ARGUMENT;
+        }
+    }
+    if ((optind >= argc) || (monitordLogPeriodMs == 0) ||
+        (strlen(socketPath) >= sizeof(addr.sun_path)))
+    {
+        fprintf(stderr, "Usage: %s [-s socketPath] [-a maxAgeMs] "
+            "[-l logPeriodMs] bus:addr[:numLinks] ...\n", argv[0]);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    asteraLogSetLevel(1);
+
+    for (index = optind; index < argc; index++)
+    {
+        rc = monitordAddDevice(argv[index]);
+        CHECK_SUCCESS(rc);
+    }
+
+    // No SA_RESTART, so that accept() returns on shutdown
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = monitordSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        ASTERA_ERROR("Could not create socket");
+        return ARIES_FAILURE;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socketPath);
+    unlink(socketPath);
+    if ((bind(listenFd, (struct sockaddr*) &addr, sizeof(addr)) != 0) ||
+        (listen(listenFd, 16) != 0))
+    {
+        ASTERA_ERROR("Could not listen on %s", socketPath);
+        close(listenFd);
+        return ARIES_FAILURE;
+    }
+
+    for (index = 0; index < monitordNumDevices; index++)
+    {
+        pthread_create(&monitordDevices[index]->poller, NULL, monitordPoller,
+            monitordDevices[index]);
+    }
+
+    ASTERA_INFO("Serving %d Retimer(s) on %s, max age %u ms, log period %u ms",
+        monitordNumDevices, socketPath, monitordMaxAgeMs, monitordLogPeriodMs);
+
+    while (!monitordStop)
+    {
+        clientFd = accept(listenFd, NULL, NULL);
+        if (clientFd < 0)
+        {
+            continue;
+        }
+        if (pthread_create(&thread, NULL, monitordClient,
+            (void*) (intptr_t) clientFd) != 0)
+        {
+            close(clientFd);
+            continue;
+        }
+        pthread_detach(thread);
+    }
+
+    close(listenFd);
+    unlink(socketPath);
+
+    pthread_mutex_lock(&monitordStopMutex);
+    pthread_cond_broadcast(&monitordStopCond);
+    pthread_mutex_unlock(&monitordStopMutex);
+    for (index = 0; index < monitordNumDevices; index++)
+    {
+        pthread_join(monitordDevices[index]->poller, NULL);
+    }
+
+    ASTERA_INFO("Queries: %llu, from cache: %llu, coalesced: %llu, Retimer reads: %llu",
+        (unsigned long long) monitordNumQueries,
+        (unsigned long long) monitordNumCached,
+        (unsigned long long) monitordNumCoalesced,
+        (unsigned long long) monitordNumReads);
+
+    return ARIES_SUCCESS;
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file async_example.c
+ * @brief Example application which checks the health of several simulated
+ * Retimers (examples/source/sim.c) spread over multiple I2C buses, first
+ * serially, then through the async bus workers (aries_async.h), and then as
+ * one fleet health sweep (ariesFleetCheckHealth), and reports the wall time
+ * of each. No hardware is required.
+ *
+ * Usage: async_example [latencyUs] [numBuses] [devicesPerBus]
+ */
+
+#include "../include/aries_api.h"
+#include "../include/aries_async.h"
+#include "include/sim.h"
+
+#include <time.h>
+
+#define ASYNC_EXAMPLE_MAX_DEVICES 16
+#define ASYNC_EXAMPLE_OPS_PER_DEVICE 3
+
+static double asyncExampleTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
+
+/*
+ * Completion callback, run on the bus worker thread
+ */
+static void asyncExampleDone(
+        AriesAsyncRequestType* request,
+        void* userData)
+{
+    int* numFailed = (int*) userData;
+
+    if (request->rc != ARIES_SUCCESS)
+    {
+        __sync_fetch_and_add(numFailed, 1);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    AriesDeviceType devices[ASYNC_EXAMPLE_MAX_DEVICES];
+    AriesI2CDriverType i2cDrivers[ASYNC_EXAMPLE_MAX_DEVICES];
+    AriesLinkType links[ASYNC_EXAMPLE_MAX_DEVICES];
+    AriesLinkType* fleetLinks[ASYNC_EXAMPLE_MAX_DEVICES];
+    AriesFleetHealthResultType results[ASYNC_EXAMPLE_MAX_DEVICES];
+    AriesAsyncRequestType requests[ASYNC_EXAMPLE_MAX_DEVICES]
+        [ASYNC_EXAMPLE_OPS_PER_DEVICE];
+    AriesErrorType rc;
+    int handles[ASYNC_EXAMPLE_MAX_DEVICES];
+    int latencyUs = 100;
+    int numBuses = 2;
+    int devicesPerBus = 2;
+    int numDevices;
+    int numFailed = 0;
+    int dev;
+    int op;
+    double startUs;
+    double serialUs;
+    double asyncUs;
+    double fleetUs;
+
+    if (argc > 1)
+    {
+        latencyUs = atoi(argv[1]);
+    }
+    if (argc > 2)
+    {
+        numBuses = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        devicesPerBus = atoi(argv[3]);
+    }
+    numDevices = numBuses * devicesPerBus;
+    if ((numBuses < 1) || (devicesPerBus < 1) ||
+        (numDevices > ASYNC_EXAMPLE_MAX_DEVICES))
+    {
+        ASTERA_ERROR("Up to %d devices supported", ASYNC_EXAMPLE_MAX_DEVICES);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    asteraLogSetLevel(1);
+
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        int i2cBus = dev / devicesPerBus;
+        int slaveAddress = 0x20 + (dev % devicesPerBus);
+
+        handles[dev] = asteraI2COpenConnection(i2cBus, slaveAddress);
+        if (handles[dev] < 0)
+        {
+            ASTERA_ERROR("Failed to open simulated device");
+            return ARIES_I2C_OPEN_FAILURE;
+        }
+        simSetLatency(handles[dev], latencyUs);
+
+        i2cDrivers[dev].handle = handles[dev];
+        i2cDrivers[dev].slaveAddr = slaveAddress;
+        i2cDrivers[dev].pecEnable = ARIES_I2C_PEC_DISABLE;
+        i2cDrivers[dev].i2cFormat = ARIES_I2C_FORMAT_ASTERA;
+        i2cDrivers[dev].lockInit = 0;
+
+        devices[dev].i2cDriver = &i2cDrivers[dev];
+        devices[dev].i2cBus = i2cBus;
+        devices[dev].partNumber = ARIES_PTX16;
+        devices[dev].tempAlertThreshC = 110.0;
+        devices[dev].tempWarnThreshC = 100.0;
+        devices[dev].minLinkFoMAlert = 0x55;
+        devices[dev].minDPLLFreqAlert = 2*1024;
+        devices[dev].maxDPLLFreqAlert = 14*1024;
+
+        rc = ariesInitDevice(&devices[dev], slaveAddress);
+        if (rc != ARIES_SUCCESS)
+        {
+            ASTERA_ERROR("Init device failed: %d", rc);
+            return rc;
+        }
+
+        links[dev].device = &devices[dev];
+        links[dev].config.linkId = 0;
+        links[dev].config.partNumber = devices[dev].partNumber;
+        links[dev].config.maxWidth = 16;
+        links[dev].config.startLane = 0;
+        fleetLinks[dev] = &links[dev];
+    }
+
+    ASTERA_INFO("Simulated bus latency: %d us, buses: %d, devices per bus: %d",
+        latencyUs, numBuses, devicesPerBus);
+
+    // Serial: one device after the other from the calling thread
+    startUs = asyncExampleTimeUs();
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        rc = ariesCheckDeviceHealth(&devices[dev]);
+        CHECK_SUCCESS(rc);
+        rc = ariesGetCurrentTemp(&devices[dev]);
+        CHECK_SUCCESS(rc);
+        rc = ariesCheckLinkHealth(&links[dev]);
+        CHECK_SUCCESS(rc);
+    }
+    serialUs = asyncExampleTimeUs() - startUs;
+
+    // Async: queue everything, buses are serviced in parallel
+    startUs = asyncExampleTimeUs();
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        rc = ariesAsyncCheckDeviceHealth(&requests[dev][0], &devices[dev],
+            asyncExampleDone, &numFailed);
+        CHECK_SUCCESS(rc);
+        rc = ariesAsyncGetCurrentTemp(&requests[dev][1], &devices[dev],
+            asyncExampleDone, &numFailed);
+        CHECK_SUCCESS(rc);
+        rc = ariesAsyncCheckLinkHealth(&requests[dev][2], &links[dev],
+            asyncExampleDone, &numFailed);
+        CHECK_SUCCESS(rc);
+    }
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        for (op = 0; op < ASYNC_EXAMPLE_OPS_PER_DEVICE; op++)
+        {
+            ariesAsyncWait(&requests[dev][op]);
+        }
+    }
+    asyncUs = asyncExampleTimeUs() - startUs;
+
+    // Fleet: one call, consolidated results
+    startUs = asyncExampleTimeUs();
+    rc = ariesFleetCheckHealth(fleetLinks, numDevices, results);
+    CHECK_SUCCESS(rc);
+    fleetUs = asyncExampleTimeUs() - startUs;
+
+    ariesAsyncShutdown();
+
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        ASTERA_INFO("Bus %d addr 0x%x: rc %d, temp %.2f C, device okay %d, link okay %d, %.1f ms",
+            devices[dev].i2cBus, i2cDrivers[dev].slaveAddr, results[dev].rc,
+            results[dev].currentTempC, results[dev].deviceOkay,
+            results[dev].linkOkay, results[dev].durationUs / 1e3);
+        if (results[dev].rc != ARIES_SUCCESS)
+        {
+            numFailed++;
+        }
+        closeI2CConnection(handles[dev]);
+    }
+
+    ASTERA_INFO("Serial: %.1f ms, async: %.1f ms (%.2fx), fleet: %.1f ms (%.2fx)",
+        serialUs / 1e3, asyncUs / 1e3, serialUs / asyncUs, fleetUs / 1e3,
+        serialUs / fleetUs);
+
+    if (numFailed != 0)
+    {
+        ASTERA_ERROR("%d async operations failed", numFailed);
+        return ARIES_FAILURE;
+    }
+
+    return ARIES_SUCCESS;
+}
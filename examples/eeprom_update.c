@@ -21,6 +21,7 @@
 #include "../include/aries_api.h"
 #include "include/aspeed.h"
 
+#include <string.h>
 #include <unistd.h>
 
 int main(int argc, char* argv[])
@@ -78,7 +79,22 @@ int main(int argc, char* argv[])
     // PROGRAMMING
     // -------------------------------------------------------------------------
     // Update the firmware image stored in EEPROM
-    if (argc >= 2)
+    // Pass "delta" as second argument to only rewrite the EEPROM pages which
+    // differ from the new image
+    if ((argc >= 3) && (strcmp(argv[2], "delta") == 0))
+    {
+        AriesEEPROMPageDeltaStatsType deltaStats;
+        rc = ariesUpdateFirmwareDelta(ariesDevice, argv[1],
+            ARIES_FW_IMAGE_FORMAT_IHX, &deltaStats);
+        if (rc != ARIES_SUCCESS)
+        {
+            ASTERA_ERROR("Failed to update the firmware image. RC = %d", rc);
+        }
+        ASTERA_INFO("Pages: %d, changed: %d, page writes: %d, failed: %d",
+            deltaStats.numPages, deltaStats.numPagesChanged,
+            deltaStats.numPageWrites, deltaStats.numPagesFailed);
+    }
+    else if (argc >= 2)
     {
         rc = ariesUpdateFirmware(ariesDevice, argv[1], ARIES_FW_IMAGE_FORMAT_IHX);
         if (rc != ARIES_SUCCESS)
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file fleet_update.c
+ * @brief Example application which updates the FW of several simulated
+ * Retimers (examples/source/sim.c) spread over multiple I2C buses in one
+ * fleet update (ariesFleetUpdateFirmwareStart), printing the aggregate
+ * progress, throughput and ETA while it runs and the result of each device
+ * at the end. The simulated EEPROMs are loaded with the image with one page
+ * changed per device, so a delta update rewrites a single page per device.
+ * No hardware is required.
+ *
+ * Usage: fleet_update imageFile [numBuses] [devicesPerBus] [delta]
+ */
+
+#include "../include/aries_api.h"
+#include "../include/aries_async.h"
+#include "include/sim.h"
+
+#include <string.h>
+#include <unistd.h>
+
+#define FLEET_UPDATE_MAX_DEVICES 16
+#define FLEET_UPDATE_EEPROM_WRITE_CYCLE_US 3000
+#define FLEET_UPDATE_PROGRESS_USEC 500000
+
+int main(int argc, char* argv[])
+{
+    AriesDeviceType devices[FLEET_UPDATE_MAX_DEVICES];
+    AriesI2CDriverType i2cDrivers[FLEET_UPDATE_MAX_DEVICES];
+    AriesDeviceType* fleetDevices[FLEET_UPDATE_MAX_DEVICES];
+    AriesFleetUpdateResultType results[FLEET_UPDATE_MAX_DEVICES];
+    AriesFleetUpdateProgressType progress;
+    AriesFleetUpdateType update;
+    AriesErrorType rc;
+    int handles[FLEET_UPDATE_MAX_DEVICES];
+    int numBuses = 2;
+    int devicesPerBus = 2;
+    int numDevices;
+    int numFailed = 0;
+    int dev;
+    bool delta = false;
+    uint8_t* image;
+
+    if (argc < 2)
+    {
+        printf("Usage: %s imageFile [numBuses] [devicesPerBus] [delta]\n",
+            argv[0]);
+        return ARIES_INVALID_ARGUMENT;
+    }
+    if (argc > 2)
+    {
+        numBuses = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        devicesPerBus = atoi(argv[3]);
+    }
+    if (argc > 4)
+    {
+        delta = (strcmp(argv[4], "delta") == 0);
+    }
+    numDevices = numBuses * devicesPerBus;
+    if ((numBuses < 1) || (devicesPerBus < 1) ||
+        (numDevices > FLEET_UPDATE_MAX_DEVICES))
+    {
+        ASTERA_ERROR("Up to %d devices supported", FLEET_UPDATE_MAX_DEVICES);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    asteraLogSetLevel(1);
+
+    image = (uint8_t*) malloc(ARIES_EEPROM_NUM_BYTES);
+    if (image == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+    rc = ariesLoadIhxFile(argv[1], image);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to load the .ihx file. RC = %d", rc);
+        free(image);
+        return rc;
+    }
+
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        int i2cBus = dev / devicesPerBus;
+        int slaveAddress = 0x20 + (dev % devicesPerBus);
+        int page = dev * ARIES_EEPROM_PAGE_SIZE;
+
+        handles[dev] = asteraI2COpenConnection(i2cBus, slaveAddress);
+        if (handles[dev] < 0)
+        {
+            ASTERA_ERROR("Failed to open simulated device");
+            free(image);
+            return ARIES_I2C_OPEN_FAILURE;
+        }
+        simSetEepromWriteCycle(handles[dev],
+            FLEET_UPDATE_EEPROM_WRITE_CYCLE_US);
+
+        // Current EEPROM content: the image with one page changed
+        image[page] ^= 0xff;
+        simLoadEeprom(handles[dev], image, ARIES_EEPROM_NUM_BYTES);
+        image[page] ^= 0xff;
+
+        i2cDrivers[dev].handle = handles[dev];
+        i2cDrivers[dev].slaveAddr = slaveAddress;
+        i2cDrivers[dev].pecEnable = ARIES_I2C_PEC_DISABLE;
+        i2cDrivers[dev].i2cFormat = ARIES_I2C_FORMAT_ASTERA;
+        i2cDrivers[dev].lockInit = 0;
+
+        devices[dev].i2cDriver = &i2cDrivers[dev];
+        devices[dev].i2cBus = i2cBus;
+        devices[dev].partNumber = ARIES_PTX16;
+
+        rc = ariesInitDevice(&devices[dev], slaveAddress);
+        if (rc != ARIES_SUCCESS)
+        {
+            ASTERA_ERROR("Init device failed: %d", rc);
+            free(image);
+            return rc;
+        }
+        fleetDevices[dev] = &devices[dev];
+    }
+    free(image);
+
+    ASTERA_INFO("Updating %d devices on %d buses (%s update)", numDevices,
+        numBuses, delta ? "delta" : "full");
+
+    rc = ariesFleetUpdateFirmwareStart(&update, fleetDevices, numDevices,
+        argv[1], ARIES_FW_IMAGE_FORMAT_IHX, delta, results);
+    CHECK_SUCCESS(rc);
+
+    do
+    {
+        usleep(FLEET_UPDATE_PROGRESS_USEC);
+        ariesFleetUpdateFirmwareProgress(&update, &progress);
+        ASTERA_INFO("%3d%% - %d queued, %d running, %d done, %d failed - %.1f KB/s, elapsed %.1f s, ETA %.1f s",
+            progress.percentComplete, progress.numQueued, progress.numRunning,
+            progress.numDone, progress.numFailed, progress.bytesPerSec / 1024,
+            progress.elapsedSec, progress.etaSec);
+    } while ((progress.numQueued + progress.numRunning) > 0);
+
+    rc = ariesFleetUpdateFirmwareWait(&update);
+
+    ariesAsyncShutdown();
+
+    for (dev = 0; dev < numDevices; dev++)
+    {
+        ASTERA_INFO("Bus %d addr 0x%x: rc %d, %d of %d pages rewritten, %.1f s",
+            devices[dev].i2cBus, i2cDrivers[dev].slaveAddr, results[dev].rc,
+            results[dev].deltaStats.numPagesChanged,
+            results[dev].deltaStats.numPages, results[dev].durationUs / 1e6);
+        if (results[dev].rc != ARIES_SUCCESS)
+        {
+            numFailed++;
+        }
+        closeI2CConnection(handles[dev]);
+    }
+
+    if (numFailed != 0)
+    {
+        ASTERA_ERROR("%d devices failed to update", numFailed);
+        return rc;
+    }
+
+    return ARIES_SUCCESS;
+}
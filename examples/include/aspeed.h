@@ -27,8 +27,19 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/file.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>   // linux library included on A-Speed
 
+#include "../../include/aries_api_types.h"
+
+/** Max I2C file descriptor for which the slave address is tracked */
+#define ASPEED_MAX_I2C_FILES 1024
+
+/** Max I2C message length: command code and SMBus block */
+#define ASPEED_I2C_MAX_MSG_LEN 256
+
 /**
  * @brief: Set I2C slave address
  *
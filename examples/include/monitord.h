@@ -0,0 +1,139 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file monitord.h
+ * @brief Definition of the binary protocol of aries-monitord
+ * (examples/aries_monitord.c), served over a local Unix stream socket.
+ *
+ * A client sends MonitordRequestType messages; the daemon answers each with
+ * a MonitordResponseHeaderType followed by payloadLen bytes of payload (one
+ * of the Monitord*PayloadType structs, depending on cmd). All fields are in
+ * host byte order, as both ends run on the same host.
+ */
+
+#ifndef ASTERA_ARIES_SDK_MONITORD_H_
+#define ASTERA_ARIES_SDK_MONITORD_H_
+
+#include <stdint.h>
+
+/** Default socket path */
+#define MONITORD_DEFAULT_SOCKET "/run/aries-monitord.sock"
+
+/** Protocol magic ("AM") */
+#define MONITORD_MAGIC 0x4d41
+
+/** Protocol version */
+#define MONITORD_VERSION 1
+
+/** maxAgeMs value selecting the daemon's default staleness bound */
+#define MONITORD_MAX_AGE_DEFAULT 0xffffffff
+
+/** Max num LTSSM log entries in a MONITORD_CMD_LTSSM_LOG payload (Main
+ *  Micro print buffer size) */
+#define MONITORD_MAX_LOG_ENTRIES 512
+
+/**
+ * @brief Enumeration of query commands
+ */
+typedef enum MonitordCmd
+{
+    MONITORD_CMD_DEVICE = 1,     /**< Device temperatures and health */
+    MONITORD_CMD_LINK_STATE = 2, /**< Link state, FoM, recovery count, DPLL */
+    MONITORD_CMD_EYE = 3,        /**< Per lane FoM (eye) of both sides */
+    MONITORD_CMD_LTSSM_LOG = 4,  /**< Main Micro LTSSM log of the link */
+} MonitordCmdType;
+
+/**
+ * @brief Query message
+ */
+typedef struct __attribute__((packed)) MonitordRequest
+{
+    uint16_t magic;     /**< MONITORD_MAGIC */
+    uint8_t version;    /**< MONITORD_VERSION */
+    uint8_t cmd;        /**< MonitordCmdType */
+    uint8_t device;     /**< Retimer index, in daemon command line order */
+    uint8_t link;       /**< Link index within the Retimer */
+    uint16_t reserved;  /**< Set to 0 */
+    uint32_t maxAgeMs;  /**< Max age of cached data served (or default) */
+} MonitordRequestType;
+
+/**
+ * @brief Response header
+ */
+typedef struct __attribute__((packed)) MonitordResponseHeader
+{
+    uint16_t magic;     /**< MONITORD_MAGIC */
+    uint8_t version;    /**< MONITORD_VERSION */
+    uint8_t cmd;        /**< cmd of the query */
+    int32_t rc;         /**< AriesErrorType of the query */
+    uint32_t payloadLen; /**< Num payload bytes following the header */
+    uint32_t ageMs;     /**< Age of the data served */
+} MonitordResponseHeaderType;
+
+/**
+ * @brief Payload of MONITORD_CMD_DEVICE
+ */
+typedef struct __attribute__((packed)) MonitordDevicePayload
+{
+    float currentTempC; /**< Current average temp */
+    float maxTempC;     /**< Max temp seen */
+    uint8_t deviceOkay; /**< Device is healthy */
+    uint8_t overtempAlert; /**< Over temp alert */
+    uint8_t fwMajor;    /**< FW version major */
+    uint8_t fwMinor;    /**< FW version minor */
+    uint16_t fwBuild;   /**< FW version build */
+} MonitordDevicePayloadType;
+
+/**
+ * @brief Payload of MONITORD_CMD_LINK_STATE
+ */
+typedef struct __attribute__((packed)) MonitordLinkStatePayload
+{
+    uint8_t state;      /**< AriesLinkStateEnumType */
+    uint8_t rate;       /**< Data rate (1=Gen1, 5=Gen5) */
+    uint8_t width;      /**< Link width */
+    uint8_t curWidth;   /**< Current Link width */
+    uint8_t linkOkay;   /**< Link is healthy */
+    uint8_t linkMinFoM; /**< Min FoM across Lanes */
+    uint16_t recoveryCount; /**< Recovery count */
+    uint16_t usppMinDPLLCode; /**< Min DPLL code, USPP */
+    uint16_t usppMaxDPLLCode; /**< Max DPLL code, USPP */
+    uint16_t dsppMinDPLLCode; /**< Min DPLL code, DSPP */
+    uint16_t dsppMaxDPLLCode; /**< Max DPLL code, DSPP */
+    char linkMinFoMRx[8]; /**< Receiver with min FoM */
+} MonitordLinkStatePayloadType;
+
+/**
+ * @brief Payload of MONITORD_CMD_EYE
+ */
+typedef struct __attribute__((packed)) MonitordEyePayload
+{
+    uint8_t width;          /**< Num valid lanes */
+    uint8_t usppFoM[16];    /**< FoM per Lane, USPP */
+    uint8_t dsppFoM[16];    /**< FoM per Lane, DSPP */
+} MonitordEyePayloadType;
+
+/**
+ * @brief Entry of a MONITORD_CMD_LTSSM_LOG payload, which is an array of
+ * up to MONITORD_MAX_LOG_ENTRIES entries
+ */
+typedef struct __attribute__((packed)) MonitordLogEntry
+{
+    uint16_t offset;    /**< Log offset */
+    uint8_t data;       /**< Log data */
+} MonitordLogEntryType;
+
+#endif /* ASTERA_ARIES_SDK_MONITORD_H_ */
@@ -0,0 +1,286 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file sim.h
+ * @brief Definition of an in-memory simulated Aries Retimer, which implements
+ * the user I2C hooks so that the SDK can be exercised without hardware
+ */
+
+#ifndef ASTERA_ARIES_SDK_SIM_H_
+#define ASTERA_ARIES_SDK_SIM_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/** Max number of simulated Retimers (one per bus/slave address pair) */
+#define SIM_MAX_DEVICES 16
+
+/** Max number of simulated I2C buses */
+#define SIM_MAX_BUSES 16
+
+/** Size of simulated CSR space (17-bit address) */
+#define SIM_CSR_SIZE 0x20000
+
+/** Size of simulated Main Micro and Path Micro SRAM (17-bit address) */
+#define SIM_SRAM_SIZE 0x20000
+
+/** Number of simulated Path Micros */
+#define SIM_NUM_PATH_MICROS 16
+
+/** Number of simulated PMA quad slices (per side) */
+#define SIM_NUM_QUAD_SLICES 4
+
+/** Size of simulated PMA register space per quad slice, in 16-bit words */
+#define SIM_PMA_SIZE 0x10000
+
+/** Size of simulated eFuse array */
+#define SIM_EFUSE_SIZE 128
+
+/** Number of slots in the simulated busy-status table */
+#define SIM_MAX_PENDING_STATUS 32
+
+/** Max number of links described in the simulated Main Micro FW info */
+#define SIM_MAX_LINKS 8
+
+/** Simulated FW version (1.24.0 and later use the optimized EEPROM assist) */
+#define SIM_FW_VERSION_MAJOR 1
+#define SIM_FW_VERSION_MINOR 28
+#define SIM_FW_VERSION_BUILD 4
+
+/** Simulated Main Micro DMEM offsets of the FW structs */
+#define SIM_MM_PRINT_INFO_OFFSET 0x5000
+#define SIM_MM_GP_CTRL_STS_OFFSET 0x5400
+#define SIM_MM_LINK_STRUCT_OFFSET 0x6000
+#define SIM_MM_LINK_STRUCT_STRIDE 0x200
+
+/** Simulated Path Micro DMEM offsets of the FW structs */
+#define SIM_PM_PRINT_INFO_OFFSET 0x400
+#define SIM_PM_GP_CTRL_STS_OFFSET 0x600
+
+/** eFuse address and data CSRs */
+#define SIM_EFUSE_ADDR_CSR 0x8f6
+#define SIM_EFUSE_DATA_CSR 0x8f7
+
+/** I2C Master (DW I2C IP) registers reachable through the IC CMD window */
+#define SIM_I2C_MST_IC_TAR 0x04
+#define SIM_I2C_MST_IC_DATA_CMD 0x10
+#define SIM_I2C_MST_IC_ENABLE 0x6c
+
+/** I2C Master data command flags (DATA1 byte) */
+#define SIM_I2C_MST_FLAG_READ 0x1
+#define SIM_I2C_MST_FLAG_STOP 0x2
+#define SIM_I2C_MST_FLAG_RESTART 0x4
+
+/** Simulated PMA temperature ADC codes (approx. 50C current, 55C max) */
+#define SIM_CURRENT_TEMP_ADC_CODE 521
+#define SIM_MAX_TEMP_ADC_CODE 506
+
+/** Simulated PMA DPLL frequency code and adaptation FoM */
+#define SIM_DPLL_FREQ_CODE 8192
+#define SIM_RX_ADAPT_FOM 0xb0
+
+/**
+ * @brief Simulated device transaction counters
+ */
+typedef struct SimStats
+{
+    uint64_t writeTransactions;     /**< Bus write transactions */
+    uint64_t readTransactions;      /**< Bus read transactions */
+    uint64_t bytesWritten;          /**< Bytes written on bus (incl. framing) */
+    uint64_t bytesRead;             /**< Bytes read from bus (incl. framing) */
+    uint64_t pecErrors;             /**< Write transactions with bad PEC */
+    uint64_t framingErrors;         /**< Transactions with invalid framing */
+    uint64_t mailboxCommands;       /**< Indirect mailbox commands executed */
+    uint64_t statusPolls;           /**< Reads of a busy mailbox status reg */
+    uint64_t eepromBytesWritten;    /**< Bytes committed to simulated EEPROM */
+    uint64_t eepromBytesRead;       /**< Bytes fetched from simulated EEPROM */
+    uint64_t eepromNacks;           /**< EEPROM accesses during a write cycle */
+    uint64_t i2cMstDropped;         /**< I2C Master commands dropped after a
+                                         TX abort */
+    uint64_t blockCalls;            /**< Calls to asteraI2CBlock() */
+    uint64_t transfers;             /**< Calls to asteraI2CTransfer() */
+} SimStatsType;
+
+/**
+ * @brief Set the latency added to every call into the simulated low-level I2C
+ * methods. A call to asteraI2CTransfer() is charged once, regardless of the
+ * number of transactions it carries
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] latencyUs    Per-call latency, in microseconds
+ * @return int             Zero if success, else a negative value
+ */
+int simSetLatency(int handle, int latencyUs);
+
+/**
+ * @brief Set number of status polls a mailbox command stays busy for
+ *
+ * Applies to the Main Micro, Path Micro and PMA assist mailboxes, and to the
+ * Main Micro EEPROM assist command register.
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] numPolls     Number of status reads returning busy
+ * @return int             Zero if success, else a negative value
+ */
+int simSetBusyPolls(int handle, int numPolls);
+
+/**
+ * @brief Set duration of a simulated EEPROM write cycle
+ *
+ * After a write transaction to the simulated EEPROM ends, the EEPROM does not
+ * acknowledge any access for this long. An access which is not acknowledged
+ * aborts the I2C Master transfer: the data register is left unchanged, and
+ * further I2C Master commands are dropped until the I2C Master is disabled.
+ * Main Micro assisted reads and writes are dropped and their status is left
+ * set, so they fail.
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] cycleUs      Write cycle time, in microseconds
+ * @return int             Zero if success, else a negative value
+ */
+int simSetEepromWriteCycle(int handle, int cycleUs);
+
+/**
+ * @brief Get transaction counters of a simulated device
+ *
+ * @param[in]  handle      Handle returned by asteraI2COpenConnection()
+ * @param[out] stats       Counter snapshot
+ * @return int             Zero if success, else a negative value
+ */
+int simGetStats(int handle, SimStatsType* stats);
+
+/**
+ * @brief Clear transaction counters of a simulated device
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @return int             Zero if success, else a negative value
+ */
+int simClearStats(int handle);
+
+/**
+ * @brief Restore a simulated device to its power-on state
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @return int             Zero if success, else a negative value
+ */
+int simResetDevice(int handle);
+
+/**
+ * @brief Write bytes to the CSR space of a simulated device (no side effects)
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] address      CSR address
+ * @param[in] numBytes     Number of bytes
+ * @param[in] values       Data to write
+ * @return int             Zero if success, else a negative value
+ */
+int simWriteCsr(int handle, int address, int numBytes, uint8_t* values);
+
+/**
+ * @brief Read bytes from the CSR space of a simulated device (no side effects)
+ *
+ * @param[in]  handle      Handle returned by asteraI2COpenConnection()
+ * @param[in]  address     CSR address
+ * @param[in]  numBytes    Number of bytes
+ * @param[out] values      Data read
+ * @return int             Zero if success, else a negative value
+ */
+int simReadCsr(int handle, int address, int numBytes, uint8_t* values);
+
+/**
+ * @brief Write bytes to Main Micro SRAM of a simulated device
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] address      SRAM address (same as SDK Main Micro address)
+ * @param[in] numBytes     Number of bytes
+ * @param[in] values       Data to write
+ * @return int             Zero if success, else a negative value
+ */
+int simWriteMainMicroSram(int handle, int address, int numBytes,
+        uint8_t* values);
+
+/**
+ * @brief Write bytes to Path Micro SRAM of a simulated device
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] pathID       Path Micro ID (0-15)
+ * @param[in] address      SRAM address (same as SDK Path Micro address)
+ * @param[in] numBytes     Number of bytes
+ * @param[in] values       Data to write
+ * @return int             Zero if success, else a negative value
+ */
+int simWritePathMicroSram(int handle, int pathID, int address, int numBytes,
+        uint8_t* values);
+
+/**
+ * @brief Write a PMA register of a simulated device
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] side         PMA side (0 or 1)
+ * @param[in] quadSlice    Quad slice (0-3)
+ * @param[in] address      PMA register address
+ * @param[in] value        16-bit register value
+ * @return int             Zero if success, else a negative value
+ */
+int simWritePmaReg(int handle, int side, int quadSlice, int address,
+        uint16_t value);
+
+/**
+ * @brief Set the link struct fields the SDK reads for a link
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] linkNum      Link number (0-7)
+ * @param[in] width        Link width
+ * @param[in] state        Link state (see AriesLinkStateEnumType)
+ * @param[in] rate         Link rate (0: Gen1, ... 4: Gen5)
+ * @return int             Zero if success, else a negative value
+ */
+int simSetLinkState(int handle, int linkNum, int width, int state, int rate);
+
+/**
+ * @brief Load contents of the simulated EEPROM
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ * @param[in] image        Image to copy into the EEPROM
+ * @param[in] numBytes     Number of bytes in image
+ * @return int             Zero if success, else a negative value
+ */
+int simLoadEeprom(int handle, uint8_t* image, int numBytes);
+
+/**
+ * @brief Read contents of the simulated EEPROM
+ *
+ * @param[in]  handle      Handle returned by asteraI2COpenConnection()
+ * @param[in]  address     EEPROM address
+ * @param[in]  numBytes    Number of bytes
+ * @param[out] values      Data read
+ * @return int             Zero if success, else a negative value
+ */
+int simReadEeprom(int handle, int address, int numBytes, uint8_t* values);
+
+/**
+ * @brief Close I2C connection
+ *
+ * @param[in] handle       Handle returned by asteraI2COpenConnection()
+ */
+void closeI2CConnection(int handle);
+
+#endif /* ASTERA_ARIES_SDK_SIM_H_ */
@@ -24,10 +24,14 @@
  *        - Error-scenario handling for cases where continuous monitoring has
  *          determined the state is unexpected and additional debug information
  *          needs to be gathered.
+ *        - Publishing the monitored state in shared memory, so that other
+ *          processes (see shm_reader.c) can read it without bus access.
  */
 
 #include "../include/aries_api.h"
 #include "../include/aries_link.h"
+#include "../include/aries_telemetry.h"
+#include "../include/aries_shm.h"
 #include "include/aspeed.h"
 
 #include <unistd.h>
@@ -36,6 +40,7 @@
 #define NUM_RETIMERS 2
 #define NUM_LINKS_PER_RETIMER 2
 #define NUM_TOTAL_LINKS NUM_RETIMERS * NUM_LINKS_PER_RETIMER
+#define NUM_TELEMETRY_SAMPLES 64
 
 int main(void)
 {
@@ -139,6 +144,27 @@ int main(void)
     link[3].config.maxWidth = 8;
     link[3].config.startLane = 8;
 
+    // Keep a history of each Link's health in a telemetry ring, so that trends
+    // (e.g. FoM decay) leading up to an error can be reported
+    static AriesTelemetrySlotType telemetrySlots[NUM_TOTAL_LINKS]
+        [NUM_TELEMETRY_SAMPLES];
+    AriesTelemetryRingType telemetry[NUM_TOTAL_LINKS];
+    AriesTelemetrySampleType history[NUM_TELEMETRY_SAMPLES];
+    int numHistory;
+    int j;
+    for (i = 0; i < NUM_TOTAL_LINKS; ++i)
+    {
+        rc = ariesTelemetryRingInit(&telemetry[i], telemetrySlots[i],
+            NUM_TELEMETRY_SAMPLES);
+        CHECK_SUCCESS(rc);
+    }
+
+    // Publish device and Link state in shared memory for other processes
+    AriesShmType shm;
+    rc = ariesShmPublisherOpen(&shm, ARIES_SHM_DEFAULT_NAME, NUM_RETIMERS,
+        NUM_TOTAL_LINKS);
+    CHECK_SUCCESS(rc);
+
     // -------------------------------------------------------------------------
     // CONTINUOUS MONITORING
     // -------------------------------------------------------------------------
@@ -153,6 +179,18 @@ int main(void)
             rc = ariesCheckLinkHealth(&link[i]);
             CHECK_SUCCESS(rc);
 
+            // Record the Link's health in its history
+            rc = ariesTelemetryRingRecord(&telemetry[i], &link[i]);
+            CHECK_SUCCESS(rc);
+
+            // Publish the Link's and its Retimer's state
+            rc = ariesShmPublishLink(&shm, i, i / NUM_LINKS_PER_RETIMER,
+                &link[i]);
+            CHECK_SUCCESS(rc);
+            rc = ariesShmPublishDevice(&shm, i / NUM_LINKS_PER_RETIMER,
+                link[i].device);
+            CHECK_SUCCESS(rc);
+
             // Read and report the recovery count
             rc = ariesGetLinkRecoveryCount(&link[i], &recoveryCount);
             CHECK_SUCCESS(rc);
@@ -176,8 +214,21 @@ int main(void)
                 ASTERA_ERROR("Unexpected link%d state: %d", i, link[i].state.state);
                 ASTERA_ERROR("Now capturing link stats and logs");
 
-                // Capture detailed debug information from Retimer
-                rc = ariesLinkDumpDebugInfo(&link[i]);
+                // Report the Link's recent history
+                rc = ariesTelemetryRingReadLatest(&telemetry[i], history,
+                    NUM_TELEMETRY_SAMPLES, &numHistory);
+                CHECK_SUCCESS(rc);
+                for (j = 0; j < numHistory; j++)
+                {
+                    ASTERA_INFO("link%d t=%llu us: state %d, FoM 0x%02x, temp %.2f C",
+                        i, (unsigned long long) history[j].timestampUs,
+                        history[j].state, history[j].linkMinFoM,
+                        history[j].currentTempC);
+                }
+
+                // Capture detailed debug information from Retimer into a
+                // binary snapshot (convert it with snapshot_convert)
+                rc = ariesLinkWriteSnapshot(&link[i], ".", "link_snapshot");
                 CHECK_SUCCESS(rc);
 
                 // In this example, the continuous monitoring section exits when
@@ -190,6 +241,8 @@ int main(void)
         sleep(5);
     }
 
+    ariesShmClose(&shm, true);
+
     for (i = 0; i < NUM_RETIMERS; ++i)
     {
         // Close all open connections
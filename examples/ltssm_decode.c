@@ -0,0 +1,333 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file ltssm_decode.c
+ * @brief Example application which reads the Main Micro and Path Micro LTSSM
+ * logs of a link and prints them as decoded events, using the Main Micro
+ * and Path Micro logger format tables of the FW running on the Retimer. The
+ * tables are the FW format dictionaries (e.g.
+ * scripts/link_micro_logs/ALMainFmtIdDict.py and ALPathFmtIdDict.py), or
+ * text tables if the file name does not end in ".py". No post-processing is
+ * needed. With -f, the logs are followed: every periodMs milliseconds only
+ * the bytes printed since the last poll are read and decoded, without
+ * pausing the micros.
+ *
+ * Usage: ltssm_decode [-f periodMs] mainFmtTable pathFmtTable [i2cBus]
+ *        [slaveAddr] [startLane] [width]
+ */
+
+#include "../include/aries_api.h"
+#include "../include/aries_link.h"
+#include "../include/aries_ltssm.h"
+#include "include/aspeed.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_LOGGER_FMTS 256
+
+/* Main Micro log and a Path Micro log per lane */
+#define MAX_LOGS 17
+
+/*
+ * Print a decoded event
+ */
+static void printEvent(
+        const AriesLTSSMEventType* event,
+        void* userData)
+{
+    static const char* kindNames[] = {"msg", "state", "eq", "rate", "unknown",
+        "overrun"};
+    int* numEvents = (int*) userData;
+    char message[2*ARIES_LTSSM_FMT_TEXT_LEN];
+    char linkPath[16];
+
+    ariesLTSSMEventFormat(event, message, sizeof(message));
+    if (event->logType == ARIES_LTSSM_LINK_LOGGER)
+    {
+        linkPath[0] = '\0';
+        if (event->pathId >= 0)
+        {
+            snprintf(linkPath, sizeof(linkPath), "L%d P%d", event->linkId,
+                event->pathId);
+        }
+        else if (event->linkId >= 0)
+        {
+            snprintf(linkPath, sizeof(linkPath), "L%d", event->linkId);
+        }
+        printf("MM    %4d %-7s %-6s %s\n", event->offset,
+            kindNames[event->kind], linkPath, message);
+    }
+    else
+    {
+        printf("PM %2d %4d %-7s        %s\n", event->logType, event->offset,
+            kindNames[event->kind], message);
+    }
+    (*numEvents)++;
+}
+
+/*
+ * Load a logger format table, from a FW format dictionary if the file name
+ * ends in ".py"
+ */
+static AriesErrorType loadFmtTable(
+        const char* filename,
+        AriesDeviceType* device,
+        AriesLTSSMFmtType* fmts,
+        int* numFmts)
+{
+    AriesFWVersionType fwVersion;
+    AriesErrorType rc;
+    size_t len = strlen(filename);
+
+    if ((len < 3) || (strcmp(&filename[len - 3], ".py") != 0))
+    {
+        return ariesLTSSMFmtTableLoad(filename, fmts, MAX_LOGGER_FMTS,
+            numFmts);
+    }
+
+    rc = ariesLTSSMFmtTableLoadDict(filename, fmts, MAX_LOGGER_FMTS, numFmts,
+        &fwVersion);
+    CHECK_SUCCESS(rc);
+    if ((fwVersion.major != device->fwVersion.major) ||
+        (fwVersion.minor != device->fwVersion.minor) ||
+        (fwVersion.build != device->fwVersion.build))
+    {
+        ASTERA_WARN("%s is for FW %d.%d.%d, Retimer runs FW %d.%d.%d",
+            filename, fwVersion.major, fwVersion.minor, fwVersion.build,
+            device->fwVersion.major, device->fwVersion.minor,
+            device->fwVersion.build);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Follow the logs of a link until an error occurs
+ */
+static AriesErrorType followLogs(
+        AriesLinkType* link,
+        const AriesLTSSMFmtType* mmFmts,
+        int numMmFmts,
+        const AriesLTSSMFmtType* pmFmts,
+        int numPmFmts,
+        int periodMs,
+        int* numEvents)
+{
+    AriesLTSSMTailType tails[MAX_LOGS];
+    AriesLTSSMDecoderType* decoders;
+    AriesErrorType rc;
+    int numLogs;
+    int logIndex;
+
+    numLogs = 1 + link->state.width;
+    if (numLogs > MAX_LOGS)
+    {
+        numLogs = MAX_LOGS;
+    }
+
+    // Each log needs its own decoder, to frame messages split across polls
+    decoders = (AriesLTSSMDecoderType*) malloc(numLogs *
+        sizeof(AriesLTSSMDecoderType));
+    if (decoders == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+    for (logIndex = 0; logIndex < numLogs; logIndex++)
+    {
+        ariesLTSSMTailInit(&tails[logIndex], link, (logIndex == 0) ?
+            ARIES_LTSSM_LINK_LOGGER :
+            (link->config.startLane + logIndex - 1));
+        ariesLTSSMDecoderInit(&decoders[logIndex], mmFmts, numMmFmts,
+            pmFmts, numPmFmts);
+        ariesLTSSMDecoderSetCallback(&decoders[logIndex], printEvent,
+            numEvents);
+    }
+
+    while (1)
+    {
+        for (logIndex = 0; logIndex < numLogs; logIndex++)
+        {
+            rc = ariesLTSSMTailDecode(&tails[logIndex], &decoders[logIndex]);
+            if (rc != ARIES_SUCCESS)
+            {
+                free(decoders);
+                return rc;
+            }
+        }
+        fflush(stdout);
+        usleep(periodMs * 1000);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    AriesLTSSMFmtType* mmFmts;
+    AriesLTSSMFmtType* pmFmts;
+    AriesLTSSMDecoderType decoder;
+    AriesI2CDriverType i2cDriver;
+    AriesDeviceType ariesDevice;
+    AriesLinkType link;
+    AriesErrorType rc;
+    int ariesHandle;
+    int i2cBus = 1;
+    int ariesSlaveAddress = 0x20;
+    int numMmFmts;
+    int numPmFmts;
+    int numEvents = 0;
+    int laneIndex;
+    int periodMs = 0;
+    int argIndex = 1;
+
+    if ((argc > 2) && (strcmp(argv[1], "-f") == 0))
+    {
+        periodMs = strtol(argv[2], NULL, 0);
+        argIndex = 3;
+    }
+    if (argc <= (argIndex + 1))
+    {
+        printf("Usage: %s [-f periodMs] mainFmtTable pathFmtTable [i2cBus] "
+            "[slaveAddr] [startLane] [width]\n", argv[0]);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    asteraLogSetLevel(1);
+
+    memset(&link, 0, sizeof(link));
+    link.config.startLane = 0;
+    link.config.maxWidth = 16;
+    if (argc > (argIndex + 2))
+    {
+        i2cBus = strtol(argv[argIndex + 2], NULL, 0);
+    }
+    if (argc > (argIndex + 3))
+    {
+        ariesSlaveAddress = strtol(argv[argIndex + 3], NULL, 0);
+    }
+    if (argc > (argIndex + 4))
+    {
+        link.config.startLane = strtol(argv[argIndex + 4], NULL, 0);
+    }
+    if (argc > (argIndex + 5))
+    {
+        link.config.maxWidth = strtol(argv[argIndex + 5], NULL, 0);
+    }
+
+    mmFmts = (AriesLTSSMFmtType*) malloc(2 * MAX_LOGGER_FMTS *
+        sizeof(AriesLTSSMFmtType));
+    if (mmFmts == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+    pmFmts = &mmFmts[MAX_LOGGER_FMTS];
+
+    ariesHandle = asteraI2COpenConnection(i2cBus, ariesSlaveAddress);
+    if (ariesHandle < 0)
+    {
+        ASTERA_ERROR("Failed to open connection to Retimer");
+        free(mmFmts);
+        return ARIES_I2C_OPEN_FAILURE;
+    }
+
+    memset(&i2cDriver, 0, sizeof(i2cDriver));
+    i2cDriver.handle = ariesHandle;
+    i2cDriver.slaveAddr = ariesSlaveAddress;
+    i2cDriver.pecEnable = ARIES_I2C_PEC_DISABLE;
+    i2cDriver.i2cFormat = ARIES_I2C_FORMAT_ASTERA;
+    i2cDriver.lockInit = 0;
+
+    memset(&ariesDevice, 0, sizeof(ariesDevice));
+    ariesDevice.i2cDriver = &i2cDriver;
+    ariesDevice.i2cBus = i2cBus;
+    ariesDevice.partNumber = ARIES_PTX16;
+
+    rc = ariesInitDevice(&ariesDevice, ariesSlaveAddress);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Init device failed");
+        closeI2CConnection(ariesHandle);
+        free(mmFmts);
+        return rc;
+    }
+
+    // Load the logger format tables matching the FW on the Retimer
+    rc = loadFmtTable(argv[argIndex], &ariesDevice, mmFmts, &numMmFmts);
+    if (rc == ARIES_SUCCESS)
+    {
+        rc = loadFmtTable(argv[argIndex + 1], &ariesDevice, pmFmts,
+            &numPmFmts);
+    }
+    if (rc == ARIES_SUCCESS)
+    {
+        rc = ariesLTSSMDecoderInit(&decoder, mmFmts, numMmFmts, pmFmts,
+            numPmFmts);
+    }
+    if (rc != ARIES_SUCCESS)
+    {
+        closeI2CConnection(ariesHandle);
+        free(mmFmts);
+        return rc;
+    }
+    ariesLTSSMDecoderSetCallback(&decoder, printEvent, &numEvents);
+
+    link.device = &ariesDevice;
+    link.config.partNumber = ariesDevice.partNumber;
+    rc = ariesGetLinkState(&link);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Get link state failed");
+        closeI2CConnection(ariesHandle);
+        free(mmFmts);
+        return rc;
+    }
+
+    ASTERA_INFO("FW %d.%d.%d, %d Main Micro and %d Path Micro logger formats",
+        ariesDevice.fwVersion.major, ariesDevice.fwVersion.minor,
+        ariesDevice.fwVersion.build, numMmFmts, numPmFmts);
+
+    if (periodMs > 0)
+    {
+        rc = followLogs(&link, mmFmts, numMmFmts, pmFmts, numPmFmts,
+            periodMs, &numEvents);
+        ASTERA_ERROR("Following LTSSM logs failed: %d", rc);
+        closeI2CConnection(ariesHandle);
+        free(mmFmts);
+        return rc;
+    }
+
+    // Main Micro log, then the Path Micro log of each lane
+    rc = ariesLTSSMDecodeLog(&link, ARIES_LTSSM_LINK_LOGGER, &decoder);
+    for (laneIndex = 0; (rc == ARIES_SUCCESS) &&
+        (laneIndex < link.state.width); laneIndex++)
+    {
+        rc = ariesLTSSMDecodeLog(&link,
+            (link.config.startLane + laneIndex), &decoder);
+    }
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Reading LTSSM logs failed: %d", rc);
+    }
+
+    ASTERA_INFO("%d events, %d unknown format IDs", numEvents,
+        decoder.numUnknown);
+
+    closeI2CConnection(ariesHandle);
+    free(mmFmts);
+
+    return rc;
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file ltssm_decode_test.c
+ * @brief Test which writes a Main Micro LTSSM log which has not wrapped into
+ * the simulated Aries Retimer (examples/source/sim.c), and checks that
+ * ariesLTSSMDecodeLog() and ariesLTSSMTailDecode() decode every message of
+ * it, in wrap-around and one-batch mode. The messages have zero link and
+ * variable bytes, so they cannot be told apart from the unwritten part of
+ * the buffer by their contents. No hardware is required.
+ *
+ * Usage: ltssm_decode_test
+ */
+
+#include "../include/aries_api.h"
+#include "../include/aries_ltssm.h"
+#include "include/sim.h"
+
+#define LTSSM_DECODE_TEST_NUM_MSGS 40
+
+static const AriesLTSSMFmtType ltssmDecodeTestFmts[] = {
+    {0x01, ARIES_LTSSM_EVENT_MESSAGE, "Link up"},
+    {0x02, ARIES_LTSSM_EVENT_STATE, "LTSSM state: %x"},
+    {0x03, ARIES_LTSSM_EVENT_RATE, "Rate change: Gen %d at %x ms"},
+};
+
+#define LTSSM_DECODE_TEST_NUM_FMTS \
+    ((int) (sizeof(ltssmDecodeTestFmts) / sizeof(ltssmDecodeTestFmts[0])))
+
+/*
+ * Write the test log at the start of the print buffer, zeros after it, and
+ * set the write offset to its end. Returns the offset of each message.
+ */
+static AriesErrorType ltssmDecodeTestWriteLog(
+        AriesDeviceType* device,
+        int* msgOffsets)
+{
+    uint8_t buffer[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    uint8_t writeOffset[2];
+    int offset;
+    int msg;
+    int numVars;
+    int rc;
+
+    memset(buffer, 0, sizeof(buffer));
+    offset = 0;
+    for (msg = 0; msg < LTSSM_DECODE_TEST_NUM_MSGS; msg++)
+    {
+        numVars = msg % LTSSM_DECODE_TEST_NUM_FMTS;
+        msgOffsets[msg] = offset;
+        buffer[offset] = ltssmDecodeTestFmts[numVars].fmtID;
+        offset += 2 + (2 * numVars);
+    }
+
+    rc = simWriteMainMicroSram(device->i2cDriver->handle,
+        (device->mm_print_info_struct_addr +
+        ARIES_PRINT_INFO_STRUCT_PRINT_BUFFER_OFFSET), sizeof(buffer), buffer);
+    if (rc != 0)
+    {
+        return ARIES_I2C_BLOCK_WRITE_FAILURE;
+    }
+
+    writeOffset[0] = offset & 0xff;
+    writeOffset[1] = (offset >> 8) & 0xff;
+    rc = simWriteMainMicroSram(device->i2cDriver->handle,
+        (device->mm_print_info_struct_addr +
+        ARIES_PRINT_INFO_STRUCT_WR_PTR_OFFSET), 2, writeOffset);
+    if (rc != 0)
+    {
+        return ARIES_I2C_BLOCK_WRITE_FAILURE;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Check that the decoded events are the messages of the test log
+ */
+static int ltssmDecodeTestCheck(
+        const char* name,
+        const char* api,
+        AriesLTSSMDecoderType* decoder,
+        const int* msgOffsets)
+{
+    int msg;
+    int numVars;
+
+    if (decoder->numEvents != LTSSM_DECODE_TEST_NUM_MSGS)
+    {
+        ASTERA_ERROR("%s %s: decoded %d events, expected %d", name, api,
+            decoder->numEvents, LTSSM_DECODE_TEST_NUM_MSGS);
+        return 1;
+    }
+    for (msg = 0; msg < LTSSM_DECODE_TEST_NUM_MSGS; msg++)
+    {
+        numVars = msg % LTSSM_DECODE_TEST_NUM_FMTS;
+        if ((decoder->events[msg].offset != msgOffsets[msg]) ||
+            (decoder->events[msg].fmtID != ltssmDecodeTestFmts[numVars].fmtID))
+        {
+            ASTERA_ERROR("%s %s: event %d is format 0x%02x at %d, "
+                "expected format 0x%02x at %d", name, api, msg,
+                decoder->events[msg].fmtID, decoder->events[msg].offset,
+                ltssmDecodeTestFmts[numVars].fmtID, msgOffsets[msg]);
+            return 1;
+        }
+    }
+    ASTERA_INFO("%s %s: passed", name, api);
+
+    return 0;
+}
+
+/*
+ * Decode the test log with ariesLTSSMDecodeLog() and ariesLTSSMTailDecode()
+ */
+static int ltssmDecodeTestRun(
+        const char* name,
+        AriesLinkType* link,
+        AriesLTSSMDecoderType* decoder,
+        const int* msgOffsets)
+{
+    AriesLTSSMTailType tail;
+    AriesErrorType rc;
+    int failures = 0;
+
+    decoder->numEvents = 0;
+    rc = ariesLTSSMDecodeLog(link, ARIES_LTSSM_LINK_LOGGER, decoder);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("%s: ariesLTSSMDecodeLog failed: %d", name, rc);
+        return 1;
+    }
+    failures += ltssmDecodeTestCheck(name, "ariesLTSSMDecodeLog", decoder,
+        msgOffsets);
+
+    rc = ariesLTSSMTailInit(&tail, link, ARIES_LTSSM_LINK_LOGGER);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("%s: ariesLTSSMTailInit failed: %d", name, rc);
+        return failures + 1;
+    }
+    decoder->numEvents = 0;
+    rc = ariesLTSSMTailDecode(&tail, decoder);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("%s: ariesLTSSMTailDecode failed: %d", name, rc);
+        return failures + 1;
+    }
+    failures += ltssmDecodeTestCheck(name, "ariesLTSSMTailDecode", decoder,
+        msgOffsets);
+
+    return failures;
+}
+
+int main(int argc, char* argv[])
+{
+    AriesDeviceType ariesDevice;
+    AriesI2CDriverType i2cDriver;
+    AriesLinkType link;
+    AriesLTSSMDecoderType decoder;
+    AriesLTSSMEventType events[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    AriesErrorType rc;
+    int msgOffsets[LTSSM_DECODE_TEST_NUM_MSGS];
+    int ariesHandle;
+    int ariesSlaveAddress = 0x20;
+    int failures = 0;
+    uint8_t oneBatchWrEn = 0;
+
+    (void) argc;
+    (void) argv;
+
+    asteraLogSetLevel(2);
+
+    ariesHandle = asteraI2COpenConnection(0, ariesSlaveAddress);
+    if (ariesHandle < 0)
+    {
+        ASTERA_ERROR("Failed to open simulated device");
+        return 1;
+    }
+
+    memset(&i2cDriver, 0, sizeof(i2cDriver));
+    i2cDriver.handle = ariesHandle;
+    i2cDriver.slaveAddr = ariesSlaveAddress;
+    i2cDriver.pecEnable = ARIES_I2C_PEC_DISABLE;
+    i2cDriver.i2cFormat = ARIES_I2C_FORMAT_ASTERA;
+
+    memset(&ariesDevice, 0, sizeof(ariesDevice));
+    ariesDevice.i2cDriver = &i2cDriver;
+    ariesDevice.partNumber = ARIES_PTX16;
+
+    memset(&link, 0, sizeof(link));
+    link.device = &ariesDevice;
+    link.config.partNumber = ariesDevice.partNumber;
+    link.config.maxWidth = 16;
+
+    rc = ariesInitDevice(&ariesDevice, ariesSlaveAddress);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Init device failed: %d", rc);
+        closeI2CConnection(ariesHandle);
+        return 1;
+    }
+
+    ariesLTSSMDecoderInit(&decoder, ltssmDecodeTestFmts,
+        LTSSM_DECODE_TEST_NUM_FMTS, NULL, 0);
+    ariesLTSSMDecoderSetEvents(&decoder, events,
+        ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE);
+
+    // Wrap-around mode, log has not wrapped yet
+    rc = ariesLTSSMLoggerInit(&link, 0, ARIES_LTSSM_VERBOSITY_HIGH);
+    if (rc == ARIES_SUCCESS)
+    {
+        rc = ltssmDecodeTestWriteLog(&ariesDevice, msgOffsets);
+    }
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to write wrap-around log: %d", rc);
+        closeI2CConnection(ariesHandle);
+        return 1;
+    }
+    failures += ltssmDecodeTestRun("Wrap-around", &link, &decoder,
+        msgOffsets);
+
+    // One-batch mode, batch not full yet
+    rc = ariesLTSSMLoggerInit(&link, 1, ARIES_LTSSM_VERBOSITY_HIGH);
+    if (rc == ARIES_SUCCESS)
+    {
+        rc = ariesWriteBlockDataMainMicroIndirect(link.device->i2cDriver,
+            (ariesDevice.mm_print_info_struct_addr +
+            ARIES_PRINT_INFO_STRUCT_ONE_BATCH_WR_EN_OFFSET), 1,
+            &oneBatchWrEn);
+    }
+    if (rc == ARIES_SUCCESS)
+    {
+        rc = ltssmDecodeTestWriteLog(&ariesDevice, msgOffsets);
+    }
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to write one-batch log: %d", rc);
+        closeI2CConnection(ariesHandle);
+        return 1;
+    }
+    failures += ltssmDecodeTestRun("One-batch", &link, &decoder,
+        msgOffsets);
+
+    closeI2CConnection(ariesHandle);
+
+    if (failures > 0)
+    {
+        ASTERA_ERROR("%d LTSSM decode checks failed", failures);
+        return 1;
+    }
+    ASTERA_INFO("All LTSSM decode checks passed");
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file pec_bench.c
+ * @brief Micro-benchmark of SMBus PEC computation. Compares the table driven
+ * streaming PEC against a bit-serial reference (the previous implementation),
+ * for write and read frame sizes used by the SDK. No hardware is required.
+ *
+ * Usage: pec_bench [iterations]
+ */
+
+#include "../include/aries_api.h"
+
+#include <time.h>
+
+#define PEC_BENCH_SLAVE_ADDR 0x20
+#define PEC_BENCH_NUM_FRAMES 256
+#define PEC_BENCH_MAX_FRAME_LEN 40
+
+/** Frame lengths: read address write, 1/4 byte reads, 32 byte EEPROM write */
+static const int pecBenchFrameLens[] = {4, 2, 5, 36};
+
+static double pecBenchTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
+
+/*
+ * Bit-serial CRC-8 long division of a staged stream (reference)
+ */
+static uint8_t pecBenchBitSerial(
+        uint8_t* stream,
+        int length)
+{
+    uint8_t crc;
+    int byteIndex;
+    int bitIndex;
+    uint8_t poly = ARIES_CRC8_POLYNOMIAL >> 1;
+
+    crc = stream[0];
+    for (byteIndex = 1; byteIndex < length; byteIndex++)
+    {
+        uint8_t nextByte = stream[byteIndex];
+        for (bitIndex = 7; bitIndex >= 0; bitIndex--)
+        {
+            if (crc & 0x80)
+            {
+                crc = (crc ^ poly) << 1;
+                crc = crc + (((nextByte >> bitIndex) & 1) ^ 1);
+            }
+            else
+            {
+                crc = crc << 1;
+                crc = crc + ((nextByte >> bitIndex) & 1);
+            }
+        }
+    }
+    return crc;
+}
+
+/*
+ * Reference write PEC: stage address, cmd code and data, append 0x0
+ */
+static uint8_t pecBenchRefWritePec(
+        uint8_t cmdCode,
+        uint8_t* buf,
+        int length)
+{
+    uint8_t stream[PEC_BENCH_MAX_FRAME_LEN + 3];
+
+    stream[0] = (PEC_BENCH_SLAVE_ADDR << 1) + 0;
+    stream[1] = cmdCode;
+    memcpy(&stream[2], buf, length);
+    stream[(length+2)] = 0x0;
+    return pecBenchBitSerial(stream, (length+3));
+}
+
+int main(int argc, char* argv[])
+{
+    uint8_t frames[PEC_BENCH_NUM_FRAMES][PEC_BENCH_MAX_FRAME_LEN + 1];
+    uint8_t cmdCodes[PEC_BENCH_NUM_FRAMES];
+    int iterations = 10000;
+    int lenIndex;
+    int frame;
+    int iter;
+    int len;
+    int mismatches = 0;
+    volatile uint8_t sink = 0;
+    double startUs;
+    double refNs;
+    double tableNs;
+    double numFrames;
+
+    if (argc > 1)
+    {
+        iterations = atoi(argv[1]);
+        if (iterations < 1)
+        {
+            iterations = 1;
+        }
+    }
+
+    asteraLogSetLevel(1);
+
+    srand(1);
+    for (frame = 0; frame < PEC_BENCH_NUM_FRAMES; frame++)
+    {
+        cmdCodes[frame] = rand() & 0xff;
+        for (len = 0; len < PEC_BENCH_MAX_FRAME_LEN; len++)
+        {
+            frames[frame][len] = rand() & 0xff;
+        }
+    }
+
+    ASTERA_INFO("%-10s %14s %14s %10s", "frame len", "bit-serial (ns)",
+        "table (ns)", "speedup");
+
+    for (lenIndex = 0;
+        lenIndex < (int) (sizeof(pecBenchFrameLens) / sizeof(int));
+        lenIndex++)
+    {
+        len = pecBenchFrameLens[lenIndex];
+
+        // Check both implementations agree, and that a read check accepts
+        // the PEC generated for the same bytes
+        for (frame = 0; frame < PEC_BENCH_NUM_FRAMES; frame++)
+        {
+            uint8_t pec = ariesGetWritePecByte(PEC_BENCH_SLAVE_ADDR,
+                cmdCodes[frame], frames[frame], len);
+            if (pec != pecBenchRefWritePec(cmdCodes[frame], frames[frame],
+                len))
+            {
+                mismatches++;
+            }
+            frames[frame][len] = ariesPecUpdate(
+                ariesPecUpdateByte(ariesPecUpdateByte(ariesPecUpdateByte(0,
+                (PEC_BENCH_SLAVE_ADDR << 1)), cmdCodes[frame]),
+                ((PEC_BENCH_SLAVE_ADDR << 1) + 1)), frames[frame], len);
+            if (!ariesCheckReadPecByte(PEC_BENCH_SLAVE_ADDR, cmdCodes[frame],
+                frames[frame], (len+1)))
+            {
+                mismatches++;
+            }
+        }
+
+        numFrames = (double) iterations * PEC_BENCH_NUM_FRAMES;
+
+        startUs = pecBenchTimeUs();
+        for (iter = 0; iter < iterations; iter++)
+        {
+            for (frame = 0; frame < PEC_BENCH_NUM_FRAMES; frame++)
+            {
+                sink ^= pecBenchRefWritePec(cmdCodes[frame], frames[frame],
+                    len);
+            }
+        }
+        refNs = (pecBenchTimeUs() - startUs) * 1e3 / numFrames;
+
+        startUs = pecBenchTimeUs();
+        for (iter = 0; iter < iterations; iter++)
+        {
+            for (frame = 0; frame < PEC_BENCH_NUM_FRAMES; frame++)
+            {
+                sink ^= ariesGetWritePecByte(PEC_BENCH_SLAVE_ADDR,
+                    cmdCodes[frame], frames[frame], len);
+            }
+        }
+        tableNs = (pecBenchTimeUs() - startUs) * 1e3 / numFrames;
+
+        ASTERA_INFO("%-10d %14.1f %14.1f %9.1fx", len, refNs, tableNs,
+            refNs / tableNs);
+    }
+
+    if (mismatches != 0)
+    {
+        ASTERA_ERROR("PEC mismatches: %d", mismatches);
+        return ARIES_FAILURE;
+    }
+
+    return ARIES_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file shm_reader.c
+ * @brief Example application which prints the device and link state
+ * published in shared memory by the process owning the Retimers (e.g.
+ * link_example.c). The reader does not access the I2C bus.
+ *
+ * Usage: shm_reader [segmentName]
+ */
+
+#include "../include/aries_shm.h"
+
+#include <time.h>
+
+int main(int argc, char* argv[])
+{
+    AriesShmType shm;
+    AriesShmDeviceEntryType deviceEntry;
+    AriesShmLinkEntryType linkEntry;
+    AriesErrorType rc;
+    const char* name = ARIES_SHM_DEFAULT_NAME;
+    struct timespec ts;
+    uint64_t nowUs;
+    int index;
+
+    if (argc > 1)
+    {
+        name = argv[1];
+    }
+
+    asteraLogSetLevel(1);
+
+    rc = ariesShmReaderOpen(&shm, name);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    nowUs = ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+
+    for (index = 0; index < shm.numDevices; index++)
+    {
+        rc = ariesShmReadDevice(&shm, index, &deviceEntry);
+        if (rc != ARIES_SUCCESS)
+        {
+            ASTERA_ERROR("Device %d: no consistent snapshot", index);
+            continue;
+        }
+        if (deviceEntry.timestampUs == 0)
+        {
+            ASTERA_INFO("Device %d: not published yet", index);
+            continue;
+        }
+        ASTERA_INFO("Device %d: bus %d, FW %d.%d.%d, temp %.2f C (max %.2f C), okay %d, age %.1f s",
+            index, deviceEntry.device.i2cBus,
+            deviceEntry.device.fwVersion.major,
+            deviceEntry.device.fwVersion.minor,
+            deviceEntry.device.fwVersion.build,
+            deviceEntry.device.currentTempC, deviceEntry.device.maxTempC,
+            deviceEntry.device.deviceOkay,
+            (nowUs - deviceEntry.timestampUs) / 1e6);
+    }
+
+    for (index = 0; index < shm.numLinks; index++)
+    {
+        rc = ariesShmReadLink(&shm, index, &linkEntry);
+        if (rc != ARIES_SUCCESS)
+        {
+            ASTERA_ERROR("Link %d: no consistent snapshot", index);
+            continue;
+        }
+        if (linkEntry.timestampUs == 0)
+        {
+            ASTERA_INFO("Link %d: not published yet", index);
+            continue;
+        }
+        ASTERA_INFO("Link %d (device %d, link id %d): state %d, Gen%d x%d, min FoM 0x%02x (%s), recoveries %d, okay %d, age %.1f s",
+            index, linkEntry.deviceIndex, linkEntry.config.linkId,
+            linkEntry.state.state, linkEntry.state.rate,
+            linkEntry.state.curWidth, linkEntry.state.linkMinFoM,
+            linkEntry.state.linkMinFoMRx, linkEntry.state.recoveryCount,
+            linkEntry.state.linkOkay,
+            (nowUs - linkEntry.timestampUs) / 1e6);
+    }
+
+    ariesShmClose(&shm, false);
+
+    return ARIES_SUCCESS;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file sim_bench.c
+ * @brief Example application which runs common SDK APIs against the
+ * simulated Aries Retimer (examples/source/sim.c) and reports wall time and
+ * bus transaction counts per API. No hardware is required.
+ *
+ * Usage: sim_bench [latencyUs] [busyPolls] [pecEnable] [iterations]
+ */
+
+#include "../include/aries_api.h"
+#include "include/sim.h"
+
+#include <time.h>
+
+typedef enum SimBenchApi
+{
+    SIM_BENCH_INIT_DEVICE,
+    SIM_BENCH_CHECK_DEVICE_HEALTH,
+    SIM_BENCH_GET_CURRENT_TEMP,
+    SIM_BENCH_GET_LINK_STATE,
+    SIM_BENCH_CHECK_LINK_HEALTH,
+    SIM_BENCH_GET_LINK_STATE_DETAILED,
+    SIM_BENCH_NUM_APIS,
+} SimBenchApiType;
+
+static const char* simBenchApiNames[SIM_BENCH_NUM_APIS] = {
+    "ariesInitDevice",
+    "ariesCheckDeviceHealth",
+    "ariesGetCurrentTemp",
+    "ariesGetLinkState",
+    "ariesCheckLinkHealth",
+    "ariesGetLinkStateDetailed",
+};
+
+static double simBenchTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
+
+static AriesErrorType simBenchRun(
+        SimBenchApiType api,
+        AriesDeviceType* ariesDevice,
+        AriesLinkType* link,
+        int slaveAddress)
+{
+    switch (api)
+    {
+        case SIM_BENCH_INIT_DEVICE:
+            return ariesInitDevice(ariesDevice, slaveAddress);
+        case SIM_BENCH_CHECK_DEVICE_HEALTH:
+            return ariesCheckDeviceHealth(ariesDevice);
+        case SIM_BENCH_GET_CURRENT_TEMP:
+            return ariesGetCurrentTemp(ariesDevice);
+        case SIM_BENCH_GET_LINK_STATE:
+            return ariesGetLinkState(link);
+        case SIM_BENCH_CHECK_LINK_HEALTH:
+            return ariesCheckLinkHealth(link);
+        case SIM_BENCH_GET_LINK_STATE_DETAILED:
+            return ariesGetLinkStateDetailed(link);
+        default:
+            return ARIES_INVALID_ARGUMENT;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    AriesDeviceType* ariesDevice;
+    AriesI2CDriverType* i2cDriver;
+    AriesLinkType link;
+    AriesErrorType rc;
+    SimStatsType stats;
+    int ariesHandle;
+    int i2cBus = 0;
+    int ariesSlaveAddress = 0x20;
+    int latencyUs = 0;
+    int busyPolls = 0;
+    int pecEnable = ARIES_I2C_PEC_DISABLE;
+    int iterations = 1;
+    int api;
+    int iter;
+    double startUs;
+    double elapsedUs;
+
+    if (argc > 1)
+    {
+        latencyUs = atoi(argv[1]);
+    }
+    if (argc > 2)
+    {
+        busyPolls = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        pecEnable = atoi(argv[3]) ? ARIES_I2C_PEC_ENABLE :
+            ARIES_I2C_PEC_DISABLE;
+    }
+    if (argc > 4)
+    {
+        iterations = atoi(argv[4]);
+        if (iterations < 1)
+        {
+            iterations = 1;
+        }
+    }
+
+    asteraLogSetLevel(1);
+
+    ariesHandle = asteraI2COpenConnection(i2cBus, ariesSlaveAddress);
+    if (ariesHandle < 0)
+    {
+        ASTERA_ERROR("Failed to open simulated device");
+        return ARIES_I2C_OPEN_FAILURE;
+    }
+    simSetLatency(ariesHandle, latencyUs);
+    simSetBusyPolls(ariesHandle, busyPolls);
+
+    i2cDriver = (AriesI2CDriverType*) malloc(sizeof(AriesI2CDriverType));
+    i2cDriver->handle = ariesHandle;
+    i2cDriver->slaveAddr = ariesSlaveAddress;
+    i2cDriver->pecEnable = pecEnable;
+    i2cDriver->i2cFormat = ARIES_I2C_FORMAT_ASTERA;
+    i2cDriver->lockInit = 0;
+
+    ariesDevice = (AriesDeviceType*) malloc(sizeof(AriesDeviceType));
+    ariesDevice->i2cDriver = i2cDriver;
+    ariesDevice->i2cBus = i2cBus;
+    ariesDevice->partNumber = ARIES_PTX16;
+    ariesDevice->tempAlertThreshC = 110.0;
+    ariesDevice->tempWarnThreshC = 100.0;
+    ariesDevice->minLinkFoMAlert = 0x55;
+    ariesDevice->minDPLLFreqAlert = 2*1024;
+    ariesDevice->maxDPLLFreqAlert = 14*1024;
+
+    link.device = ariesDevice;
+    link.config.linkId = 0;
+    link.config.partNumber = ariesDevice->partNumber;
+    link.config.maxWidth = 16;
+    link.config.startLane = 0;
+
+    ASTERA_INFO("Simulated bus latency: %d us, busy polls: %d, PEC: %s",
+        latencyUs, busyPolls,
+        (pecEnable == ARIES_I2C_PEC_ENABLE) ? "enabled" : "disabled");
+    ASTERA_INFO("%-26s %12s %10s %10s %10s %10s", "API", "time (us)",
+        "writes", "reads", "bytes", "polls");
+
+    for (api = 0; api < SIM_BENCH_NUM_APIS; api++)
+    {
+        simClearStats(ariesHandle);
+        startUs = simBenchTimeUs();
+        for (iter = 0; iter < iterations; iter++)
+        {
+            rc = simBenchRun(api, ariesDevice, &link, ariesSlaveAddress);
+            if (rc != ARIES_SUCCESS)
+            {
+                ASTERA_ERROR("%s failed: %d", simBenchApiNames[api], rc);
+                closeI2CConnection(ariesHandle);
+                return rc;
+            }
+        }
+        elapsedUs = (simBenchTimeUs() - startUs) / iterations;
+        simGetStats(ariesHandle, &stats);
+
+        ASTERA_INFO("%-26s %12.1f %10.1f %10.1f %10.1f %10.1f",
+            simBenchApiNames[api], elapsedUs,
+            (double) stats.writeTransactions / iterations,
+            (double) stats.readTransactions / iterations,
+            (double) (stats.bytesWritten + stats.bytesRead) / iterations,
+            (double) stats.statusPolls / iterations);
+    }
+
+    ASTERA_INFO("FW Version: %d.%d.%d", ariesDevice->fwVersion.major,
+        ariesDevice->fwVersion.minor, ariesDevice->fwVersion.build);
+    ASTERA_INFO("Current Temp: %.2f C", ariesDevice->currentTempC);
+    ASTERA_INFO("Link 0: width %d, state %d, okay %d", link.state.width,
+        link.state.state, link.state.linkOkay);
+
+    closeI2CConnection(ariesHandle);
+
+    return ARIES_SUCCESS;
+}
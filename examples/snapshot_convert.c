@@ -0,0 +1,140 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file snapshot_convert.c
+ * @brief Example application which converts a binary link snapshot, written
+ * by ariesLinkWriteSnapshot(), to JSON or CSV on stdout, or prints a summary
+ * of it. The converter does not access the I2C bus, so it can run on any
+ * host the snapshot is copied to.
+ *
+ * Usage: snapshot_convert snapshotFile [json|csv|summary]
+ */
+
+#include "../include/aries_snapshot.h"
+
+#include <string.h>
+
+/*
+ * Print a summary of a snapshot, read in place from the mapping
+ */
+static AriesErrorType printSummary(
+        AriesSnapshotType* snapshot)
+{
+    const AriesSnapshotDeviceType* device;
+    const AriesSnapshotLinkType* link;
+    const AriesSnapshotLaneType* lane;
+    const uint8_t* data;
+    AriesErrorType rc;
+    int laneIndex;
+    int logIndex;
+    int logType;
+    int firstOffset;
+    int numBytes;
+
+    rc = ariesSnapshotGetDevice(snapshot, &device);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+    rc = ariesSnapshotGetLink(snapshot, &link);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    printf("Snapshot v%d.%d, SDK %s\n", snapshot->header->versionMajor,
+        snapshot->header->versionMinor, snapshot->header->sdkVersion);
+    printf("Device: bus %d addr 0x%02x, FW %d.%d.%d, temp %.2f C (max %.2f C), okay %d\n",
+        device->i2cBus, device->slaveAddr, device->fwVersionMajor,
+        device->fwVersionMinor, device->fwVersionBuild, device->currentTempC,
+        device->maxTempC, device->deviceOkay);
+    printf("Link %d: state %d, Gen%d x%d, min FoM 0x%02x (%s), recoveries %d, okay %d\n",
+        link->linkId, link->state, link->rate, link->curWidth,
+        link->linkMinFoM, link->linkMinFoMRx, link->recoveryCount,
+        link->linkOkay);
+
+    for (laneIndex = 0; laneIndex < snapshot->numLanes; laneIndex++)
+    {
+        rc = ariesSnapshotGetLane(snapshot, laneIndex, &lane);
+        if (rc != ARIES_SUCCESS)
+        {
+            return rc;
+        }
+        printf("Lane %2d (phy %2d): USPP Rx %-12s FoM preset %d/0x%02x, DSPP Rx %-12s FoM preset %d/0x%02x, Tj %.1f/%.1f C\n",
+            lane->laneIndex, lane->physicalLane, lane->usppRx.physicalPin,
+            lane->usppRx.lastPresetReq[0], lane->usppRx.lastPresetReqFom[0],
+            lane->dsppRx.physicalPin, lane->dsppRx.lastPresetReq[0],
+            lane->dsppRx.lastPresetReqFom[0], lane->usCore.tempC,
+            lane->dsCore.tempC);
+    }
+
+    for (logIndex = 0; logIndex < snapshot->numLogs; logIndex++)
+    {
+        ariesSnapshotGetLog(snapshot, logIndex, &logType, &firstOffset,
+            &data, &numBytes);
+        printf("Log %d: %d bytes from offset %d\n", logType, numBytes,
+            firstOffset);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+    AriesSnapshotType snapshot;
+    AriesErrorType rc;
+    const char* format = "json";
+
+    if (argc < 2)
+    {
+        printf("Usage: %s snapshotFile [json|csv|summary]\n", argv[0]);
+        return ARIES_INVALID_ARGUMENT;
+    }
+    if (argc > 2)
+    {
+        format = argv[2];
+    }
+
+    asteraLogSetLevel(1);
+
+    rc = ariesSnapshotOpen(&snapshot, argv[1]);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    if (strcmp(format, "json") == 0)
+    {
+        rc = ariesSnapshotWriteJson(&snapshot, stdout);
+    }
+    else if (strcmp(format, "csv") == 0)
+    {
+        rc = ariesSnapshotWriteCsv(&snapshot, stdout);
+    }
+    else if (strcmp(format, "summary") == 0)
+    {
+        rc = printSummary(&snapshot);
+    }
+    else
+    {
+        ASTERA_ERROR("Unknown output format %s", format);
+        rc = ARIES_INVALID_ARGUMENT;
+    }
+
+    ariesSnapshotClose(&snapshot);
+
+    return rc;
+}
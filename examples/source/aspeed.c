@@ -21,6 +21,9 @@
 
 #include "../include/aspeed.h"
 
+// Slave address set on each I2C handle, used to address I2C_RDWR messages
+static uint16_t aspeedSlaveAddress[ASPEED_MAX_I2C_FILES];
+
 int asteraI2COpenConnection(
         int i2cBus,
         int slaveAddress)
@@ -80,15 +83,109 @@ int asteraI2CReadBlockData(
     return i2c_smbus_read_i2c_block_data(handle, cmdCode, numBytes, buf);
 }
 
+/*
+ * Execute a list of SMBus block transactions with I2C_RDWR, so that they are
+ * sent with a repeated start between them rather than one syscall each
+ */
+int asteraI2CTransfer(
+        int handle,
+        AriesI2CTransactionType* txns,
+        int numTxns)
+{
+    struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+    struct i2c_rdwr_ioctl_data msgset;
+    uint8_t wrBufs[I2C_RDWR_IOCTL_MAX_MSGS][ASPEED_I2C_MAX_MSG_LEN];
+    uint16_t address;
+    int numMsgs;
+    int first;
+    int last;
+    int i;
+    int rc;
+
+    if ((handle < 0) || (handle >= ASPEED_MAX_I2C_FILES))
+    {
+        return -EINVAL;
+    }
+    address = aspeedSlaveAddress[handle];
+
+    first = 0;
+    while (first < numTxns)
+    {
+        // Fill up one ioctl. A block read takes two messages: command code
+        // write, then data read
+        numMsgs = 0;
+        last = first;
+        while ((last < numTxns) && ((numMsgs + 2) <= I2C_RDWR_IOCTL_MAX_MSGS))
+        {
+            msgs[numMsgs].addr = address;
+            msgs[numMsgs].flags = 0;
+            msgs[numMsgs].buf = wrBufs[numMsgs];
+            wrBufs[numMsgs][0] = txns[last].cmdCode;
+            if (txns[last].isRead)
+            {
+                msgs[numMsgs].len = 1;
+                numMsgs++;
+                msgs[numMsgs].addr = address;
+                msgs[numMsgs].flags = I2C_M_RD;
+                msgs[numMsgs].len = txns[last].bufLen;
+                msgs[numMsgs].buf = txns[last].buf;
+            }
+            else
+            {
+                memcpy(&wrBufs[numMsgs][1], txns[last].buf, txns[last].bufLen);
+                msgs[numMsgs].len = txns[last].bufLen + 1;
+            }
+            numMsgs++;
+            last++;
+        }
+
+        msgset.msgs = msgs;
+        msgset.nmsgs = numMsgs;
+        rc = ioctl(handle, I2C_RDWR, &msgset);
+        if (rc < 0)
+        {
+            rc = -errno;
+            for (i = first; i < numTxns; i++)
+            {
+                txns[i].rc = rc;
+            }
+            return rc;
+        }
+
+        for (i = first; i < last; i++)
+        {
+            txns[i].rc = txns[i].isRead ? txns[i].bufLen : 0;
+        }
+        first = last;
+    }
+
+    return 0;
+}
+
+/*
+ * Take an advisory lock on the I2C bus device, so that other processes (and
+ * other handles) using the SDK on this bus wait for the transactions to end
+ */
 int asteraI2CBlock(
         int handle)
 {
+    while (flock(handle, LOCK_EX) != 0)
+    {
+        if (errno != EINTR)
+        {
+            return -errno;
+        }
+    }
     return 0;    // Equivalent to ARIES_SUCCESS
 }
 
 int asteraI2CUnblock(
         int handle)
 {
+    if (flock(handle, LOCK_UN) != 0)
+    {
+        return -errno;
+    }
     return 0;    // Equivalent to ARIES_SUCCESS
 }
 
@@ -110,6 +207,10 @@ int setSlaveAddress(
                         address, strerror(errno));
                 return -errno;
         }
+        if ((file >= 0) && (file < ASPEED_MAX_I2C_FILES))
+        {
+                aspeedSlaveAddress[file] = address;
+        }
         return 0;
 }
 
@@ -0,0 +1,1428 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file sim.c
+ * @brief Implementation of an in-memory simulated Aries Retimer. Link this
+ * file in place of aspeed.c or rpi.c to run the SDK without hardware.
+ *
+ * The simulated device decodes the Astera and Intel SMBus framing (incl. PEC)
+ * and models:
+ *   - 128KB CSR space
+ *   - Main Micro indirect SRAM / PMA assist mailbox (0xd99)
+ *   - Path Micro indirect SRAM mailboxes (0x4200 + pathID*0x1000)
+ *   - PMA direct access registers (0x4400 + qs*0x4000)
+ *   - I2C Master EEPROM window (0xd04 - 0xd09) and a 256KB EEPROM
+ *   - Main Micro EEPROM assist (0x920)
+ * Every bus transaction can be given a fixed latency, and mailbox commands can
+ * be configured to stay busy for a number of status polls.
+ */
+
+#include "../include/sim.h"
+#include "../../include/aries_i2c.h"
+
+typedef struct SimPendingStatus
+{
+    bool active;
+    int address;
+    uint8_t doneValue;
+    int remaining;
+} SimPendingStatusType;
+
+typedef struct SimDevice
+{
+    bool inUse;
+    int refCount;
+    int i2cBus;
+    int slaveAddress;
+    int latencyUs;
+    int busyPolls;
+    uint8_t* csr;
+    uint8_t* mmSram;
+    uint8_t* pmSram;
+    uint16_t* pma;
+    uint8_t* eeprom;
+    uint8_t efuse[SIM_EFUSE_SIZE];
+    bool readPending;
+    uint8_t readFuncCode;
+    uint32_t readAddress;
+    int eepromPhase;
+    uint16_t eepromPtr;
+    int eepromBank;
+    int eepromWriteCycleUs;
+    uint64_t eepromBusyUntilUs;
+    bool i2cMstTxAbort;
+    SimPendingStatusType pending[SIM_MAX_PENDING_STATUS];
+    SimStatsType stats;
+} SimDeviceType;
+
+static SimDeviceType simDevices[SIM_MAX_DEVICES];
+static pthread_mutex_t simTableLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t simBusLock[SIM_MAX_BUSES];
+static pthread_once_t simBusLockOnce = PTHREAD_ONCE_INIT;
+
+static uint64_t simTimeUs(void);
+static void simInitBusLocks(void);
+static SimDeviceType* simGetDevice(int handle);
+static pthread_mutex_t* simGetBusLock(SimDeviceType* dev);
+static uint8_t simCrc8(uint8_t crc, uint8_t* buf, int len);
+static uint8_t simPec(SimDeviceType* dev, bool isRead, uint8_t cmdCode,
+        uint8_t* buf, int len);
+static void simPowerOn(SimDeviceType* dev);
+static void simSetStatus(SimDeviceType* dev, int address, uint8_t busyValue,
+        uint8_t doneValue);
+static void simCsrWrite(SimDeviceType* dev, uint32_t address, int numBytes,
+        uint8_t* values);
+static void simCsrRead(SimDeviceType* dev, uint32_t address, int numBytes,
+        uint8_t* values);
+static void simMainMicroMailbox(SimDeviceType* dev);
+static void simPathMicroMailbox(SimDeviceType* dev, int base, int pathID);
+static void simPmaDirect(SimDeviceType* dev, int quadSlice);
+static void simI2CMasterCmd(SimDeviceType* dev);
+static void simEepromAssist(SimDeviceType* dev);
+static uint16_t* simPmaReg(SimDeviceType* dev, int side, int quadSlice,
+        int address);
+
+/*
+ * Get monotonic timestamp in us
+ */
+static uint64_t simTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+/*
+ * Initialize the per-bus locks
+ */
+static void simInitBusLocks(void)
+{
+    int i;
+    for (i = 0; i < SIM_MAX_BUSES; i++)
+    {
+        pthread_mutex_init(&simBusLock[i], NULL);
+    }
+}
+
+/*
+ * Map a handle to a simulated device
+ */
+static SimDeviceType* simGetDevice(
+        int handle)
+{
+    if ((handle < 0) || (handle >= SIM_MAX_DEVICES))
+    {
+        return NULL;
+    }
+    if (!simDevices[handle].inUse)
+    {
+        return NULL;
+    }
+    return &simDevices[handle];
+}
+
+/*
+ * All devices on the same bus share one lock, so that transactions to
+ * different Retimers on a bus are serialized as they would be on the wire
+ */
+static pthread_mutex_t* simGetBusLock(
+        SimDeviceType* dev)
+{
+    return &simBusLock[dev->i2cBus % SIM_MAX_BUSES];
+}
+
+/*
+ * CRC-8 (x^8 + x^2 + x + 1) as used by SMBus PEC
+ */
+static uint8_t simCrc8(
+        uint8_t crc,
+        uint8_t* buf,
+        int len)
+{
+    int i;
+    int bit;
+    for (i = 0; i < len; i++)
+    {
+        crc ^= buf[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            if (crc & 0x80)
+            {
+                crc = (crc << 1) ^ 0x07;
+            }
+            else
+            {
+                crc = crc << 1;
+            }
+        }
+    }
+    return crc;
+}
+
+/*
+ * Compute PEC for a transaction (address and R/W bits included)
+ */
+static uint8_t simPec(
+        SimDeviceType* dev,
+        bool isRead,
+        uint8_t cmdCode,
+        uint8_t* buf,
+        int len)
+{
+    uint8_t hdr[3];
+    int hdrLen = 2;
+    hdr[0] = (dev->slaveAddress << 1);
+    hdr[1] = cmdCode;
+    if (isRead)
+    {
+        hdr[2] = (dev->slaveAddress << 1) + 1;
+        hdrLen = 3;
+    }
+    return simCrc8(simCrc8(0, hdr, hdrLen), buf, len);
+}
+
+/*
+ * Load power-on contents (FW running, link up in FWD state)
+ */
+static void simPowerOn(
+        SimDeviceType* dev)
+{
+    int i;
+    int side;
+    int qs;
+    int lane;
+    uint8_t dataWord[2];
+    uint32_t fwInfo = ARIES_MAIN_MICRO_FW_INFO;
+    uint32_t pmFwInfo = ARIES_PATH_MICRO_FW_INFO_ADDRESS;
+
+    memset(dev->csr, 0, SIM_CSR_SIZE);
+    memset(dev->mmSram, 0, SIM_SRAM_SIZE);
+    memset(dev->pmSram, 0, SIM_NUM_PATH_MICROS * SIM_SRAM_SIZE);
+    memset(dev->pma, 0,
+        2 * SIM_NUM_QUAD_SLICES * SIM_PMA_SIZE * sizeof(uint16_t));
+    memset(dev->eeprom, 0xff, ARIES_EEPROM_NUM_BYTES);
+    memset(dev->efuse, 0, SIM_EFUSE_SIZE);
+    memset(dev->pending, 0, sizeof(dev->pending));
+    dev->readPending = false;
+    dev->eepromPhase = 0;
+    dev->eepromPtr = 0;
+    dev->eepromBank = 0;
+    dev->eepromBusyUntilUs = 0;
+    dev->i2cMstTxAbort = false;
+
+    // All modules loaded
+    dev->csr[ARIES_CODE_LOAD_REG] = ARIES_LOAD_CODE;
+
+    // Rev number, device id and vendor id
+    dev->csr[0x4] = 0x1;
+    dev->csr[0x5] = 0x0;
+    dev->csr[0x6] = 0xfa;
+    dev->csr[0x7] = 0x1d;
+
+    // Temperature ADC codes
+    for (i = 0; i < 4; i++)
+    {
+        dev->csr[ARIES_CURRENT_TEMP_ADC_CSR + i] =
+            (SIM_CURRENT_TEMP_ADC_CODE >> (8*i)) & 0xff;
+        dev->csr[ARIES_MAX_TEMP_ADC_CSR + i] =
+            (SIM_MAX_TEMP_ADC_CODE >> (8*i)) & 0xff;
+    }
+
+    // Path micros in FWD state
+    for (i = 0; i < SIM_NUM_PATH_MICROS; i++)
+    {
+        dev->csr[ARIES_QS_0_CSR_OFFSET + (ARIES_PATH_WRAPPER_1_CSR_OFFSET * i)
+            + 0xb7] = 0x13;
+        dev->csr[0x4200 + (i*ARIES_PATH_WRP_STRIDE) + 0xb] = 1;
+    }
+
+    // eFuse chip ID
+    for (i = 0; i < 12; i++)
+    {
+        dev->efuse[i] = 0xa0 + i;
+    }
+
+    // Main Micro FW info
+    dev->mmSram[fwInfo + ARIES_MM_FW_VERSION_MAJOR] = SIM_FW_VERSION_MAJOR;
+    dev->mmSram[fwInfo + ARIES_MM_FW_VERSION_MINOR] = SIM_FW_VERSION_MINOR;
+    dev->mmSram[fwInfo + ARIES_MM_FW_VERSION_BUILD] = SIM_FW_VERSION_BUILD & 0xff;
+    dev->mmSram[fwInfo + ARIES_MM_FW_VERSION_BUILD + 1] =
+        (SIM_FW_VERSION_BUILD >> 8) & 0xff;
+    dev->mmSram[fwInfo + ARIES_MM_AL_PRINT_INFO_STRUCT_ADDR] =
+        SIM_MM_PRINT_INFO_OFFSET & 0xff;
+    dev->mmSram[fwInfo + ARIES_MM_AL_PRINT_INFO_STRUCT_ADDR + 1] =
+        (SIM_MM_PRINT_INFO_OFFSET >> 8) & 0xff;
+    dev->mmSram[fwInfo + ARIES_MM_GP_CTRL_STS_STRUCT_ADDR] =
+        SIM_MM_GP_CTRL_STS_OFFSET & 0xff;
+    dev->mmSram[fwInfo + ARIES_MM_GP_CTRL_STS_STRUCT_ADDR + 1] =
+        (SIM_MM_GP_CTRL_STS_OFFSET >> 8) & 0xff;
+    dev->mmSram[ARIES_LINK_PATH_STRUCT_SIZE_ADDR] = ARIES_LINK_PATH_STRUCT_SIZE;
+
+    for (i = 0; i < SIM_MAX_LINKS; i++)
+    {
+        int linkStructAddr = SIM_MM_LINK_STRUCT_OFFSET +
+            (i*SIM_MM_LINK_STRUCT_STRIDE);
+        dev->mmSram[fwInfo + ARIES_MM_LINK_STRUCT_ADDR_OFFSET +
+            (i*ARIES_LINK_ADDR_EL_SIZE)] = linkStructAddr & 0xff;
+        dev->mmSram[fwInfo + ARIES_MM_LINK_STRUCT_ADDR_OFFSET +
+            (i*ARIES_LINK_ADDR_EL_SIZE) + 1] = (linkStructAddr >> 8) & 0xff;
+    }
+
+    // Path Micro FW info (same for all path micros)
+    for (i = 0; i < SIM_NUM_PATH_MICROS; i++)
+    {
+        uint8_t* sram = dev->pmSram + (i*SIM_SRAM_SIZE);
+        sram[pmFwInfo + ARIES_PM_AL_PRINT_INFO_STRUCT_ADDR] =
+            SIM_PM_PRINT_INFO_OFFSET & 0xff;
+        sram[pmFwInfo + ARIES_PM_AL_PRINT_INFO_STRUCT_ADDR + 1] =
+            (SIM_PM_PRINT_INFO_OFFSET >> 8) & 0xff;
+        sram[pmFwInfo + ARIES_PM_GP_CTRL_STS_STRUCT_ADDR] =
+            SIM_PM_GP_CTRL_STS_OFFSET & 0xff;
+        sram[pmFwInfo + ARIES_PM_GP_CTRL_STS_STRUCT_ADDR + 1] =
+            (SIM_PM_GP_CTRL_STS_OFFSET >> 8) & 0xff;
+    }
+
+    // PMA lane registers
+    for (side = 0; side < 2; side++)
+    {
+        for (qs = 0; qs < SIM_NUM_QUAD_SLICES; qs++)
+        {
+            for (lane = 0; lane < 4; lane++)
+            {
+                *simPmaReg(dev, side, qs, ARIES_PMA_LANE_DIG_RX_DPLL_FREQ +
+                    (lane*ARIES_PMA_LANE_STRIDE)) = SIM_DPLL_FREQ_CODE;
+                *simPmaReg(dev, side, qs,
+                    ARIES_PMA_RAWLANE_DIG_PCS_XF_RX_ADAPT_FOM +
+                    (lane*ARIES_PMA_LANE_STRIDE)) = SIM_RX_ADAPT_FOM;
+            }
+        }
+    }
+
+    // Default link state: x16 in FWD at Gen5 on link 0
+    dataWord[0] = 16;
+    dataWord[1] = ARIES_STATE_FWD;
+    for (i = 0; i < SIM_MAX_LINKS; i++)
+    {
+        int linkBase = AL_MAIN_SRAM_DMEM_OFFSET + SIM_MM_LINK_STRUCT_OFFSET +
+            (i*SIM_MM_LINK_STRUCT_STRIDE) + (ARIES_LINK_PATH_STRUCT_SIZE*2);
+        dev->mmSram[linkBase + ARIES_LINK_STRUCT_WIDTH_OFFSET] = dataWord[0];
+        dev->mmSram[linkBase + ARIES_LINK_STRUCT_STATE_OFFSET] = dataWord[1];
+        dev->mmSram[linkBase + ARIES_LINK_STRUCT_RATE_OFFSET] = 4;
+    }
+}
+
+/*
+ * Return PMA register storage for a side, quad slice and address
+ */
+static uint16_t* simPmaReg(
+        SimDeviceType* dev,
+        int side,
+        int quadSlice,
+        int address)
+{
+    int idx = (((side & 1) * SIM_NUM_QUAD_SLICES) +
+        (quadSlice % SIM_NUM_QUAD_SLICES)) * SIM_PMA_SIZE;
+    return &dev->pma[idx + (address & (SIM_PMA_SIZE-1))];
+}
+
+/*
+ * Complete a mailbox command, optionally after a number of busy status polls
+ */
+static void simSetStatus(
+        SimDeviceType* dev,
+        int address,
+        uint8_t busyValue,
+        uint8_t doneValue)
+{
+    int i;
+    int freeSlot = -1;
+
+    dev->stats.mailboxCommands++;
+
+    if (dev->busyPolls <= 0)
+    {
+        dev->csr[address] = doneValue;
+        return;
+    }
+
+    for (i = 0; i < SIM_MAX_PENDING_STATUS; i++)
+    {
+        if (dev->pending[i].active && (dev->pending[i].address == address))
+        {
+            freeSlot = i;
+            break;
+        }
+        if (!dev->pending[i].active && (freeSlot < 0))
+        {
+            freeSlot = i;
+        }
+    }
+
+    if (freeSlot < 0)
+    {
+        dev->csr[address] = doneValue;
+        return;
+    }
+
+    dev->csr[address] = busyValue;
+    dev->pending[freeSlot].active = true;
+    dev->pending[freeSlot].address = address;
+    dev->pending[freeSlot].doneValue = doneValue;
+    dev->pending[freeSlot].remaining = dev->busyPolls;
+}
+
+/*
+ * Write CSRs and apply side effects of the write
+ */
+static void simCsrWrite(
+        SimDeviceType* dev,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values)
+{
+    int i;
+    int addr;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        dev->csr[(address + i) & (SIM_CSR_SIZE-1)] = values[i];
+    }
+
+    for (i = 0; i < numBytes; i++)
+    {
+        addr = (address + i) & (SIM_CSR_SIZE-1);
+
+        if (addr == ARIES_PMA_MM_ASSIST_CMD_OFFSET)
+        {
+            simMainMicroMailbox(dev);
+        }
+        else if (addr == ARIES_MM_EEPROM_ASSIST_CMD_ADDR)
+        {
+            if (dev->csr[addr] != 0)
+            {
+                simEepromAssist(dev);
+            }
+        }
+        else if (addr == ARIES_I2C_MST_CMD_ADDR)
+        {
+            if (dev->csr[addr] == 1)
+            {
+                simI2CMasterCmd(dev);
+            }
+        }
+        else if ((addr >= 0x4200) &&
+            (addr < (0x4200 + (SIM_NUM_PATH_MICROS*ARIES_PATH_WRP_STRIDE))) &&
+            (((addr - 0x4200) % ARIES_PATH_WRP_STRIDE) == 2))
+        {
+            // Writing address lower byte triggers the indirect access
+            simPathMicroMailbox(dev, addr - 2,
+                (addr - 0x4200) / ARIES_PATH_WRP_STRIDE);
+        }
+        else if ((addr >= ARIES_PMA_QS0_CMD_ADDRESS) &&
+            (addr < (ARIES_PMA_QS0_CMD_ADDRESS +
+                (SIM_NUM_QUAD_SLICES*ARIES_QS_STRIDE))) &&
+            (((addr - ARIES_PMA_QS0_CMD_ADDRESS) % ARIES_QS_STRIDE) ==
+                (ARIES_PMA_QS0_ADDR_0_ADDRESS - ARIES_PMA_QS0_CMD_ADDRESS)))
+        {
+            simPmaDirect(dev, (addr - ARIES_PMA_QS0_CMD_ADDRESS) /
+                ARIES_QS_STRIDE);
+        }
+    }
+}
+
+/*
+ * Read CSRs and apply side effects of the read
+ */
+static void simCsrRead(
+        SimDeviceType* dev,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values)
+{
+    int i;
+    int p;
+    int addr;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        addr = (address + i) & (SIM_CSR_SIZE-1);
+
+        if (addr == SIM_EFUSE_DATA_CSR)
+        {
+            values[i] = dev->efuse[dev->csr[SIM_EFUSE_ADDR_CSR] %
+                SIM_EFUSE_SIZE];
+            continue;
+        }
+
+        values[i] = dev->csr[addr];
+
+        if (addr == ARIES_MM_HEARTBEAT_ADDR)
+        {
+            dev->csr[addr]++;
+        }
+
+        for (p = 0; p < SIM_MAX_PENDING_STATUS; p++)
+        {
+            if (dev->pending[p].active && (dev->pending[p].address == addr))
+            {
+                dev->stats.statusPolls++;
+                dev->pending[p].remaining--;
+                if (dev->pending[p].remaining <= 0)
+                {
+                    dev->csr[addr] = dev->pending[p].doneValue;
+                    dev->pending[p].active = false;
+                }
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * Main Micro mailbox at 0xd99: indirect SRAM access and PMA assist
+ */
+static void simMainMicroMailbox(
+        SimDeviceType* dev)
+{
+    int base = ARIES_PMA_MM_ASSIST_REG_ADDR_OFFSET;
+    uint8_t cmd = dev->csr[ARIES_PMA_MM_ASSIST_CMD_OFFSET];
+    uint32_t addr = dev->csr[base] + (dev->csr[base+1] << 8) +
+        (dev->csr[base+2] << 16);
+    int quadSlice = (addr >> 22) & 0x3;
+    uint16_t* reg;
+    uint16_t value;
+
+    switch (cmd)
+    {
+        case AL_TG_RD_LOC_IND_SRAM:
+            dev->csr[base+3] = dev->mmSram[(addr + AL_MAIN_SRAM_DMEM_OFFSET) &
+                (SIM_SRAM_SIZE-1)];
+            break;
+        case AL_TG_WR_LOC_IND_SRAM:
+            dev->mmSram[(addr + AL_MAIN_SRAM_DMEM_OFFSET) &
+                (SIM_SRAM_SIZE-1)] = dev->csr[base+3];
+            break;
+        case ARIES_RD_PID_IND_PMA0:
+        case ARIES_RD_PID_IND_PMA1:
+            reg = simPmaReg(dev, cmd - ARIES_RD_PID_IND_PMA0, quadSlice,
+                addr & 0xffff);
+            dev->csr[ARIES_PMA_MM_ASSIST_DATA0_OFFSET] = *reg & 0xff;
+            dev->csr[ARIES_PMA_MM_ASSIST_DATA1_OFFSET] = (*reg >> 8) & 0xff;
+            break;
+        case ARIES_WR_PID_IND_PMA0:
+        case ARIES_WR_PID_IND_PMA1:
+        case ARIES_WR_PID_IND_PMAX:
+            value = dev->csr[ARIES_PMA_MM_ASSIST_DATA0_OFFSET] +
+                (dev->csr[ARIES_PMA_MM_ASSIST_DATA1_OFFSET] << 8);
+            if (cmd != ARIES_WR_PID_IND_PMA1)
+            {
+                *simPmaReg(dev, 0, quadSlice, addr & 0xffff) = value;
+            }
+            if (cmd != ARIES_WR_PID_IND_PMA0)
+            {
+                *simPmaReg(dev, 1, quadSlice, addr & 0xffff) = value;
+            }
+            break;
+        default:
+            dev->stats.framingErrors++;
+            break;
+    }
+
+    simSetStatus(dev, ARIES_PMA_MM_ASSIST_CMD_OFFSET, 0x1, 0x0);
+}
+
+/*
+ * Path Micro mailbox: indirect SRAM access of up to 4 bytes
+ */
+static void simPathMicroMailbox(
+        SimDeviceType* dev,
+        int base,
+        int pathID)
+{
+    uint8_t cmd = dev->csr[base];
+    int numBytes = ((cmd >> 5) & 0x7) + 1;
+    bool isWrite = cmd & 0x1;
+    uint32_t addr = (((cmd >> 1) & 0x1) << 16) + (dev->csr[base+1] << 8) +
+        dev->csr[base+2];
+    uint8_t* sram = dev->pmSram + (pathID*SIM_SRAM_SIZE);
+    int i;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        if (isWrite)
+        {
+            sram[(addr + i) & (SIM_SRAM_SIZE-1)] = dev->csr[base+3+i];
+        }
+        else
+        {
+            dev->csr[base+3+i] = sram[(addr + i) & (SIM_SRAM_SIZE-1)];
+        }
+    }
+
+    simSetStatus(dev, base + 0xb, 0x0, 0x1);
+}
+
+/*
+ * PMA direct access, triggered by writing address lower byte
+ */
+static void simPmaDirect(
+        SimDeviceType* dev,
+        int quadSlice)
+{
+    int offset = quadSlice*ARIES_QS_STRIDE;
+    uint8_t cmd = dev->csr[ARIES_PMA_QS0_CMD_ADDRESS + offset];
+    int sides = (cmd >> 1) & 0x3;
+    int addr = (dev->csr[ARIES_PMA_QS0_ADDR_1_ADDRESS + offset] << 8) +
+        dev->csr[ARIES_PMA_QS0_ADDR_0_ADDRESS + offset];
+    uint16_t value;
+    uint16_t* reg;
+
+    if (cmd & 0x1)
+    {
+        value = dev->csr[ARIES_PMA_QS0_DATA_0_ADDRESS + offset] +
+            (dev->csr[ARIES_PMA_QS0_DATA_1_ADDRESS + offset] << 8);
+        if (sides & 0x1)
+        {
+            *simPmaReg(dev, 0, quadSlice, addr) = value;
+        }
+        if (sides & 0x2)
+        {
+            *simPmaReg(dev, 1, quadSlice, addr) = value;
+        }
+    }
+    else
+    {
+        reg = simPmaReg(dev, (sides & 0x1) ? 0 : 1, quadSlice, addr);
+        dev->csr[ARIES_PMA_QS0_DATA_0_ADDRESS + offset] = *reg & 0xff;
+        dev->csr[ARIES_PMA_QS0_DATA_1_ADDRESS + offset] = (*reg >> 8) & 0xff;
+    }
+}
+
+/*
+ * I2C Master command: write to an IP register, or send/receive a byte
+ * to/from the EEPROM
+ */
+static void simI2CMasterCmd(
+        SimDeviceType* dev)
+{
+    uint8_t reg = dev->csr[ARIES_I2C_MST_IC_CMD_ADDR];
+    uint8_t data0 = dev->csr[ARIES_I2C_MST_DATA0_ADDR];
+    uint8_t flags = dev->csr[ARIES_I2C_MST_DATA1_ADDR];
+    int eepromAddr;
+    bool wroteData = false;
+
+    if (reg != SIM_I2C_MST_IC_DATA_CMD)
+    {
+        if (reg == SIM_I2C_MST_IC_TAR)
+        {
+            dev->eepromBank = data0 & 0x3;
+        }
+        else if ((reg == SIM_I2C_MST_IC_ENABLE) && (data0 == 0))
+        {
+            // Disabling the I2C Master also clears a TX abort
+            dev->eepromPhase = 0;
+            dev->i2cMstTxAbort = false;
+        }
+        return;
+    }
+
+    // TX FIFO is flushed until the abort is cleared
+    if (dev->i2cMstTxAbort)
+    {
+        dev->stats.i2cMstDropped++;
+        return;
+    }
+
+    // EEPROM does not acknowledge accesses during its write cycle, which
+    // aborts the transfer
+    if (simTimeUs() < dev->eepromBusyUntilUs)
+    {
+        dev->stats.eepromNacks++;
+        dev->i2cMstTxAbort = true;
+        return;
+    }
+
+    if (flags & SIM_I2C_MST_FLAG_RESTART)
+    {
+        dev->eepromPhase = 0;
+    }
+
+    eepromAddr = (dev->eepromBank * ARIES_EEPROM_BANK_SIZE) + dev->eepromPtr;
+    if (flags & SIM_I2C_MST_FLAG_READ)
+    {
+        dev->csr[ARIES_I2C_MST_DATA0_ADDR] = dev->eeprom[eepromAddr];
+        dev->eepromPtr++;
+        dev->stats.eepromBytesRead++;
+    }
+    else if (dev->eepromPhase == 0)
+    {
+        dev->eepromPtr = data0 << 8;
+        dev->eepromPhase = 1;
+    }
+    else if (dev->eepromPhase == 1)
+    {
+        dev->eepromPtr |= data0;
+        dev->eepromPhase = 2;
+    }
+    else
+    {
+        dev->eeprom[eepromAddr] = data0;
+        dev->eepromPtr++;
+        dev->stats.eepromBytesWritten++;
+        wroteData = true;
+    }
+
+    if (flags & SIM_I2C_MST_FLAG_STOP)
+    {
+        // Data written in this transaction is programmed on stop
+        if (wroteData)
+        {
+            dev->eepromBusyUntilUs = simTimeUs() + dev->eepromWriteCycleUs;
+        }
+        dev->eepromPhase = 0;
+    }
+}
+
+/*
+ * Main Micro EEPROM assist: block read/write and bank checksum
+ */
+static void simEepromAssist(
+        SimDeviceType* dev)
+{
+    uint8_t cmd = dev->csr[ARIES_MM_EEPROM_ASSIST_CMD_ADDR];
+    bool noWide = cmd & ARIES_EEPROM_BLOCK_CMD_MODIFIER_NOWIDE;
+    uint8_t code = cmd & ~ARIES_EEPROM_BLOCK_CMD_MODIFIER_NOWIDE;
+    int blockSize = ARIES_EEPROM_BLOCK_WRITE_SIZE_WIDE;
+    int base = ARIES_EEPROM_BLOCK_BASE_ADDR_WIDE;
+    int bankBase = dev->eepromBank * ARIES_EEPROM_BANK_SIZE;
+    uint32_t checksum;
+    int numBytes;
+    int i;
+
+    if (noWide)
+    {
+        blockSize = ARIES_EEPROM_BLOCK_WRITE_SIZE_NOWIDE;
+        base = ARIES_EEPROM_BLOCK_BASE_ADDR_NOWIDE;
+    }
+
+    if ((simTimeUs() < dev->eepromBusyUntilUs) &&
+        (code >= ARIES_MM_EEPROM_WRITE_REG_CODE) &&
+        (code <= ARIES_MM_EEPROM_READ_REG_CODE))
+    {
+        // Dropped, EEPROM is in its write cycle. The status is left set, so
+        // the command is reported as failed
+        dev->stats.eepromNacks++;
+        return;
+    }
+
+    switch (code)
+    {
+        case ARIES_MM_EEPROM_WRITE_REG_CODE:
+        case ARIES_MM_EEPROM_WRITE_END_CODE:
+            for (i = 0; i < blockSize; i++)
+            {
+                dev->eeprom[bankBase + dev->eepromPtr] = dev->csr[base + i];
+                dev->eepromPtr++;
+            }
+            dev->stats.eepromBytesWritten += blockSize;
+            if (code == ARIES_MM_EEPROM_WRITE_END_CODE)
+            {
+                dev->eepromPhase = 0;
+                dev->eepromBusyUntilUs = simTimeUs() + dev->eepromWriteCycleUs;
+            }
+            break;
+        case ARIES_MM_EEPROM_READ_REG_CODE:
+        case ARIES_MM_EEPROM_READ_END_CODE:
+            for (i = 0; i < blockSize; i++)
+            {
+                dev->csr[base + i] = dev->eeprom[bankBase + dev->eepromPtr];
+                dev->eepromPtr++;
+            }
+            dev->stats.eepromBytesRead += blockSize;
+            if (code == ARIES_MM_EEPROM_READ_END_CODE)
+            {
+                dev->eepromPhase = 0;
+            }
+            break;
+        case ARIES_MM_EEPROM_CHECKSUM_CODE:
+        case ARIES_MM_EEPROM_CHECKSUM_PARTIAL_CODE:
+            numBytes = ARIES_EEPROM_BANK_SIZE;
+            if (code == ARIES_MM_EEPROM_CHECKSUM_PARTIAL_CODE)
+            {
+                numBytes = dev->csr[base] + (dev->csr[base+1] << 8);
+            }
+            checksum = 0;
+            for (i = 0; i < numBytes; i++)
+            {
+                checksum += dev->eeprom[bankBase + i];
+            }
+            dev->stats.eepromBytesRead += numBytes;
+            for (i = 0; i < ARIES_EEPROM_MM_BLOCK_CHECKSUM_WRITE_SIZE; i++)
+            {
+                dev->csr[base + i] = (i < 4) ? ((checksum >> (8*i)) & 0xff) : 0;
+            }
+            break;
+        default:
+            dev->stats.framingErrors++;
+            break;
+    }
+
+    simSetStatus(dev, ARIES_MM_EEPROM_ASSIST_CMD_ADDR, cmd, 0x0);
+}
+
+/*
+ * Open a connection to a simulated Retimer. One device is created per bus and
+ * slave address pair; opening the same pair again returns the same handle.
+ */
+int asteraI2COpenConnection(
+        int i2cBus,
+        int slaveAddress)
+{
+    SimDeviceType* dev;
+    int handle = -1;
+    int i;
+
+    pthread_once(&simBusLockOnce, simInitBusLocks);
+    pthread_mutex_lock(&simTableLock);
+
+    for (i = 0; i < SIM_MAX_DEVICES; i++)
+    {
+        if (simDevices[i].inUse && (simDevices[i].i2cBus == i2cBus) &&
+            (simDevices[i].slaveAddress == slaveAddress))
+        {
+            simDevices[i].refCount++;
+            pthread_mutex_unlock(&simTableLock);
+            return i;
+        }
+        if (!simDevices[i].inUse && (handle < 0))
+        {
+            handle = i;
+        }
+    }
+
+    if (handle < 0)
+    {
+        fprintf(stderr, "Error: No free simulated device slots\n");
+        pthread_mutex_unlock(&simTableLock);
+        return -1;
+    }
+
+    dev = &simDevices[handle];
+    memset(dev, 0, sizeof(SimDeviceType));
+    dev->csr = (uint8_t*) malloc(SIM_CSR_SIZE);
+    dev->mmSram = (uint8_t*) malloc(SIM_SRAM_SIZE);
+    dev->pmSram = (uint8_t*) malloc(SIM_NUM_PATH_MICROS * SIM_SRAM_SIZE);
+    dev->pma = (uint16_t*) malloc(2 * SIM_NUM_QUAD_SLICES * SIM_PMA_SIZE *
+        sizeof(uint16_t));
+    dev->eeprom = (uint8_t*) malloc(ARIES_EEPROM_NUM_BYTES);
+    if ((dev->csr == NULL) || (dev->mmSram == NULL) || (dev->pmSram == NULL)
+        || (dev->pma == NULL) || (dev->eeprom == NULL))
+    {
+        fprintf(stderr, "Error: Could not allocate simulated device\n");
+        free(dev->csr);
+        free(dev->mmSram);
+        free(dev->pmSram);
+        free(dev->pma);
+        free(dev->eeprom);
+        pthread_mutex_unlock(&simTableLock);
+        return -1;
+    }
+
+    dev->i2cBus = i2cBus;
+    dev->slaveAddress = slaveAddress;
+    dev->refCount = 1;
+    dev->inUse = true;
+    simPowerOn(dev);
+
+    pthread_mutex_unlock(&simTableLock);
+    return handle;
+}
+
+/*
+ * Charge the simulated latency of one call into the low-level I2C methods
+ */
+static void simBusDelay(
+        SimDeviceType* dev)
+{
+    if (dev->latencyUs > 0)
+    {
+        usleep(dev->latencyUs);
+    }
+}
+
+/*
+ * Decode and execute a write transaction. Caller holds the bus lock
+ */
+static int simExecWrite(
+        SimDeviceType* dev,
+        uint8_t cmdCode,
+        uint8_t bufLen,
+        uint8_t* buf)
+{
+    uint8_t pecEn = (cmdCode >> 7) & 0x1;
+    uint8_t funcCode = (cmdCode >> 2) & 0x7;
+    uint8_t start = (cmdCode >> 1) & 0x1;
+    uint8_t end = cmdCode & 0x1;
+    int len;
+    int numBytes;
+    uint32_t address;
+    int rc = 0;
+
+    dev->stats.writeTransactions++;
+    dev->stats.bytesWritten += bufLen + 1;
+
+    len = bufLen - pecEn;
+    if ((len < 1) || (pecEn &&
+        (simPec(dev, false, cmdCode, buf, len) != buf[len])))
+    {
+        dev->stats.pecErrors++;
+        return -1;
+    }
+
+    switch (funcCode)
+    {
+        case 3: // Astera format write
+            numBytes = buf[0] - 3;
+            if (!start || !end || (numBytes < 1) || ((numBytes + 4) > len))
+            {
+                rc = -1;
+                break;
+            }
+            address = ((buf[1] & 0x1) << 16) + (buf[2] << 8) + buf[3];
+            simCsrWrite(dev, address, numBytes, &buf[4]);
+            break;
+        case 2: // Astera format read (address phase)
+        case 0: // Intel format read (address phase)
+            if (!start || end || (len < 3))
+            {
+                rc = -1;
+                break;
+            }
+            if (funcCode == 2)
+            {
+                address = ((buf[1] & 0x1) << 16) + (buf[2] << 8) + buf[3];
+            }
+            else
+            {
+                address = buf[1] + (buf[2] << 8);
+            }
+            dev->readPending = true;
+            dev->readFuncCode = funcCode;
+            dev->readAddress = address;
+            break;
+        case 1: // Intel format write
+            numBytes = buf[0] - 2 - pecEn;
+            if (!start || !end || (numBytes < 1) || ((numBytes + 3) > len))
+            {
+                rc = -1;
+                break;
+            }
+            address = buf[1] + (buf[2] << 8);
+            simCsrWrite(dev, address, numBytes, &buf[3]);
+            break;
+        default:
+            rc = -1;
+            break;
+    }
+
+    if (rc != 0)
+    {
+        dev->stats.framingErrors++;
+    }
+
+    return rc;
+}
+
+/*
+ * Execute a read transaction. Returns number of bytes read. Caller holds the
+ * bus lock
+ */
+static int simExecRead(
+        SimDeviceType* dev,
+        uint8_t cmdCode,
+        uint8_t bufLen,
+        uint8_t* buf)
+{
+    uint8_t pecEn = (cmdCode >> 7) & 0x1;
+    uint8_t funcCode = (cmdCode >> 2) & 0x7;
+    int len = bufLen - pecEn;
+    int numBytes;
+
+    dev->stats.readTransactions++;
+
+    if (!dev->readPending || (funcCode != dev->readFuncCode) || (len < 2))
+    {
+        dev->stats.framingErrors++;
+        return -1;
+    }
+    dev->readPending = false;
+
+    if (funcCode == 2)
+    {
+        // Byte count, followed by data
+        numBytes = len - 1;
+        buf[0] = numBytes;
+        simCsrRead(dev, dev->readAddress, numBytes, &buf[1]);
+    }
+    else
+    {
+        // Byte count, 2 address bytes, followed by 4 data bytes
+        if (len < 7)
+        {
+            dev->stats.framingErrors++;
+            return -1;
+        }
+        buf[0] = 4;
+        buf[1] = dev->readAddress & 0xff;
+        buf[2] = (dev->readAddress >> 8) & 0xff;
+        simCsrRead(dev, dev->readAddress, 4, &buf[3]);
+    }
+
+    if (pecEn)
+    {
+        buf[len] = simPec(dev, true, cmdCode, buf, len);
+    }
+
+    dev->stats.bytesRead += bufLen;
+
+    return bufLen;
+}
+
+/*
+ * Execute a write transaction
+ */
+int asteraI2CWriteBlockData(
+        int handle,
+        uint8_t cmdCode,
+        uint8_t bufLen,
+        uint8_t* buf)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    int rc;
+
+    if (dev == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(simGetBusLock(dev));
+    simBusDelay(dev);
+    rc = simExecWrite(dev, cmdCode, bufLen, buf);
+    pthread_mutex_unlock(simGetBusLock(dev));
+
+    return rc;
+}
+
+/*
+ * Execute a read transaction. Returns number of bytes read.
+ */
+int asteraI2CReadBlockData(
+        int handle,
+        uint8_t cmdCode,
+        uint8_t bufLen,
+        uint8_t* buf)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    int rc;
+
+    if (dev == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(simGetBusLock(dev));
+    simBusDelay(dev);
+    rc = simExecRead(dev, cmdCode, bufLen, buf);
+    pthread_mutex_unlock(simGetBusLock(dev));
+
+    return rc;
+}
+
+/*
+ * Execute a list of transactions as one bus transfer (repeated start between
+ * transactions). Latency is charged once for the whole transfer
+ */
+int asteraI2CTransfer(
+        int handle,
+        AriesI2CTransactionType* txns,
+        int numTxns)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    int rc = 0;
+    int i;
+
+    if (dev == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(simGetBusLock(dev));
+    simBusDelay(dev);
+    dev->stats.transfers++;
+
+    for (i = 0; i < numTxns; i++)
+    {
+        // A failed transaction aborts the rest of the transfer
+        if (rc != 0)
+        {
+            txns[i].rc = -1;
+            continue;
+        }
+        if (txns[i].isRead)
+        {
+            txns[i].rc = simExecRead(dev, txns[i].cmdCode, txns[i].bufLen,
+                txns[i].buf);
+            if (txns[i].rc != txns[i].bufLen)
+            {
+                rc = -1;
+            }
+        }
+        else
+        {
+            txns[i].rc = simExecWrite(dev, txns[i].cmdCode, txns[i].bufLen,
+                txns[i].buf);
+            if (txns[i].rc != 0)
+            {
+                rc = -1;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(simGetBusLock(dev));
+
+    return rc;
+}
+
+int asteraI2CBlock(
+        int handle)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    dev->stats.blockCalls++;
+    return 0;    // Equivalent to ARIES_SUCCESS
+}
+
+int asteraI2CUnblock(
+        int handle)
+{
+    if (simGetDevice(handle) == NULL)
+    {
+        return -1;
+    }
+    return 0;    // Equivalent to ARIES_SUCCESS
+}
+
+
+/*
+ * Set per-transaction latency
+ */
+int simSetLatency(
+        int handle,
+        int latencyUs)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    dev->latencyUs = latencyUs;
+    return 0;
+}
+
+/*
+ * Set number of busy status polls per mailbox command
+ */
+int simSetBusyPolls(
+        int handle,
+        int numPolls)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    dev->busyPolls = numPolls;
+    return 0;
+}
+
+/*
+ * Set duration of an EEPROM write cycle
+ */
+int simSetEepromWriteCycle(
+        int handle,
+        int cycleUs)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    dev->eepromWriteCycleUs = cycleUs;
+    return 0;
+}
+
+/*
+ * Get transaction counters
+ */
+int simGetStats(
+        int handle,
+        SimStatsType* stats)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    *stats = dev->stats;
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Clear transaction counters
+ */
+int simClearStats(
+        int handle)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memset(&dev->stats, 0, sizeof(SimStatsType));
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Restore power-on state
+ */
+int simResetDevice(
+        int handle)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    simPowerOn(dev);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor CSR write
+ */
+int simWriteCsr(
+        int handle,
+        int address,
+        int numBytes,
+        uint8_t* values)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (address < 0) ||
+        ((address + numBytes) > SIM_CSR_SIZE))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memcpy(&dev->csr[address], values, numBytes);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor CSR read
+ */
+int simReadCsr(
+        int handle,
+        int address,
+        int numBytes,
+        uint8_t* values)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (address < 0) ||
+        ((address + numBytes) > SIM_CSR_SIZE))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memcpy(values, &dev->csr[address], numBytes);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor Main Micro SRAM write
+ */
+int simWriteMainMicroSram(
+        int handle,
+        int address,
+        int numBytes,
+        uint8_t* values)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (address < 0) ||
+        ((address + numBytes) > SIM_SRAM_SIZE))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memcpy(&dev->mmSram[address], values, numBytes);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor Path Micro SRAM write
+ */
+int simWritePathMicroSram(
+        int handle,
+        int pathID,
+        int address,
+        int numBytes,
+        uint8_t* values)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (pathID < 0) || (pathID >= SIM_NUM_PATH_MICROS) ||
+        (address < 0) || ((address + numBytes) > SIM_SRAM_SIZE))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memcpy(&dev->pmSram[(pathID*SIM_SRAM_SIZE) + address], values, numBytes);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor PMA register write
+ */
+int simWritePmaReg(
+        int handle,
+        int side,
+        int quadSlice,
+        int address,
+        uint16_t value)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (side < 0) || (side > 1) || (quadSlice < 0) ||
+        (quadSlice >= SIM_NUM_QUAD_SLICES))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    *simPmaReg(dev, side, quadSlice, address) = value;
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Set width, state and rate fields of a link struct
+ */
+int simSetLinkState(
+        int handle,
+        int linkNum,
+        int width,
+        int state,
+        int rate)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    int linkBase;
+    if ((dev == NULL) || (linkNum < 0) || (linkNum >= SIM_MAX_LINKS))
+    {
+        return -1;
+    }
+    linkBase = AL_MAIN_SRAM_DMEM_OFFSET + SIM_MM_LINK_STRUCT_OFFSET +
+        (linkNum*SIM_MM_LINK_STRUCT_STRIDE) + (ARIES_LINK_PATH_STRUCT_SIZE*2);
+    pthread_mutex_lock(simGetBusLock(dev));
+    dev->mmSram[linkBase + ARIES_LINK_STRUCT_WIDTH_OFFSET] = width;
+    dev->mmSram[linkBase + ARIES_LINK_STRUCT_STATE_OFFSET] = state;
+    dev->mmSram[linkBase + ARIES_LINK_STRUCT_RATE_OFFSET] = rate;
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor EEPROM load
+ */
+int simLoadEeprom(
+        int handle,
+        uint8_t* image,
+        int numBytes)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (numBytes < 0) || (numBytes > ARIES_EEPROM_NUM_BYTES))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memcpy(dev->eeprom, image, numBytes);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Backdoor EEPROM read
+ */
+int simReadEeprom(
+        int handle,
+        int address,
+        int numBytes,
+        uint8_t* values)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if ((dev == NULL) || (address < 0) ||
+        ((address + numBytes) > ARIES_EEPROM_NUM_BYTES))
+    {
+        return -1;
+    }
+    pthread_mutex_lock(simGetBusLock(dev));
+    memcpy(values, &dev->eeprom[address], numBytes);
+    pthread_mutex_unlock(simGetBusLock(dev));
+    return 0;
+}
+
+/*
+ * Close connection (device is freed on last close)
+ */
+void closeI2CConnection(
+        int handle)
+{
+    SimDeviceType* dev = simGetDevice(handle);
+    if (dev == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&simTableLock);
+    dev->refCount--;
+    if (dev->refCount <= 0)
+    {
+        free(dev->csr);
+        free(dev->mmSram);
+        free(dev->pmSram);
+        free(dev->pma);
+        free(dev->eeprom);
+        dev->inUse = false;
+    }
+    pthread_mutex_unlock(&simTableLock);
+}
@@ -81,6 +81,22 @@ AriesErrorType ariesInitDevice(
         AriesDeviceType* device,
         uint8_t recoveryAddr);
 
+/**
+ * @brief Invalidate the device cache
+ *
+ * The bifurcation mode, port orientation, MM link struct addresses, link path
+ * struct size and FW struct (e.g. AL print info) addresses are kept in the
+ * device cache, and are re-read on next use after invalidation. The SDK
+ * invalidates the cache on resets, bifurcation mode changes and FW updates.
+ * Call this function if the Retimer is reset or reconfigured outside of the
+ * SDK.
+ *
+ * @param[in]  device   Struct containing device information
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesDeviceCacheInvalidate(
+        AriesDeviceType* device);
+
 /**
  * @brief Set the bifurcation mode
  *
@@ -164,7 +180,7 @@ AriesErrorType ariesSetI2CMasterReset(
  *
  * @param[in]  device    Struct containing device information
  * @param[in]  filename  Filename of the file containing the firmware
- * @param[in]  fileType  Enum specifying firmware image file type (IHX or BIN)
+ * @param[in]  fileType  Enum specifying firmware image file type (IHX, BIN or CACHE)
  * @return     AriesErrorType - Aries error code
  */
 AriesErrorType ariesUpdateFirmware(
@@ -172,6 +188,62 @@ AriesErrorType ariesUpdateFirmware(
         const char* filename,
         AriesFWImageFormatType fileType);
 
+/**
+ * @brief Update the FW image in the EEPROM connected to the Retimer from an
+ * image in memory.
+ *
+ * Same as ariesUpdateFirmware(), for an image which is already loaded (e.g.
+ * shared by several devices). Unlike ariesUpdateFirmware(), a failed write or
+ * verify is returned.
+ *
+ * @param[in]  device  Struct containing device information
+ * @param[in]  image   Array containing FW image (in bytes)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesUpdateFirmwareImage(
+        AriesDeviceType* device,
+        uint8_t* image);
+
+/**
+ * @brief Update the FW image in the EEPROM connected to the Retimer, rewriting
+ * only the pages which differ.
+ *
+ * The Main Micro computes a checksum of each EEPROM page (256 bytes) up to the
+ * end of the new image. Only pages whose checksum differs from the image are
+ * rewritten and then verified by checksum again. Falls back to
+ * ariesUpdateFirmware() if the Main Micro cannot assist EEPROM access (ARP
+ * enabled, no valid FW running or FW older than 1.0.48).
+ *
+ * @param[in]  device    Struct containing device information
+ * @param[in]  filename  Filename of the file containing the firmware
+ * @param[in]  fileType  Enum specifying firmware image file type (IHX, BIN or CACHE)
+ * @param[out] stats     Num pages compared, changed, written and failed
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesUpdateFirmwareDelta(
+        AriesDeviceType* device,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        AriesEEPROMPageDeltaStatsType* stats);
+
+/**
+ * @brief Update the FW image in the EEPROM connected to the Retimer from an
+ * image in memory, rewriting only the pages which differ.
+ *
+ * Same as ariesUpdateFirmwareDelta(), for an image which is already loaded.
+ * Falls back to ariesUpdateFirmwareImage() if the Main Micro cannot assist
+ * EEPROM access.
+ *
+ * @param[in]  device  Struct containing device information
+ * @param[in]  image   Array containing FW image (in bytes)
+ * @param[out] stats   Num pages compared, changed, written and failed
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesUpdateFirmwareDeltaImage(
+        AriesDeviceType* device,
+        uint8_t* image,
+        AriesEEPROMPageDeltaStatsType* stats);
+
 /**
  * @brief Get the progress of the FW update in percent complete.
  *
@@ -287,6 +359,70 @@ AriesErrorType ariesWriteEEPROMImageDelta(
         uint8_t* imageNew,
         int sizeNew);
 
+/**
+ * @brief Get the EEPROM page program time statistics of the last EEPROM write.
+ *
+ * By default the EEPROM writes wait a fixed ARIES_DATA_BLOCK_PROGRAM_TIME_USEC
+ * after each page, and no page is timed. When built with
+ * ARIES_EEPROM_PROGRAM_POLL, they poll each page until it returns the
+ * written data instead (bounded by ARIES_EEPROM_PAGE_PROGRAM_TIMEOUT_USEC).
+ * The statistics are cleared at the start of ariesWriteEEPROMImage() and
+ * ariesWriteEEPROMImagePageDelta().
+ *
+ * @param[in]  device  Struct containing device information
+ * @param[out] stats   Page program time statistics
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesGetEEPROMProgramStats(
+        AriesDeviceType* device,
+        AriesEEPROMProgramStatsType* stats);
+
+/**
+ * @brief Load a FW image into the EEPROM connected to the Retimer, rewriting
+ * only the pages whose checksum on the device differs from the image.
+ *
+ * Page checksums are additive byte sums computed by the Main Micro, so Main
+ * Micro assisted EEPROM access is required. Rewritten pages are verified by
+ * checksum and written again up to ARIES_EEPROM_DELTA_PAGE_WRITE_TRIES times.
+ *
+ * @param[in]  device  Struct containing device information
+ * @param[in]  image   Array containing FW image (in bytes)
+ * @param[out] stats   Num pages compared, changed, written and failed
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesWriteEEPROMImagePageDelta(
+        AriesDeviceType* device,
+        uint8_t* image,
+        AriesEEPROMPageDeltaStatsType* stats);
+
+/**
+ * @brief Get the checksums of an EEPROM address range, one per page or bank
+ * the range overlaps.
+ *
+ * Entry i is the 32-bit sum of the bytes of the range inside the i-th page
+ * (or bank) it overlaps, so the first and last entries cover partial pages
+ * when the range is not page aligned. With Main Micro assisted EEPROM access
+ * the sums are computed on the device; otherwise the range is read as a
+ * continuous stream of bytes, sending the address once per bank.
+ *
+ * @param[in]  device        Struct containing device information
+ * @param[in]  startAddr     First EEPROM address of the range
+ * @param[in]  numBytes      Num bytes in the range
+ * @param[in]  unit          Return a checksum per page or per bank
+ * @param[out] checksums     Checksum per page (or bank) of the range
+ * @param[in]  maxChecksums  Num entries in checksums
+ * @param[out] numChecksums  Num checksums returned
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesEEPROMGetRangeChecksums(
+        AriesDeviceType* device,
+        int startAddr,
+        int numBytes,
+        AriesEEPROMChecksumUnitType unit,
+        uint32_t* checksums,
+        int maxChecksums,
+        int* numChecksums);
+
 /**
  * @brief Read a byte from the EEPROM.
  *
@@ -378,6 +514,63 @@ AriesErrorType ariesCheckDeviceHealth(
 AriesErrorType ariesCheckLinkHealth(
         AriesLinkType* link);
 
+/**
+ * @brief Initialize the multi-rate health scheduler of a link, with the
+ * default period of each metric (ARIES_HEALTH_*_PERIOD_MS). All metrics are
+ * due on the first ariesHealthSchedPoll().
+ *
+ * @param[out] sched   Pointer to health scheduler struct
+ * @param[in]  link    Pointer to Aries Link struct object
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesHealthSchedInit(
+        AriesHealthSchedType* sched,
+        AriesLinkType* link);
+
+/**
+ * @brief Set the refresh period of a health metric. A period of 0 disables
+ * the metric.
+ *
+ * @param[in,out] sched     Pointer to health scheduler struct
+ * @param[in]     metric    Health metric
+ * @param[in]     periodMs  Refresh period, in ms
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesHealthSchedSetPeriod(
+        AriesHealthSchedType* sched,
+        AriesHealthMetricType metric,
+        uint32_t periodMs);
+
+/**
+ * @brief Refresh the health metrics of a link which are due, in one bus pass.
+ *
+ * Metrics which fall due within 1/ARIES_HEALTH_MERGE_WINDOW_DIV of their
+ * period are read with the current pass, so that metrics of similar period
+ * share passes. Metrics which are not due keep their cached value, in the
+ * link and device structs, and timestamp. link.state.linkOkay is updated from
+ * the latest reading of every metric. This can be called at a high rate to
+ * track link state changes, without reading per lane FoM and DPLL each time.
+ *
+ * @param[in,out] sched        Pointer to health scheduler struct
+ * @param[out]    updatedMask  Bit mask (1 << AriesHealthMetricType) of
+ *                             metrics read in this pass (may be NULL)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesHealthSchedPoll(
+        AriesHealthSchedType* sched,
+        uint32_t* updatedMask);
+
+/**
+ * @brief Get the time until the next health metric is due
+ *
+ * @param[in]  sched    Pointer to health scheduler struct
+ * @return     uint32_t - Time until next metric is due, in ms (0 if a metric
+ *             is due now, UINT32_MAX if all metrics are disabled or sched
+ *             is NULL)
+ */
+uint32_t ariesHealthSchedNextDueMs(
+        AriesHealthSchedType* sched);
+
 /**
  * @brief Get link recovery counter value
  *
@@ -499,6 +692,30 @@ AriesErrorType ariesLTSSMLoggerReadEntry(
         int* offset,
         AriesLTSSMEntryType* entry);
 
+/**
+ * @brief Read a range of the LTSSM logger print buffer.
+ *
+ * numBytes bytes of the print buffer of the log, starting at offset, are
+ * read in the largest chunks the Main Micro or Path Micro indirect access
+ * interface allows, rather than an access per entry. offset and numBytes
+ * must lie within the print buffer (ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE
+ * or ARIES_PM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE bytes). Returns a negative
+ * error code, else zero on success.
+ *
+ * @param[in]  link      Pointer to Aries Link struct object
+ * @param[in]  logType   The specific log to read from
+ * @param[in]  offset    Print buffer offset of the first byte to read
+ * @param[in]  numBytes  Number of bytes to read
+ * @param[out] values    Pointer to array storing numBytes bytes of log data
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMLoggerReadBuffer(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType logType,
+        int offset,
+        int numBytes,
+        uint8_t* values);
+
 /**
  * @brief Set max data rate
  *
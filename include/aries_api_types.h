@@ -21,9 +21,13 @@
 #ifndef ASTERA_ARIES_SDK_API_TYPES_H_
 #define ASTERA_ARIES_SDK_API_TYPES_H_
 
+#include "aries_globals.h"
+#include "aries_error.h"
+
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <pthread.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -190,10 +194,54 @@ typedef enum AriesI2cPecEnable {
  */
 typedef enum AriesFWImageFormat {
     ARIES_FW_IMAGE_FORMAT_IHX, /**< Intel hex firmware image format */
-    ARIES_FW_IMAGE_FORMAT_BIN  /**< Binary firmware image format */
+    ARIES_FW_IMAGE_FORMAT_BIN, /**< Binary firmware image format */
+    ARIES_FW_IMAGE_FORMAT_CACHE /**< Image cache (ariesFWImageWriteCache()) */
 } AriesFWImageFormatType;
 
 
+/**
+ * @brief Struct defining the header of a FW image cache file. It is followed
+ * by numBlocks uint32_t block checksums, and the image starts at dataOffset.
+ * All values are in the byte order of the writer.
+ */
+typedef struct AriesFWImageCacheHeader {
+    uint32_t magic; /**< ARIES_FW_IMAGE_CACHE_MAGIC */
+    uint16_t versionMajor; /**< ARIES_FW_IMAGE_CACHE_VERSION_MAJOR of the writer */
+    uint16_t versionMinor; /**< ARIES_FW_IMAGE_CACHE_VERSION_MINOR of the writer */
+    uint32_t headerSize; /**< Header and block checksum table size, in bytes */
+    uint32_t dataOffset; /**< File offset of the image, in bytes */
+    uint32_t imageSize; /**< Image size, in bytes (ARIES_EEPROM_NUM_BYTES) */
+    int32_t imageEnd; /**< ariesGetEEPROMImageEnd() of the image */
+    uint32_t blockSize; /**< Checksum block size, in bytes */
+    uint32_t numBlocks; /**< Num block checksums */
+    uint64_t sourceSize; /**< Size of the source image file, in bytes */
+    int64_t sourceMtime; /**< Modification time of the source image file */
+    int64_t sourceMtimeNsec; /**< Nanoseconds of sourceMtime */
+    int64_t sourceCtime; /**< Status change time of the source image file */
+    int64_t sourceCtimeNsec; /**< Nanoseconds of sourceCtime */
+    uint64_t sourceDev; /**< Device of the source image file */
+    uint64_t sourceIno; /**< Inode number of the source image file */
+} AriesFWImageCacheHeaderType;
+
+
+/**
+ * @brief Struct defining a firmware image opened with ariesFWImageOpen(). A
+ * binary image or image cache is a read-only mapping of the file, an intel
+ * hex image is decoded into a heap buffer. Either way data holds
+ * ARIES_EEPROM_NUM_BYTES.
+ */
+typedef struct AriesFWImage {
+    uint8_t* data; /**< Image bytes (read-only if mapped) */
+    void* mapBase; /**< File mapping, NULL if data is on the heap */
+    size_t mapSize; /**< Size of the file mapping, in bytes */
+    int imageEnd; /**< ariesGetEEPROMImageEnd() of the image */
+    const AriesFWImageCacheHeaderType* cache; /**< Cache header (image
+                                                   caches), else NULL */
+    const uint32_t* blockChecksums; /**< Byte sum of each cache block (image
+                                         caches), else NULL */
+} AriesFWImageType;
+
+
 /**
  * @brief Enumeration of Firmware Update Progress values
  */
@@ -242,6 +290,40 @@ typedef enum AriesPseudoPort {
     ARIES_DOWN_STREAM_PSEUDO_PORT = 1 /**< DSPP. Value is 1 */
 } AriesPseudoPortType;
 
+
+/**
+ * @brief Enumeration of the units EEPROM range checksums are returned per
+ */
+typedef enum AriesEEPROMChecksumUnit {
+    ARIES_EEPROM_CHECKSUM_UNIT_PAGE = 0, /**< Checksum per EEPROM page (256 bytes) */
+    ARIES_EEPROM_CHECKSUM_UNIT_BANK = 1 /**< Checksum per EEPROM bank (64 KB) */
+} AriesEEPROMChecksumUnitType;
+
+/**
+ * @brief Enumeration of public APIs that I2C transactions are attributed to
+ */
+typedef enum AriesI2CStatsApi {
+    ARIES_I2C_STATS_API_OTHER = 0, /**< Transactions outside a tracked API */
+    ARIES_I2C_STATS_API_INIT_DEVICE, /**< ariesInitDevice() */
+    ARIES_I2C_STATS_API_CHECK_DEVICE_HEALTH, /**< ariesCheckDeviceHealth() */
+    ARIES_I2C_STATS_API_CHECK_LINK_HEALTH, /**< ariesCheckLinkHealth() */
+    ARIES_I2C_STATS_API_GET_LINK_STATE, /**< ariesGetLinkState() */
+    ARIES_I2C_STATS_API_GET_LINK_STATE_DETAILED, /**< ariesGetLinkStateDetailed() */
+    ARIES_I2C_STATS_API_GET_CURRENT_TEMP, /**< ariesGetCurrentTemp() */
+    ARIES_I2C_STATS_API_GET_MAX_TEMP, /**< ariesGetMaxTemp() */
+    ARIES_I2C_STATS_API_LTSSM_LOGGER_READ_ENTRY, /**< ariesLTSSMLoggerReadEntry() */
+    ARIES_I2C_STATS_API_LTSSM_LOGGER_READ_BUFFER, /**< ariesLTSSMLoggerReadBuffer() */
+    ARIES_I2C_STATS_API_UPDATE_FIRMWARE, /**< ariesUpdateFirmware(), ariesUpdateFirmwareImage() */
+    ARIES_I2C_STATS_API_WRITE_EEPROM_IMAGE, /**< ariesWriteEEPROMImage() */
+    ARIES_I2C_STATS_API_VERIFY_EEPROM_IMAGE, /**< ariesVerifyEEPROMImage() */
+    ARIES_I2C_STATS_API_VERIFY_EEPROM_IMAGE_CHECKSUM, /**< ariesVerifyEEPROMImageViaChecksum() */
+    ARIES_I2C_STATS_API_HEALTH_SCHED_POLL, /**< ariesHealthSchedPoll() */
+    ARIES_I2C_STATS_API_UPDATE_FIRMWARE_DELTA, /**< ariesUpdateFirmwareDelta(), ariesUpdateFirmwareDeltaImage() */
+    ARIES_I2C_STATS_API_WRITE_EEPROM_IMAGE_PAGE_DELTA, /**< ariesWriteEEPROMImagePageDelta() */
+    ARIES_I2C_STATS_API_EEPROM_RANGE_CHECKSUMS, /**< ariesEEPROMGetRangeChecksums() */
+    ARIES_I2C_STATS_NUM_APIS /**< Num tracked APIs (not an API) */
+} AriesI2CStatsApiType;
+
 /*
  * Structure Definitions
  */
@@ -267,6 +349,19 @@ typedef struct AriesPins {
 } AriesPinsType;
 
 
+/**
+ * @brief Struct defining I2C bus lock contention statistics of an I2C driver.
+ */
+typedef struct AriesI2CLockStats {
+    uint64_t acquisitions;          /**< Num outermost lock acquisitions */
+    uint64_t contendedAcquisitions; /**< Num acquisitions which waited for another thread */
+    uint64_t totalWaitUs;           /**< Time spent waiting for lock (incl. cross-process lock) */
+    uint64_t maxWaitUs;             /**< Longest wait for lock */
+    uint64_t totalHoldUs;           /**< Time lock was held */
+    uint64_t maxHoldUs;             /**< Longest time lock was held */
+} AriesI2CLockStatsType;
+
+
 /**
  * @brief Struct defining I2C/SMBus connection with an Aries device.
  */
@@ -277,9 +372,79 @@ typedef struct AriesI2CDriver {
     AriesI2CPECEnableType pecEnable; /**< Enable PEC */
     int lock;                        /** Flag indicating if device reads are locked */
     bool lockInit;                   /** Flag indicating if lock has been initialized */
+    pthread_mutex_t lockMutex;       /**< Reentrant lock between threads sharing the driver */
+    uint64_t lockStartUs;            /**< Time outermost lock was acquired */
+    AriesI2CLockStatsType lockStats; /**< Lock contention statistics */
 } AriesI2CDriverType;
 
 
+/**
+ * @brief Struct defining one SMBus block transaction passed to the low-level
+ * I2C transfer method.
+ */
+typedef struct AriesI2CTransaction {
+    bool isRead;        /**< Block read (true) or block write (false) */
+    uint8_t cmdCode;    /**< SMBus command code */
+    uint8_t bufLen;     /**< Num bytes to write or read */
+    uint8_t* buf;       /**< Data to write, or buffer for data read */
+    int rc;             /**< Num bytes read (reads) or zero (writes) if success, else a negative value */
+} AriesI2CTransactionType;
+
+
+/**
+ * @brief Struct defining one Retimer register access submitted as part of a
+ * list with ariesI2CSubmit().
+ */
+typedef struct AriesI2COp {
+    bool isRead;        /**< Read (true) or write (false) */
+    uint32_t address;   /**< Register address */
+    uint8_t numBytes;   /**< Num bytes to read or write */
+    uint8_t* values;    /**< Data to write, or buffer for data read */
+} AriesI2COpType;
+
+
+/**
+ * @brief Struct defining one PMA register read through the Main Micro assist
+ * mailbox, submitted as part of a list with
+ * ariesReadWordsPmaMainMicroIndirect().
+ */
+typedef struct AriesPmaRead {
+    int side;           /**< PMA Side B (0) or A (1) */
+    int quadSlice;      /**< PMA num: 0, 1, 2, or 3 */
+    uint16_t pmaAddr;   /**< 16-bit PMA reg offset (including lane offset) */
+    uint8_t data[2];    /**< Data read (LSB first) */
+} AriesPmaReadType;
+
+
+/**
+ * @brief Struct defining I2C transaction counters for one public API.
+ *
+ * Byte counts include the slave address, command code, byte count and PEC
+ * bytes of each SMBus transaction.
+ */
+typedef struct AriesI2CApiStats {
+    uint32_t calls;             /**< Num calls to the API */
+    uint64_t totalTimeUs;       /**< Total time spent in the API (us) */
+    uint32_t writeTransactions; /**< Num SMBus write transactions */
+    uint32_t readTransactions;  /**< Num SMBus read transactions */
+    uint64_t bytesWritten;      /**< Num bytes written on bus */
+    uint64_t bytesRead;         /**< Num bytes read from bus */
+    uint32_t failedTransactions;    /**< Num transactions that returned error */
+    uint32_t readRetries;       /**< Num block read retries */
+    uint32_t pollIterations;    /**< Num indirect access status polls */
+    uint32_t latencyBuckets[ARIES_I2C_STATS_NUM_LATENCY_BUCKETS]; /**< Transaction latency histogram */
+} AriesI2CApiStatsType;
+
+
+/**
+ * @brief Struct defining I2C transaction counters for an I2C driver, split
+ * by the public API which started the transactions.
+ */
+typedef struct AriesI2CStats {
+    AriesI2CApiStatsType api[ARIES_I2C_STATS_NUM_APIS]; /**< Per-API counters */
+} AriesI2CStatsType;
+
+
 /**
  * @brief Struct defining FW version loaded on an Aries device.
  */
@@ -290,6 +455,39 @@ typedef struct AriesFWVersion {
 } AriesFWVersionType;
 
 
+/**
+ * @brief Struct defining shadow copies of device metadata held in Main Micro
+ * SRAM and global params, which only change after a reset, FW reload or
+ * bifurcation change. Cleared by ariesDeviceCacheInvalidate().
+ */
+typedef struct AriesDeviceCache {
+    bool bifurcationValid;  /**< bifurcation holds value read from device */
+    AriesBifurcationType bifurcation;   /**< Bifurcation mode */
+    uint8_t linkStructAddrValid;    /**< Bit mask of valid linkStructAddr */
+    // Max links inside a link set is 8
+    uint16_t linkStructAddr[8]; /**< MM link struct address per link num */
+    bool fwStructAddrValid; /**< FW struct addrs and sizes in device are valid */
+    bool orientationValid;  /**< orientation holds value read from device */
+    int orientation;        /**< Port orientation (0: normal, 1: reversed) */
+} AriesDeviceCacheType;
+
+
+/**
+ * @brief Struct defining EEPROM page program time statistics. The program
+ * time of a page is measured from the end of its write until the EEPROM
+ * returns the written data.
+ */
+typedef struct AriesEEPROMProgramStats {
+    int numPages; /**< Num page programs timed */
+    int numTimeouts; /**< Num page programs not complete within timeout */
+    int numPolls; /**< Num completion polls */
+    uint32_t minUs; /**< Min program time of a completed page (us) */
+    uint32_t maxUs; /**< Max program time of a completed page (us) */
+    uint64_t totalUs; /**< Total program time of completed pages (us) */
+    int hist[ARIES_EEPROM_PROGRAM_TIME_HIST_BINS]; /**< Num completed pages per 1 ms of program time (last bin: all longer) */
+} AriesEEPROMProgramStatsType;
+
+
 /**
  * @brief Struct defining Aries retimer device
  */
@@ -325,9 +523,11 @@ typedef struct AriesDevice {
     uint16_t minDPLLFreqAlert;  /** Min. DPLL frequency expected */
     uint16_t maxDPLLFreqAlert;  /** Max. DPLL frequency expected */
     AriesFWUpdateProgressType fwUpdateProg; /** Firmware update progress */
+    AriesEEPROMProgramStatsType eepromProgStats; /** Page program times of last EEPROM write */
     int fwUpdateMmAssistBlockSizeBytes;  /** Block size (bytes) when transfering data to Retimer for FW update */
     int fwUpdateMmAssistBaseAddr;  /** Base address for storing data during MM-assisted FW update */
     int fwUpdateMmAssistCmdModifier; /** MM-assisted FW update command modifier code */
+    AriesDeviceCacheType cache; /** Shadow copies of static device metadata */
 } AriesDeviceType;
 
 
@@ -489,6 +689,17 @@ typedef struct AriesEEPROMDelta {
 } AriesEEPROMDeltaType;
 
 
+/**
+ * @brief Struct defining the result of a page delta EEPROM update
+ */
+typedef struct AriesEEPROMPageDeltaStats {
+    int numPages; /**< Num EEPROM pages covered by the image */
+    int numPagesChanged; /**< Num pages whose checksum differed from image */
+    int numPageWrites; /**< Num page writes, including rewrites */
+    int numPagesFailed; /**< Num pages which failed verify after all writes */
+} AriesEEPROMPageDeltaStatsType;
+
+
 /**
  * @brief Struct defining paramaters for a given link inside link set
  */
@@ -523,6 +734,520 @@ typedef struct AriesRxMargin
     uint8_t** errorCount; /**< Array to store error counts for each port and lane */
 } AriesRxMarginType;
 
+/**
+ * @brief Enumeration of link health metrics refreshed by the health scheduler
+ */
+typedef enum AriesHealthMetric
+{
+    ARIES_HEALTH_METRIC_LINK_STATE = 0, /**< Link state, rate and width */
+    ARIES_HEALTH_METRIC_TEMP = 1, /**< Current and max temp, over-temp flag */
+    ARIES_HEALTH_METRIC_RECOVERY_COUNT = 2, /**< Recovery count */
+    ARIES_HEALTH_METRIC_FOM = 3, /**< Min FoM across lanes of both sides */
+    ARIES_HEALTH_METRIC_DPLL = 4, /**< Median DPLL code of all lanes */
+    ARIES_HEALTH_NUM_METRICS = 5
+} AriesHealthMetricType;
+
+/**
+ * @brief Struct defining the multi-rate health scheduler of a link. The
+ * latest values are held in the link and device structs; timestampUs tells
+ * when each metric was last read.
+ */
+typedef struct AriesHealthSched
+{
+    AriesLinkType* link;    /**< Link monitored */
+    uint32_t periodMs[ARIES_HEALTH_NUM_METRICS]; /**< Refresh period per metric (0 = disabled) */
+    uint64_t timestampUs[ARIES_HEALTH_NUM_METRICS]; /**< Monotonic time of last read (0 = never) */
+    bool metricOkay[ARIES_HEALTH_NUM_METRICS]; /**< Metric within thresholds at last read */
+    uint32_t numPasses;     /**< Num bus passes which read at least one metric */
+} AriesHealthSchedType;
+
+/**
+ * @brief Struct defining one timestamped telemetry sample of a link
+ */
+typedef struct AriesTelemetrySample
+{
+    uint64_t timestampUs;       /**< Monotonic time the sample was recorded */
+    float currentTempC;         /**< Current average temp across all sensors */
+    float maxTempC;             /**< Max. temp seen across all temp sensors */
+    uint16_t recoveryCount;     /**< Count of entries to Recovery */
+    uint8_t state;              /**< Link state (AriesLinkStateEnumType) */
+    uint8_t rate;               /**< Data rate (1=Gen1, 5=Gen5) */
+    uint8_t curWidth;           /**< Current width of the Link */
+    uint8_t linkMinFoM;         /**< Min FoM across all Lanes */
+    bool linkOkay;              /**< Link is healthy (true) or not (false) */
+    bool overtempAlert;         /**< Over temp alert indicated by reg */
+    uint16_t usppDPLLCode[16];  /**< DPLL code per Lane, USPP */
+    uint16_t dsppDPLLCode[16];  /**< DPLL code per Lane, DSPP */
+} AriesTelemetrySampleType;
+
+/**
+ * @brief Struct defining a slot of the telemetry ring
+ */
+typedef struct AriesTelemetrySlot
+{
+    uint64_t seq;   /**< 2*(n+1) once sample n is written, odd while writing */
+    AriesTelemetrySampleType sample; /**< Sample */
+} AriesTelemetrySlotType;
+
+/**
+ * @brief Struct defining a single-producer, multi-consumer telemetry ring of
+ * a link. Slots are preallocated by the caller.
+ */
+typedef struct AriesTelemetryRing
+{
+    AriesTelemetrySlotType* slots; /**< Slot array, numSlots entries */
+    uint32_t numSlots;      /**< Num slots (power of 2) */
+    uint64_t head;          /**< Num samples pushed (next sample number) */
+} AriesTelemetryRingType;
+
+/**
+ * @brief Struct defining the published state of a device in shared memory.
+ * Pointer members of device are not valid in the reader (set to NULL).
+ */
+typedef struct AriesShmDeviceEntry
+{
+    uint64_t timestampUs;   /**< Monotonic time of publication (0 = never) */
+    uint64_t numUpdates;    /**< Num times the entry was published */
+    AriesDeviceType device; /**< Device state */
+} AriesShmDeviceEntryType;
+
+/**
+ * @brief Struct defining the published state of a link in shared memory.
+ * state.linkMinFoMRx points to linkMinFoMRx of the entry in the reader, other
+ * pointer members of state are not valid (set to NULL).
+ */
+typedef struct AriesShmLinkEntry
+{
+    uint64_t timestampUs;   /**< Monotonic time of publication (0 = never) */
+    uint64_t numUpdates;    /**< Num times the entry was published */
+    int deviceIndex;        /**< Index of the link's device entry */
+    AriesLinkConfigType config; /**< Link config */
+    AriesLinkStateType state;   /**< Link state */
+    char linkMinFoMRx[ARIES_SHM_PIN_NAME_LEN]; /**< Receiver with min FoM */
+} AriesShmLinkEntryType;
+
+/**
+ * @brief Struct defining a mapping of the shared memory state segment, as
+ * publisher or reader
+ */
+typedef struct AriesShm
+{
+    void* base;             /**< Mapped segment */
+    size_t size;            /**< Size of the mapping, in bytes */
+    int numDevices;         /**< Num device entries */
+    int numLinks;           /**< Num link entries */
+    bool publisher;         /**< Mapped writable by the publisher */
+    char name[64];          /**< Segment name */
+} AriesShmType;
+
+struct AriesAsyncRequest;
+
+/**
+ * @brief Operation run by an async bus worker
+ */
+typedef AriesErrorType (*AriesAsyncFnType)(
+        struct AriesAsyncRequest* request);
+
+/**
+ * @brief Completion callback of an async operation (runs on the bus worker)
+ */
+typedef void (*AriesAsyncCallbackType)(
+        struct AriesAsyncRequest* request,
+        void* userData);
+
+/**
+ * @brief Struct defining an operation submitted to an async bus worker. It is
+ * owned by the caller and must stay valid until the operation is done.
+ */
+typedef struct AriesAsyncRequest
+{
+    AriesDeviceType* device;         /**< Device operated on (selects the bus worker) */
+    AriesLinkType* link;             /**< Link operated on (link operations) */
+    uint8_t* image;                  /**< FW image (EEPROM operations) */
+    bool legacyMode;                 /**< Legacy mode flag (EEPROM operations) */
+    void* arg;                       /**< Argument of a user operation */
+    AriesAsyncFnType fn;             /**< Operation to run */
+    AriesAsyncCallbackType callback; /**< Completion callback (may be NULL) */
+    void* userData;                  /**< Passed to completion callback */
+    AriesErrorType rc;               /**< Operation return code, valid once done */
+    bool done;                       /**< Set once operation and callback completed */
+    int workerIndex;                 /**< Bus worker the request is queued on */
+    struct AriesAsyncRequest* next;  /**< Next request in bus worker queue */
+} AriesAsyncRequestType;
+
+/**
+ * @brief Struct defining the health of one link in a fleet health sweep
+ */
+typedef struct AriesFleetHealthResult
+{
+    AriesLinkType* link;       /**< Link checked */
+    AriesErrorType rc;         /**< Return code of the checks of this link */
+    bool deviceChecked;        /**< Device health was checked with this link */
+    bool deviceOkay;           /**< Device is healthy (true) or not (false) */
+    bool linkOkay;             /**< Link is healthy (true) or not (false) */
+    AriesLinkStateEnumType state; /**< Current Link state */
+    int rate;                  /**< Current data rate (1=Gen1, 5=Gen5) */
+    int curWidth;              /**< Current width of the Link */
+    int linkMinFoM;            /**< Minimum FoM value across all Lanes */
+    float currentTempC;        /**< Current average temp across all sensors */
+    float maxTempC;            /**< Max. temp seen across all temp sensors */
+    double durationUs;         /**< Time spent checking this link, in us */
+} AriesFleetHealthResultType;
+
+/**
+ * @brief Enumeration of the states of a device in a fleet FW update
+ */
+typedef enum AriesFleetUpdateState
+{
+    ARIES_FLEET_UPDATE_QUEUED = 0, /**< Waiting for its bus worker */
+    ARIES_FLEET_UPDATE_RUNNING = 1, /**< EEPROM being written or verified */
+    ARIES_FLEET_UPDATE_DONE = 2, /**< Updated and verified */
+    ARIES_FLEET_UPDATE_FAILED = 3 /**< Update failed (see rc) */
+} AriesFleetUpdateStateType;
+
+/**
+ * @brief Struct defining the update of one device in a fleet FW update
+ */
+typedef struct AriesFleetUpdateResult
+{
+    AriesDeviceType* device;   /**< Device updated */
+    AriesErrorType rc;         /**< Return code of the update of this device */
+    AriesFleetUpdateStateType state; /**< Update state */
+    uint8_t percentComplete;   /**< Progress of this device, in percent (set by
+                                    ariesFleetUpdateFirmwareProgress()) */
+    AriesEEPROMPageDeltaStatsType deltaStats; /**< Pages rewritten (delta update) */
+    double startUs;            /**< Time the update of this device started, in us */
+    double durationUs;         /**< Time spent updating this device, in us */
+} AriesFleetUpdateResultType;
+
+/**
+ * @brief Struct defining a fleet FW update in progress. It is owned by the
+ * caller and must stay valid until the update is waited on.
+ */
+typedef struct AriesFleetUpdate
+{
+    AriesFleetUpdateResultType* results; /**< Per device results */
+    int numDevices;            /**< Num devices updated */
+    int numSubmitted;          /**< Num devices queued on a bus worker */
+    bool delta;                /**< Rewrite only the pages which differ */
+    AriesFWImageType image;    /**< FW image, shared by all devices */
+    int imageBytes;            /**< Num bytes of the image up to its end marker */
+    struct AriesAsyncRequest* requests; /**< Per device async requests */
+    double startUs;            /**< Time the fleet update started, in us */
+} AriesFleetUpdateType;
+
+/**
+ * @brief Struct defining the aggregate progress of a fleet FW update
+ */
+typedef struct AriesFleetUpdateProgress
+{
+    int numDevices;            /**< Num devices updated */
+    int numQueued;             /**< Num devices waiting for their bus worker */
+    int numRunning;            /**< Num devices being updated */
+    int numDone;               /**< Num devices updated successfully */
+    int numFailed;             /**< Num devices whose update failed */
+    uint8_t percentComplete;   /**< Progress over all devices, in percent */
+    double elapsedSec;         /**< Time since the fleet update started */
+    double bytesPerSec;        /**< Image bytes written and verified per second,
+                                    over all devices */
+    double etaSec;             /**< Estimated time to completion (-1 if not yet
+                                    known) */
+} AriesFleetUpdateProgressType;
+
+/**
+ * @brief Enumeration of LTSSM log event kinds
+ */
+typedef enum AriesLTSSMEventKind
+{
+    ARIES_LTSSM_EVENT_MESSAGE = 0,  /**< Other logger message */
+    ARIES_LTSSM_EVENT_STATE = 1,    /**< LTSSM state transition */
+    ARIES_LTSSM_EVENT_EQ_PHASE = 2, /**< Equalization phase */
+    ARIES_LTSSM_EVENT_RATE = 3,     /**< Data rate change */
+    ARIES_LTSSM_EVENT_UNKNOWN = 4,  /**< Format ID not in the format table */
+    ARIES_LTSSM_EVENT_OVERRUN = 5,  /**< Log bytes were lost before being
+                                         read (log tail); framing restarts */
+} AriesLTSSMEventKindType;
+
+/**
+ * @brief Struct defining the format of a logger message: its format ID (the
+ * first byte of the message in the print buffer) and its text. The message
+ * carries a 2-byte variable per % conversion of the text. Main Micro
+ * messages also carry a link/path byte between the format ID and the
+ * variables
+ */
+typedef struct AriesLTSSMFmt
+{
+    uint8_t fmtID;          /**< Format ID (non-zero) */
+    AriesLTSSMEventKindType kind; /**< Kind of event */
+    char text[ARIES_LTSSM_FMT_TEXT_LEN]; /**< Message, one %x, %c, %d or %u
+                                              per variable. A "%x ms"
+                                              variable is a time stamp */
+} AriesLTSSMFmtType;
+
+/**
+ * @brief Struct defining a decoded LTSSM log event
+ */
+typedef struct AriesLTSSMEvent
+{
+    int logType;            /**< Log of the event (AriesLTSSMLoggerEnumType) */
+    int offset;             /**< Print buffer offset of the format ID */
+    uint8_t fmtID;          /**< Format ID */
+    AriesLTSSMEventKindType kind; /**< Kind of event */
+    int value;              /**< New state, EQ phase or rate of those kinds:
+                                 the first variable which is not a time
+                                 stamp, else the format ID (the format names
+                                 the state). 0 for other kinds */
+    int linkId;             /**< Link of a Main Micro message (-1 if none) */
+    int pathId;             /**< Path of a Main Micro message (-1 if none) */
+    bool hasTime;           /**< Message has a time stamp */
+    double timeMs;          /**< Time stamp, in ms */
+    uint8_t numVars;        /**< Num variables */
+    uint16_t vars[ARIES_LTSSM_FMT_MAX_VARS]; /**< Variables, as logged */
+    const AriesLTSSMFmtType* fmt; /**< Format (NULL if kind is unknown) */
+} AriesLTSSMEventType;
+
+/**
+ * @brief Callback receiving each decoded LTSSM log event
+ */
+typedef void (*AriesLTSSMEventCallbackType)(
+        const AriesLTSSMEventType* event,
+        void* userData);
+
+/**
+ * @brief Struct defining an incremental LTSSM log decoder. Log bytes are fed
+ * in log order, and a message may be split across feeds.
+ */
+typedef struct AriesLTSSMDecoder
+{
+    const AriesLTSSMFmtType* mmFmts[ARIES_LTSSM_NUM_FMT_IDS]; /**< Main Micro
+                                        format per format ID (NULL if none) */
+    const AriesLTSSMFmtType* pmFmts[ARIES_LTSSM_NUM_FMT_IDS]; /**< Path Micro
+                                        format per format ID (NULL if none) */
+    AriesLTSSMEventCallbackType callback; /**< Event callback (may be NULL) */
+    void* userData;         /**< Passed to event callback */
+    AriesLTSSMEventType* events; /**< Event array (may be NULL) */
+    int maxEvents;          /**< Num entries of event array */
+    int numEvents;          /**< Num events stored in event array */
+    int numDropped;         /**< Num events not stored, event array full */
+    int numUnknown;         /**< Num unknown format IDs seen */
+    AriesLTSSMEventType pending; /**< Message whose bytes are being read */
+    uint8_t pendingBytes[1 + (2 * ARIES_LTSSM_FMT_MAX_VARS)]; /**< Bytes
+                                        following the format ID, read so far */
+    int numPendingBytes;    /**< Num bytes of pending message read (-1: no
+                                 message pending) */
+    int numMessageBytes;    /**< Num bytes following the format ID of
+                                 pending message */
+    bool stalled;           /**< Unknown format ID seen; the rest of the log
+                                 cannot be framed until reset */
+} AriesLTSSMDecoderType;
+
+/**
+ * @brief Struct defining the position of a reader tailing an LTSSM log
+ */
+typedef struct AriesLTSSMTail
+{
+    AriesLinkType* link;    /**< Link of the log */
+    int log;                /**< Log (AriesLTSSMLoggerEnumType) */
+    int bufferSize;         /**< Print buffer size of the log, in bytes */
+    bool synced;            /**< Position set by a first poll */
+    bool oneBatchMode;      /**< Log is in one batch mode (no wrap-around) */
+    bool atBoundary;        /**< Bytes of the last poll start at the start of the log */
+    int writeOffset;        /**< Write offset the log is consumed up to */
+    uint8_t guard[ARIES_LTSSM_TAIL_GUARD_BYTES]; /**< Last bytes consumed */
+    int numGuard;           /**< Num valid guard bytes */
+    uint64_t numBytes;      /**< Num log bytes consumed */
+    uint64_t numOverruns;   /**< Num overruns detected */
+} AriesLTSSMTailType;
+
+/**
+ * @brief Enumeration of the sections of a binary snapshot
+ */
+typedef enum AriesSnapshotSectionKind
+{
+    ARIES_SNAPSHOT_SECTION_SCHEMA = 1,  /**< AriesSnapshotFieldType records */
+    ARIES_SNAPSHOT_SECTION_DEVICE = 2,  /**< One AriesSnapshotDeviceType */
+    ARIES_SNAPSHOT_SECTION_LINK = 3,    /**< One AriesSnapshotLinkType */
+    ARIES_SNAPSHOT_SECTION_LANE = 4,    /**< AriesSnapshotLaneType per lane */
+    ARIES_SNAPSHOT_SECTION_LOG = 5,     /**< Raw LTSSM log bytes, log order */
+} AriesSnapshotSectionKindType;
+
+/**
+ * @brief Enumeration of the types of a snapshot record field
+ */
+typedef enum AriesSnapshotFieldKind
+{
+    ARIES_SNAPSHOT_FIELD_INT = 1,       /**< int32_t */
+    ARIES_SNAPSHOT_FIELD_FLOAT = 2,     /**< float */
+    ARIES_SNAPSHOT_FIELD_UINT8 = 3,     /**< uint8_t */
+    ARIES_SNAPSHOT_FIELD_STRING = 4,    /**< NUL padded char array */
+} AriesSnapshotFieldKindType;
+
+/**
+ * @brief Struct defining the header of a binary snapshot file. It is
+ * followed by numSections section descriptors. All values are in the byte
+ * order of the writer, which the reader checks through magic.
+ */
+typedef struct AriesSnapshotHeader
+{
+    uint32_t magic;         /**< ARIES_SNAPSHOT_MAGIC */
+    uint16_t versionMajor;  /**< ARIES_SNAPSHOT_VERSION_MAJOR of the writer */
+    uint16_t versionMinor;  /**< ARIES_SNAPSHOT_VERSION_MINOR of the writer */
+    uint32_t headerSize;    /**< Header and section table size, in bytes */
+    uint32_t fileSize;      /**< File size, in bytes */
+    uint32_t numSections;   /**< Num section descriptors */
+    uint32_t reserved;      /**< Zero */
+    int64_t timestamp;      /**< Capture time, in seconds since the Epoch */
+    char sdkVersion[32];    /**< SDK version of the writer */
+} AriesSnapshotHeaderType;
+
+/**
+ * @brief Struct defining a section descriptor of a binary snapshot
+ */
+typedef struct AriesSnapshotSection
+{
+    uint32_t kind;          /**< AriesSnapshotSectionKindType */
+    int32_t id;             /**< Log type (log sections), else 0 */
+    uint32_t offset;        /**< File offset, ARIES_SNAPSHOT_ALIGN aligned */
+    uint32_t size;          /**< Size, in bytes */
+    uint32_t recordSize;    /**< Record size, in bytes (1 for logs) */
+    uint32_t numRecords;    /**< Num records */
+    uint32_t param;         /**< Print buffer offset of the first log byte
+                                 (log sections), else 0 */
+    uint32_t reserved;      /**< Zero */
+} AriesSnapshotSectionType;
+
+/**
+ * @brief Struct defining a field of a snapshot record, as stored in the
+ * schema section. Readers locate fields through the schema, so records can
+ * gain fields in later minor versions.
+ */
+typedef struct AriesSnapshotField
+{
+    uint16_t sectionKind;   /**< Section of the record */
+    uint16_t kind;          /**< AriesSnapshotFieldKindType */
+    uint16_t offset;        /**< Offset in the record, in bytes */
+    uint16_t count;         /**< Num elements (string length for strings) */
+    char name[ARIES_SNAPSHOT_FIELD_NAME_LEN]; /**< Field name */
+} AriesSnapshotFieldType;
+
+/**
+ * @brief Struct defining the device record of a snapshot
+ */
+typedef struct AriesSnapshotDevice
+{
+    int32_t fwVersionMajor;     /**< FW version major */
+    int32_t fwVersionMinor;     /**< FW version minor */
+    int32_t fwVersionBuild;     /**< FW version build */
+    int32_t partNumber;         /**< AriesDevicePartType */
+    int32_t revNumber;          /**< Revision num */
+    int32_t i2cBus;             /**< I2C bus */
+    int32_t slaveAddr;          /**< I2C slave address */
+    int32_t deviceOkay;         /**< Device state */
+    int32_t overtempAlert;      /**< Over temp alert */
+    float maxTempC;             /**< All time max temp (Celsius) */
+    float currentTempC;         /**< Current temp (Celsius) */
+    float tempAlertThreshC;     /**< Temp alert threshold (Celsius) */
+    uint8_t chipID[12];         /**< Unique chip ID */
+    uint8_t lotNumber[6];       /**< Silicon lot number */
+    uint8_t reserved[2];        /**< Zero */
+} AriesSnapshotDeviceType;
+
+/**
+ * @brief Struct defining the link record of a snapshot
+ */
+typedef struct AriesSnapshotLink
+{
+    int32_t linkId;             /**< Link identifier */
+    int32_t startLane;          /**< Starting (physical) lane */
+    int32_t width;              /**< Width of the link */
+    int32_t curWidth;           /**< Current width of the link */
+    int32_t state;              /**< AriesLinkStateEnumType */
+    int32_t rate;               /**< Current data rate */
+    int32_t linkOkay;           /**< Link state */
+    int32_t linkMinFoM;         /**< Min FoM across all lanes */
+    int32_t recoveryCount;      /**< Num entries to Recovery */
+    float usppSpeed;            /**< USPP speed */
+    float dsppSpeed;            /**< DSPP speed */
+    char linkMinFoMRx[ARIES_SNAPSHOT_PIN_NAME_LEN]; /**< Rx with min FoM */
+} AriesSnapshotLinkType;
+
+/**
+ * @brief Struct defining the Transmitter state of a lane in a snapshot
+ */
+typedef struct AriesSnapshotTx
+{
+    int32_t logicalLane;        /**< Logical lane num */
+    int32_t de;                 /**< De-emphasis */
+    int32_t pre;                /**< Pre-cursor */
+    int32_t cur;                /**< Main-cursor */
+    float pst;                  /**< Post-cursor */
+    int32_t lastEqRate;         /**< Last speed at which EQ was done */
+    int32_t lastPresetReq;      /**< Final preset request */
+    int32_t lastPreReq;         /**< Final pre-cursor request */
+    int32_t lastCurReq;         /**< Final main-cursor request */
+    int32_t lastPstReq;         /**< Final post-cursor request */
+    char physicalPin[ARIES_SNAPSHOT_PIN_NAME_LEN]; /**< Physical pin name */
+} AriesSnapshotTxType;
+
+/**
+ * @brief Struct defining the Receiver state of a lane in a snapshot
+ */
+typedef struct AriesSnapshotRx
+{
+    int32_t logicalLane;        /**< Logical lane num */
+    int32_t termination;        /**< Termination enable */
+    int32_t polarity;           /**< Polarity inverted */
+    float attdB;                /**< Attenuator (dB) */
+    float ctleBoostdB;          /**< CTLE boost (dB) */
+    int32_t ctlePole;           /**< CTLE pole code */
+    float vgadB;                /**< VGA (dB) */
+    float dfe[8];               /**< DFE taps 1 to 8 (mV) */
+    int32_t lastEqRate;         /**< Last speed at which EQ was done */
+    int32_t lastPresetReq[4];   /**< Final, final-1, -2, -3 preset request */
+    int32_t lastPresetReqFom[4]; /**< FoM of each preset request */
+    char physicalPin[ARIES_SNAPSHOT_PIN_NAME_LEN]; /**< Physical pin name */
+} AriesSnapshotRxType;
+
+/**
+ * @brief Struct defining the Retimer core state of a lane path in a snapshot
+ */
+typedef struct AriesSnapshotCore
+{
+    float tempC;                /**< Lane temperature (Celsius) */
+    int32_t deskewNs;           /**< Path deskew (ns) */
+    int32_t tempAlert;          /**< Lane temperature alert */
+    int32_t pathFWState;        /**< Path FW state */
+    int32_t pathHWState;        /**< Path HW state */
+} AriesSnapshotCoreType;
+
+/**
+ * @brief Struct defining the lane record of a snapshot
+ */
+typedef struct AriesSnapshotLane
+{
+    int32_t laneIndex;          /**< Logical lane index in the link */
+    int32_t physicalLane;       /**< Physical lane num */
+    AriesSnapshotTxType usppTx; /**< USPP Tx */
+    AriesSnapshotRxType usppRx; /**< USPP Rx */
+    AriesSnapshotCoreType usCore; /**< Upstream path */
+    AriesSnapshotCoreType dsCore; /**< Downstream path */
+    AriesSnapshotTxType dsppTx; /**< DSPP Tx */
+    AriesSnapshotRxType dsppRx; /**< DSPP Rx */
+} AriesSnapshotLaneType;
+
+/**
+ * @brief Struct defining a read-only mapping of a snapshot file
+ */
+typedef struct AriesSnapshot
+{
+    const uint8_t* base;    /**< Mapped file */
+    size_t size;            /**< Size of the mapping, in bytes */
+    const AriesSnapshotHeaderType* header; /**< File header */
+    const AriesSnapshotSectionType* sections; /**< Section table */
+    int numLanes;           /**< Num lane records */
+    int numLogs;            /**< Num log sections */
+} AriesSnapshotType;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,277 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_async.h
+ * @brief Definition of the async execution layer for the SDK. Operations are
+ * queued on a worker thread per I2C bus (AriesDeviceType.i2cBus), so that
+ * operations on different buses run in parallel while each bus is only
+ * accessed by its own worker. The caller is notified through a completion
+ * callback, or polls/waits on the request.
+ */
+
+#ifndef ASTERA_ARIES_SDK_ASYNC_H_
+#define ASTERA_ARIES_SDK_ASYNC_H_
+
+#include "aries_globals.h"
+#include "aries_error.h"
+#include "aries_api_types.h"
+#include "astera_log.h"
+#include "aries_api.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Submit an operation to the worker of the device's I2C bus. The
+ * worker is started on first use of the bus. The request fields device, fn,
+ * callback and userData are set from the arguments; other fields used by fn
+ * (link, image, legacyMode, arg) must be set by the caller beforehand.
+ * While ariesAsyncShutdown() runs, submits fail with
+ * ARIES_ASYNC_WORKER_FAILURE. A request which cannot be queued is marked
+ * done with that return code.
+ *
+ * @param[in,out] request   Caller owned request, valid until done
+ * @param[in]     device    Device operated on
+ * @param[in]     fn        Operation to run on the bus worker
+ * @param[in]     callback  Completion callback, run on the bus worker (may be
+ *                          NULL)
+ * @param[in]     userData  Passed to completion callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncSubmit(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        AriesAsyncFnType fn,
+        AriesAsyncCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Submit ariesCheckLinkHealth() for a link
+ *
+ * @param[in,out] request   Caller owned request, valid until done
+ * @param[in]     link      Link to check
+ * @param[in]     callback  Completion callback (may be NULL)
+ * @param[in]     userData  Passed to completion callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncCheckLinkHealth(
+        AriesAsyncRequestType* request,
+        AriesLinkType* link,
+        AriesAsyncCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Submit ariesCheckDeviceHealth() for a device
+ *
+ * @param[in,out] request   Caller owned request, valid until done
+ * @param[in]     device    Device to check
+ * @param[in]     callback  Completion callback (may be NULL)
+ * @param[in]     userData  Passed to completion callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncCheckDeviceHealth(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        AriesAsyncCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Submit ariesGetCurrentTemp() for a device
+ *
+ * @param[in,out] request   Caller owned request, valid until done
+ * @param[in]     device    Device to read
+ * @param[in]     callback  Completion callback (may be NULL)
+ * @param[in]     userData  Passed to completion callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncGetCurrentTemp(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        AriesAsyncCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Submit ariesLinkDumpDebugInfo() (LTSSM logs and detailed state) for
+ * a link
+ *
+ * @param[in,out] request   Caller owned request, valid until done
+ * @param[in]     link      Link to dump
+ * @param[in]     callback  Completion callback (may be NULL)
+ * @param[in]     userData  Passed to completion callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncLinkDumpDebugInfo(
+        AriesAsyncRequestType* request,
+        AriesLinkType* link,
+        AriesAsyncCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Submit ariesWriteEEPROMImage() for a device
+ *
+ * @param[in,out] request     Caller owned request, valid until done
+ * @param[in]     device      Device whose EEPROM is written
+ * @param[in]     image       FW image, valid until done
+ * @param[in]     legacyMode  Write EEPROM in slower legacy mode
+ * @param[in]     callback    Completion callback (may be NULL)
+ * @param[in]     userData    Passed to completion callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncWriteEEPROMImage(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        uint8_t* image,
+        bool legacyMode,
+        AriesAsyncCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Check the health of a set of links, which may be spread over
+ * several devices and I2C buses. The links are grouped by the I2C bus of their
+ * device and checked on the bus workers, so buses are swept in parallel and
+ * the sweep takes as long as the busiest bus. For each link,
+ * ariesCheckLinkHealth() is run, preceded by ariesCheckDeviceHealth() for the
+ * first link of each device. The call blocks until all links are checked.
+ *
+ * @param[in]  links     Array of links to check
+ * @param[in]  numLinks  Number of links
+ * @param[out] results   Array of numLinks results, in the order of links
+ * @return     AriesErrorType - Aries error code (ARIES_SUCCESS if all links
+ *             were checked, per link return codes are in results)
+ */
+AriesErrorType ariesFleetCheckHealth(
+        AriesLinkType** links,
+        int numLinks,
+        AriesFleetHealthResultType* results);
+
+/**
+ * @brief Start a FW update of a set of devices, which may be spread over
+ * several I2C buses. The image is loaded once and the devices are queued on
+ * the workers of their buses, so devices on different buses are updated in
+ * parallel and devices sharing a bus one after the other. Each device is
+ * updated with ariesUpdateFirmwareImage(), or ariesUpdateFirmwareDeltaImage()
+ * if delta is set. A device whose update fails, or which cannot be queued, is
+ * marked failed in results without affecting the other devices. The call
+ * returns once all devices are queued; use ariesFleetUpdateFirmwareProgress()
+ * to follow the update and ariesFleetUpdateFirmwareWait() to complete it.
+ *
+ * @param[out] update      Fleet update, valid until waited on
+ * @param[in]  devices     Array of devices to update
+ * @param[in]  numDevices  Number of devices
+ * @param[in]  filename    Filename of the FW image
+ * @param[in]  fileType    File type (IHX, BIN or CACHE)
+ * @param[in]  delta       Rewrite only the EEPROM pages which differ
+ * @param[out] results     Array of numDevices results, in the order of
+ *                         devices, valid until waited on
+ * @return     AriesErrorType - Aries error code (ARIES_SUCCESS if the image
+ *             was loaded, per device return codes are in results)
+ */
+AriesErrorType ariesFleetUpdateFirmwareStart(
+        AriesFleetUpdateType* update,
+        AriesDeviceType** devices,
+        int numDevices,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        bool delta,
+        AriesFleetUpdateResultType* results);
+
+/**
+ * @brief Get the progress of a fleet FW update (without blocking). The
+ * aggregate progress, throughput and estimated time to completion are set in
+ * progress, and the progress of each device in its result. The estimate
+ * assumes the remaining devices take as long as the devices already updated,
+ * and that the bus with the most remaining work finishes last.
+ *
+ * @param[in]  update    Fleet update in progress
+ * @param[out] progress  Aggregate progress
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesFleetUpdateFirmwareProgress(
+        AriesFleetUpdateType* update,
+        AriesFleetUpdateProgressType* progress);
+
+/**
+ * @brief Block until all devices of a fleet FW update are done, and release
+ * the image and requests of the update
+ *
+ * @param[in,out] update  Fleet update in progress
+ * @return     AriesErrorType - Aries error code (ARIES_SUCCESS if all devices
+ *             were updated, else the return code of the first failed device)
+ */
+AriesErrorType ariesFleetUpdateFirmwareWait(
+        AriesFleetUpdateType* update);
+
+/**
+ * @brief Update the FW of a set of devices and block until all are done.
+ * Same as ariesFleetUpdateFirmwareStart() followed by
+ * ariesFleetUpdateFirmwareWait().
+ *
+ * @param[in]  devices     Array of devices to update
+ * @param[in]  numDevices  Number of devices
+ * @param[in]  filename    Filename of the FW image
+ * @param[in]  fileType    File type (IHX, BIN or CACHE)
+ * @param[in]  delta       Rewrite only the EEPROM pages which differ
+ * @param[out] results     Array of numDevices results, in the order of
+ *                         devices
+ * @return     AriesErrorType - Aries error code (ARIES_SUCCESS if all devices
+ *             were updated, per device return codes are in results)
+ */
+AriesErrorType ariesFleetUpdateFirmware(
+        AriesDeviceType** devices,
+        int numDevices,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        bool delta,
+        AriesFleetUpdateResultType* results);
+
+/**
+ * @brief Check if a submitted operation is done (without blocking)
+ *
+ * @param[in]  request   Submitted request
+ * @return     bool - true if operation and its callback completed
+ */
+bool ariesAsyncPoll(
+        AriesAsyncRequestType* request);
+
+/**
+ * @brief Block until a submitted operation is done
+ *
+ * @param[in]  request   Submitted request
+ * @return     AriesErrorType - Return code of the operation
+ */
+AriesErrorType ariesAsyncWait(
+        AriesAsyncRequestType* request);
+
+/**
+ * @brief Stop all bus workers once their queued operations are done. Submits
+ * are rejected until all workers have stopped, and workers are started again
+ * by the next submit after that. Waiters of queued operations are woken as
+ * the operations complete.
+ *
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesAsyncShutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASTERA_ARIES_SDK_ASYNC_H_ */
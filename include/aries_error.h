@@ -86,7 +86,27 @@ typedef enum
     ARIES_FUNCTION_UNSUCCESSFUL = -16,
 
     /** Temperature read value not ready */
-    ARIES_TEMP_READ_NOT_READY = -17
+    ARIES_TEMP_READ_NOT_READY = -17,
+
+    /** No free slot to track I2C transaction stats */
+    ARIES_I2C_STATS_TABLE_FULL = -18,
+
+    /** I2C driver lock could not be initialized */
+    ARIES_I2C_LOCK_INIT_FAILURE = -19,
+
+    /** No free async bus worker slot, or worker could not be started */
+    ARIES_ASYNC_WORKER_FAILURE = -20,
+
+    /** Shared memory segment could not be created, opened or mapped, or has
+     *  an incompatible layout */
+    ARIES_SHM_FAILURE = -21,
+
+    /** No consistent shared memory snapshot (publisher mid-update) */
+    ARIES_SHM_SNAPSHOT_BUSY = -22,
+
+    /** Snapshot file could not be written, opened or mapped, or is not a
+     *  valid snapshot */
+    ARIES_SNAPSHOT_FAILURE = -23
 } AriesErrorType;
 
 #ifdef __cplusplus
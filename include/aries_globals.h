@@ -66,6 +66,8 @@
 #define ARIES_MM_CALC_CHECKSUM_WAIT 6
 /** Time allocated to calculate checksum (micro secs) */
 #define ARIES_MM_CALC_CHECKSUM_TRY_TIME 10000
+/** Num tries polling for a checksum without the initial wait (covers a bank) */
+#define ARIES_MM_CALC_CHECKSUM_POLL_TRIES 1100
 /** Time allocated for Rx adaptation (microseconds) */
 #define ARIES_PIPE_RXEQEVAL_TIME_US 100000
 /** Time allocated for PMA register access to complete (microseconds) */
@@ -91,12 +93,21 @@
 /** Num EEPROM CRC blocks */
 #define ARIES_EEPROM_MAX_NUM_CRC_BLOCKS 10
 
+/** Num writes of a page in a delta update before it is reported as failed */
+#define ARIES_EEPROM_DELTA_PAGE_WRITE_TRIES 3
+
 //////////////////////////////////////
 ////////// Delay parameters //////////
 //////////////////////////////////////
 
 /** Wait time after completing an EEPROM block write-thru */
 #define ARIES_DATA_BLOCK_PROGRAM_TIME_USEC  10000
+/** Max wait for the EEPROM to complete programming a page (microseconds) */
+#define ARIES_EEPROM_PAGE_PROGRAM_TIMEOUT_USEC  10000
+/** Time allowed for an EEPROM completion poll read (microseconds) */
+#define ARIES_EEPROM_PAGE_PROGRAM_POLL_USEC 500
+/** Num 1 ms bins of the EEPROM page program time histogram */
+#define ARIES_EEPROM_PROGRAM_TIME_HIST_BINS 11
 /** Wait time after setting manual training */
 #define ARIES_MAN_TRAIN_WAIT_SEC           0.01
 
@@ -116,6 +127,13 @@
 /** Path Micro print buffer size */
 #define ARIES_PM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE 256
 
+/** Max num bytes moved by one Path Micro indirect SRAM access */
+#define ARIES_PM_IND_ACCESS_MAX_BYTES 4
+
+/** Num Main Micro indirect SRAM byte accesses pipelined in one I2C transfer
+ *  (three register accesses each) */
+#define ARIES_MM_IND_PIPELINE_BYTES (ARIES_I2C_SUBMIT_MAX_OPS / 3)
+
 ///////////////////////////////////////////
 ////////// Sides and quad slices //////////
 ///////////////////////////////////////////
@@ -188,6 +206,176 @@
 /** Num DPLL frequency reading tries */
 #define ARIES_NUM_DPLL_FREQ_READING_TRIES 5
 
+//////////////////////////////////////////////////////////
+////////////////// I2C Transaction Lists /////////////////
+//////////////////////////////////////////////////////////
+
+/** Max num register accesses issued in one low-level I2C transfer */
+#define ARIES_I2C_SUBMIT_MAX_OPS 16
+
+/** Max num bytes in one register access of a transaction list */
+#define ARIES_I2C_SUBMIT_MAX_OP_BYTES 32
+
+/** Max SMBus block length of one register access (incl. header and PEC) */
+#define ARIES_I2C_SUBMIT_MAX_FRAME_LEN (ARIES_I2C_SUBMIT_MAX_OP_BYTES + 5)
+
+//////////////////////////////////////////////////////////
+////////////////// Link RX PMA Capture ///////////////////
+//////////////////////////////////////////////////////////
+
+/** PMA reads per lane and side by ariesLinkCaptureRxPmaState(): 14 regs and
+ * the DPLL code readings */
+#define ARIES_LINK_RX_CAPTURE_REGS_PER_LANE (14 + ARIES_NUM_DPLL_FREQ_READINGS)
+
+/** Bytes of gp_ctrl_sts_struct read by ariesGetPathCtrlSts(): FW state
+ * through last_eq_final_req_pst_ln1 */
+#define ARIES_CTRL_STS_STRUCT_CAPTURE_NUM_BYTES 53
+
+/** Bus transactions per PMA read via Main Micro, when not busy */
+#ifdef ARIES_I2C_BATCH
+#define ARIES_PMA_READ_NUM_TRANSACTIONS 1
+#else
+#define ARIES_PMA_READ_NUM_TRANSACTIONS 3
+#endif
+
+//////////////////////////////////////////////////////////
+////////////////// Health Metric Scheduler ///////////////
+//////////////////////////////////////////////////////////
+
+/** Default refresh period of link state, in ms */
+#define ARIES_HEALTH_LINK_STATE_PERIOD_MS 1000
+
+/** Default refresh period of temperature, in ms */
+#define ARIES_HEALTH_TEMP_PERIOD_MS 1000
+
+/** Default refresh period of recovery count, in ms */
+#define ARIES_HEALTH_RECOVERY_COUNT_PERIOD_MS 1000
+
+/** Default refresh period of min FoM, in ms */
+#define ARIES_HEALTH_FOM_PERIOD_MS 10000
+
+/** Default refresh period of DPLL median frequency, in ms */
+#define ARIES_HEALTH_DPLL_PERIOD_MS 60000
+
+/** Metrics due within this fraction of their period join the current pass */
+#define ARIES_HEALTH_MERGE_WINDOW_DIV 10
+
+//////////////////////////////////////////////////////////
+//////////////// Shared Memory Publication ///////////////
+//////////////////////////////////////////////////////////
+
+/** Default name of the shared memory state segment */
+#define ARIES_SHM_DEFAULT_NAME "/aries-sdk-state"
+
+/** Shared memory segment magic ("ARSH") */
+#define ARIES_SHM_MAGIC 0x48535241
+
+/** Shared memory segment layout version */
+#define ARIES_SHM_VERSION 1
+
+/** Max length of a pin name copied into the shared memory segment */
+#define ARIES_SHM_PIN_NAME_LEN 16
+
+/** Max num tries to take a consistent snapshot of an entry */
+#define ARIES_SHM_READ_TRIES 10000
+
+//////////////////////////////////////////////////////////
+////////////////// LTSSM Log Decoder /////////////////////
+//////////////////////////////////////////////////////////
+
+/** Max num variables of a logger format (each logged as 2 bytes, MSB first) */
+#define ARIES_LTSSM_FMT_MAX_VARS 5
+
+/** Max length of a logger message: format ID, link/path byte (Main Micro
+ * only) and variables */
+#define ARIES_LTSSM_MSG_MAX_BYTES (2 + (2 * ARIES_LTSSM_FMT_MAX_VARS))
+
+/** Max length of the message text of a logger format (incl. terminator) */
+#define ARIES_LTSSM_FMT_TEXT_LEN 128
+
+/** Logger time stamp ("%x ms" variable) unit, in ms */
+#define ARIES_LTSSM_TIME_UNIT_MS 0.065536
+
+/** Main Micro link/path byte of a message with no link or path */
+#define ARIES_LTSSM_NO_LINK_PATH 0xff
+
+/** Num logger format IDs (format ID is one byte, 0 is not a format) */
+#define ARIES_LTSSM_NUM_FMT_IDS 256
+
+/** Num consumed log bytes kept by a log tail to detect the writer lapping it */
+#define ARIES_LTSSM_TAIL_GUARD_BYTES 4
+
+/** Max num tries to read a consistent logger write offset */
+#define ARIES_LTSSM_TAIL_OFFSET_READ_TRIES 8
+
+//////////////////////////////////////////////////////////
+/////////////////// Binary Snapshots /////////////////////
+//////////////////////////////////////////////////////////
+
+/** Snapshot file magic ("ARSN") */
+#define ARIES_SNAPSHOT_MAGIC 0x4e535241
+
+/** Snapshot format major version (incompatible layout changes) */
+#define ARIES_SNAPSHOT_VERSION_MAJOR 1
+
+/** Snapshot format minor version (fields appended to records) */
+#define ARIES_SNAPSHOT_VERSION_MINOR 0
+
+/** Max num sections of a snapshot (schema, device, link, lanes, logs) */
+#define ARIES_SNAPSHOT_MAX_SECTIONS 24
+
+/** Alignment of snapshot sections, in bytes */
+#define ARIES_SNAPSHOT_ALIGN 8
+
+/** Max length of a pin name stored in a snapshot (incl. terminator) */
+#define ARIES_SNAPSHOT_PIN_NAME_LEN 16
+
+/** Max length of a schema field name (incl. terminator) */
+#define ARIES_SNAPSHOT_FIELD_NAME_LEN 32
+
+//////////////////////////////////////////////////////////
+/////////////////// Firmware Image Cache /////////////////
+//////////////////////////////////////////////////////////
+
+/** FW image cache file magic ("ARFW") */
+#define ARIES_FW_IMAGE_CACHE_MAGIC 0x57465241
+
+/** FW image cache format major version (incompatible layout changes) */
+#define ARIES_FW_IMAGE_CACHE_VERSION_MAJOR 2
+
+/** FW image cache format minor version (fields appended to the header) */
+#define ARIES_FW_IMAGE_CACHE_VERSION_MINOR 0
+
+/** Size of the blocks whose byte sums are stored in a FW image cache */
+#define ARIES_FW_IMAGE_CACHE_BLOCK_SIZE ARIES_EEPROM_PAGE_SIZE
+
+/** File offset of the image in a FW image cache (page aligned for mmap) */
+#define ARIES_FW_IMAGE_CACHE_DATA_OFFSET 8192
+
+/** Size of the read buffer of the intel hex decoder, in bytes */
+#define ARIES_IHX_READ_BUFFER_SIZE 16384
+
+//////////////////////////////////////////////////////////
+/////////////////// Async Bus Workers ////////////////////
+//////////////////////////////////////////////////////////
+
+/** Max number of I2C buses with an async worker thread */
+#define ARIES_ASYNC_MAX_BUSES 16
+
+//////////////////////////////////////////////////////////
+//////////////// I2C Transaction Stats ///////////////////
+//////////////////////////////////////////////////////////
+
+/** Max number of I2C drivers with transaction stats enabled */
+#define ARIES_I2C_STATS_MAX_DRIVERS 16
+
+/** Num I2C transaction latency buckets */
+#define ARIES_I2C_STATS_NUM_LATENCY_BUCKETS 8
+
+/** Upper bound (in us) of first latency bucket. Each next bucket doubles it,
+ * and the last bucket has no upper bound */
+#define ARIES_I2C_STATS_LATENCY_BUCKET_BASE_US 64
+
 ///////////////////////////////////////////////////////////
 ///////////////////// PIPE Interface //////////////////////
 ///////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include <stdbool.h>
 #include <unistd.h>
 #include <math.h>
+#include <time.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -120,12 +121,41 @@ int asteraI2CReadBlockData(
         uint8_t bufLen,
         uint8_t* buf);
 
+/**
+ * @brief Low-level I2C method to execute a list of SMBus block transactions as
+ * one bus transfer, with a repeated start between consecutive transactions.
+ *
+ * @warning THIS FUNCTION MUST BE IMPLEMENTED IN THE USER'S APPLICATION WHEN
+ * THE SDK IS BUILT WITH ARIES_I2C_BATCH DEFINED. It is not used otherwise.
+ *
+ * For example, if using linux/i2c-dev.h, a block write maps to one message
+ * holding the command code and data, and a block read maps to a one byte
+ * write message (the command code) followed by an I2C_M_RD message, all
+ * passed to a single I2C_RDWR ioctl.
+ *
+ * @param[in]     handle     Handle to I2C driver
+ * @param[in,out] txns       Transactions to execute. On return, txns[i].rc
+ *                           holds the number of bytes read for block reads
+ *                           (zero for block writes), or a negative value if
+ *                           the transaction was not completed
+ * @param[in]     numTxns    Number of transactions
+ * @return     int - Zero if all transactions completed, else a negative value
+ */
+int asteraI2CTransfer(
+        int handle,
+        AriesI2CTransactionType* txns,
+        int numTxns);
+
 /**
  * @brief Low-level I2C method to implement a lock around I2C transactions such
  * that a set of transactions can be atomic.
  *
  * @warning THIS FUNCTION MUST BE IMPLEMENTED IN THE USER'S APPLICATION.
  *
+ * Threads sharing an I2C driver are already serialized by ariesLock(). This
+ * method should exclude other processes (and other handles) using the bus,
+ * e.g. with flock() on the i2c-dev file handle.
+ *
  * @param[in]  handle Handle to I2C driver
  * @return     int - Error code
  */
@@ -202,6 +232,24 @@ AriesErrorType ariesReadBlockData(
         uint8_t numBytes,
         uint8_t* values);
 
+/**
+ * @brief Submit a list of register reads and writes to Aries over I2C. The
+ * list is executed in order, atomically with respect to other users of the
+ * driver lock. When the SDK is built with ARIES_I2C_BATCH and the Astera I2C
+ * format is used, up to ARIES_I2C_SUBMIT_MAX_OPS accesses are issued in one
+ * call to asteraI2CTransfer(). Otherwise each access is issued with
+ * ariesReadBlockData() or ariesWriteBlockData().
+ *
+ * @param[in]     i2cDriver  I2C driver responsible for the transaction(s)
+ * @param[in,out] ops        Register accesses (values filled in for reads)
+ * @param[in]     numOps     Number of register accesses
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesI2CSubmit(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2COpType* ops,
+        int numOps);
+
 /**
  * @brief Read a data byte from Aries over I2C
  *
@@ -216,8 +264,13 @@ AriesErrorType ariesReadByteData(
         uint8_t* value);
 
 /**
- * @brief Read multiple (up to eight) data bytes from micro SRAM over I2C for
- * A0. Returns a negative error code, or zero on success
+ * @brief Read multiple data bytes from micro SRAM over I2C for A0. Returns a
+ * negative error code, or zero on success
+ *
+ * The indirect interface transfers one byte per access. Each access writes
+ * the address and command in one burst, and reads back status and data
+ * directly behind it (one bus transfer when built with ARIES_I2C_BATCH).
+ * Status is only polled further if the access is still busy.
  *
  * @param[in]  i2cDriver  I2C driver responsible for the transaction(s)
  * @param[in]  microIndStructOffset   Micro Indirect Struct Offset
@@ -319,6 +372,24 @@ AriesErrorType ariesReadBlockDataMainMicroIndirect(
         uint8_t numBytes,
         uint8_t* values);
 
+/**
+ * @brief Read an arbitrary length region (e.g. link struct, print buffer) of
+ * Main micro SRAM over I2C. The region is read under one driver lock, with
+ * the fewest indirect accesses the Main Micro assist interface allows.
+ * Returns a negative error code, else zero on success
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in]  address      Main micro SRAM address from which to read
+ * @param[in]  numBytes     Number of bytes to read
+ * @param[out] values       Pointer to array storing numBytes bytes of data
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesReadBlockDataMainMicroIndirectBulk(
+        AriesI2CDriverType* i2cDriver,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values);
+
 /**
  * @brief Write a data byte at specifed address to Main micro SRAM Aries
  * over I2C. Returns a negative error code, else zero on success.
@@ -385,6 +456,26 @@ AriesErrorType ariesReadBlockDataPathMicroIndirect(
         uint8_t numBytes,
         uint8_t* values);
 
+/**
+ * @brief Read an arbitrary length region (e.g. print buffer) of Path micro
+ * SRAM over I2C. The region is read under one driver lock, in the largest
+ * chunks one Path micro indirect access moves. Returns a negative error
+ * code, else zero on success
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in]  pathID       Path micro ID (e.g. 0, 1, ..., 15)
+ * @param[in]  address      Path micro SRAM address from which to read
+ * @param[in]  numBytes     Number of bytes to read
+ * @param[out] values       Pointer to array storing numBytes bytes of data
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesReadBlockDataPathMicroIndirectBulk(
+        AriesI2CDriverType* i2cDriver,
+        uint8_t pathID,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values);
+
 /**
  * @brief Write one byte of data byte at specified address to Path micro SRAM
  * Aries over I2C. Returns a negative error code, else zero on success.
@@ -511,6 +602,24 @@ AriesErrorType ariesReadWordPmaMainMicroIndirect(
         uint16_t pmaAddr,
         uint8_t* data);
 
+/**
+ * @brief Read a list of PMA registers over I2C using the
+ * 'main-micro-assisted' indirect method, under one driver lock. Each read
+ * sets up the address and command in one write, and reads status and data
+ * right behind it (issued as one transfer with ARIES_I2C_BATCH). The mailbox is
+ * only polled further while busy. Order the list by side and quad slice to
+ * keep accesses to one PMA together.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in,out]  reads    PMA reads (data is filled in)
+ * @param[in]  numReads     Number of PMA reads
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesReadWordsPmaMainMicroIndirect(
+        AriesI2CDriverType* i2cDriver,
+        AriesPmaReadType* reads,
+        int numReads);
+
 /**
  * @brief Write 2 bytes of data to PMA register over I2C using the
  * 'main-micro-assisted' indirect method. This method is necessary during
@@ -636,7 +745,22 @@ AriesErrorType ariesWriteRetimerRegister(
         uint8_t* data);
 
 /**
- * @brief Set lock on bus (Aries transaction)
+ * @brief Initialize the lock of an I2C driver. Called on first use of the
+ * driver (or by ariesInitDevice()) if lockInit is not set. Initialization is
+ * serialized, so threads may share a driver from its first use; calls on an
+ * already initialized driver do nothing. lockInit must be cleared before the
+ * driver is first used.
+ *
+ * @param[in]  i2cDriver    I2C driver
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLockInit(
+        AriesI2CDriverType* i2cDriver);
+
+/**
+ * @brief Set lock on bus (Aries transaction). The lock is reentrant. The
+ * outermost lock takes a mutex shared by threads using this driver, then the
+ * cross-process bus lock implemented by asteraI2CBlock().
  *
  * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
  * @return     AriesErrorType - Aries error code
@@ -653,6 +777,138 @@ AriesErrorType ariesLock(
 AriesErrorType ariesUnlock(
         AriesI2CDriverType* i2cDriver);
 
+/**
+ * @brief Get bus lock contention statistics of an I2C driver
+ *
+ * @param[in]  i2cDriver    I2C driver
+ * @param[out] stats        Statistics snapshot
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLockStatsGet(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CLockStatsType* stats);
+
+/**
+ * @brief Clear bus lock contention statistics of an I2C driver
+ *
+ * @param[in]  i2cDriver    I2C driver
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLockStatsClear(
+        AriesI2CDriverType* i2cDriver);
+
+/**
+ * @brief Enable or disable I2C transaction stats for an I2C driver.
+ *
+ * Stats are disabled by default. Once enabled, every SMBus transaction issued
+ * through the driver is counted and attributed to the public API which
+ * started it (see AriesI2CStatsApiType). Enabling clears the counters.
+ * The stats functions may be called concurrently for different drivers.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in]  enable       Enable (true) or disable (false) stats
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesI2CStatsEnable(
+        AriesI2CDriverType* i2cDriver,
+        bool enable);
+
+/**
+ * @brief Get a snapshot of the I2C transaction stats for an I2C driver.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[out] stats        Snapshot of the counters
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesI2CStatsGet(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CStatsType* stats);
+
+/**
+ * @brief Clear the I2C transaction stats for an I2C driver.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesI2CStatsClear(
+        AriesI2CDriverType* i2cDriver);
+
+/**
+ * @brief Get the name of a public API tracked by the I2C transaction stats.
+ *
+ * @param[in]  api      Tracked API
+ * @return     const char* - API name
+ */
+const char* ariesI2CStatsApiName(
+        AriesI2CStatsApiType api);
+
+/**
+ * @brief Mark the start of a public API for I2C transaction stats.
+ *
+ * Transactions are attributed to the outermost tracked API of the calling
+ * thread, so calls made from within another tracked API do not change the
+ * attribution. Threads sharing a driver are attributed separately.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in]  api          Tracked API being started
+ * @return     AriesI2CStatsApiType - API active before this call (pass to
+ *             ariesI2CStatsApiExit())
+ */
+AriesI2CStatsApiType ariesI2CStatsApiEnter(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CStatsApiType api);
+
+/**
+ * @brief Mark the end of a public API for I2C transaction stats.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in]  prevApi      Value returned by ariesI2CStatsApiEnter()
+ */
+void ariesI2CStatsApiExit(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CStatsApiType prevApi);
+
+/**
+ * @brief Get start timestamp of an SMBus transaction.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @return     uint64_t - Timestamp (us), or 0 if stats are disabled
+ */
+uint64_t ariesI2CStatsStart(
+        AriesI2CDriverType* i2cDriver);
+
+/**
+ * @brief Record a completed SMBus transaction.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ * @param[in]  isRead       Read (true) or write (false) transaction
+ * @param[in]  numBytes     Num bytes passed to the low-level I2C method
+ * @param[in]  failed       Transaction returned an error
+ * @param[in]  startUs      Value returned by ariesI2CStatsStart()
+ */
+void ariesI2CStatsRecordTransaction(
+        AriesI2CDriverType* i2cDriver,
+        bool isRead,
+        int numBytes,
+        bool failed,
+        uint64_t startUs);
+
+/**
+ * @brief Record a block read retry.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ */
+void ariesI2CStatsRecordReadRetry(
+        AriesI2CDriverType* i2cDriver);
+
+/**
+ * @brief Record an indirect access status poll.
+ *
+ * @param[in]  i2cDriver    I2C driver responsible for the transaction(s)
+ */
+void ariesI2CStatsRecordPoll(
+        AriesI2CDriverType* i2cDriver);
+
 
 #ifdef __cplusplus
 }
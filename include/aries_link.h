@@ -59,6 +59,36 @@ AriesErrorType ariesLinkPrintDetailedState(
         const char* basepath,
         const char* filename);
 
+// Capture the detailed link state and micro logs, and write them to a
+// binary snapshot file (basepath/filename_linkId.snap) with a single write.
+// Read it back with ariesSnapshotOpen() (aries_snapshot.h)
+AriesErrorType ariesLinkWriteSnapshot(
+        AriesLinkType* link,
+        const char* basepath,
+        const char* filename);
+
+// Read the micro logger entries in log order. entries must hold the print
+// buffer (ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE entries for the link log).
+// atBoundary is set if the entries start at a message boundary: in one batch
+// mode, and for a wrap-around buffer which has not wrapped yet (returned from
+// offset 0). Otherwise the oldest entries may be the rest of an overwritten
+// message
+AriesErrorType ariesReadLog(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType log,
+        AriesLTSSMEntryType* entries,
+        int* numEntries,
+        bool* complete,
+        bool* atBoundary);
+
+// Check if print buffer bytes were never written: they are all zero, and
+// more of them than a written message can hold. Given the bytes from the
+// write offset to the end of a wrap-around buffer, the buffer has not
+// wrapped yet
+bool ariesLogUnused(
+        const uint8_t* values,
+        int numValues);
+
 // Print the micro logger entries
 AriesErrorType ariesPrintLog(
         AriesLinkType* link,
@@ -0,0 +1,247 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_ltssm.h
+ * @brief Definition of the LTSSM log decoder. The Main Micro and Path Micro
+ * print buffers hold messages made of a format ID byte, a link/path byte
+ * (Main Micro only) and a 2-byte variable per % of the format text, as
+ * decoded by scripts/print_link_logs.py. The decoder frames the messages
+ * with the Main Micro and Path Micro format tables of the FW build, and
+ * delivers them as events (LTSSM state transitions, EQ phases, rate changes,
+ * other messages) to a callback and/or an array.
+ */
+
+#ifndef ASTERA_ARIES_SDK_LTSSM_H_
+#define ASTERA_ARIES_SDK_LTSSM_H_
+
+#include "aries_globals.h"
+#include "aries_error.h"
+#include "aries_api_types.h"
+#include "astera_log.h"
+#include "aries_link.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize a decoder with the Main Micro and Path Micro format
+ * tables. Main Micro log entries are decoded with the Main Micro table, and
+ * Path Micro log entries with the Path Micro table.
+ *
+ * @param[out] decoder    LTSSM log decoder
+ * @param[in]  mmFmts     Main Micro format table, valid for the life of the
+ *                        decoder
+ * @param[in]  numMmFmts  Num formats in Main Micro table
+ * @param[in]  pmFmts     Path Micro format table, valid for the life of the
+ *                        decoder
+ * @param[in]  numPmFmts  Num formats in Path Micro table
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMDecoderInit(
+        AriesLTSSMDecoderType* decoder,
+        const AriesLTSSMFmtType* mmFmts,
+        int numMmFmts,
+        const AriesLTSSMFmtType* pmFmts,
+        int numPmFmts);
+
+/**
+ * @brief Deliver decoded events to a callback
+ *
+ * @param[in,out] decoder   LTSSM log decoder
+ * @param[in]     callback  Event callback (NULL to disable)
+ * @param[in]     userData  Passed to event callback
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMDecoderSetCallback(
+        AriesLTSSMDecoderType* decoder,
+        AriesLTSSMEventCallbackType callback,
+        void* userData);
+
+/**
+ * @brief Store decoded events in an array. Events decoded once the array is
+ * full are counted in numDropped.
+ *
+ * @param[in,out] decoder    LTSSM log decoder
+ * @param[in]     events     Event array (NULL to disable)
+ * @param[in]     maxEvents  Num entries of event array
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMDecoderSetEvents(
+        AriesLTSSMDecoderType* decoder,
+        AriesLTSSMEventType* events,
+        int maxEvents);
+
+/**
+ * @brief Reset the framing of a decoder, e.g. before decoding another log.
+ * A partly read message is discarded. Stored events are kept.
+ *
+ * @param[in,out] decoder   LTSSM log decoder
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMDecoderReset(
+        AriesLTSSMDecoderType* decoder);
+
+/**
+ * @brief Feed log entries to a decoder. The entries must be consecutive
+ * bytes of one log in log order (as returned by ariesReadLog()), and may end
+ * within a message, which is completed by the next feed. Zero bytes in place
+ * of a format ID are skipped. An unknown format ID is delivered as an event
+ * of kind ARIES_LTSSM_EVENT_UNKNOWN, and the rest of the log is skipped
+ * until the decoder is reset, since its messages cannot be framed (the
+ * decoder is then stalled).
+ *
+ * @param[in,out] decoder     LTSSM log decoder
+ * @param[in]     entries     Log entries
+ * @param[in]     numEntries  Num log entries
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMDecoderFeed(
+        AriesLTSSMDecoderType* decoder,
+        const AriesLTSSMEntryType* entries,
+        int numEntries);
+
+/**
+ * @brief Read a log of a link and decode it. The decoder is reset first.
+ * A log which has not wrapped is decoded from its first byte. In a wrapped
+ * print buffer the oldest bytes may be the rest of an overwritten message,
+ * so decoding then starts at the first message boundary of the log.
+ *
+ * @param[in]     link      Pointer to Aries Link struct object
+ * @param[in]     log       The specific log to read from
+ * @param[in,out] decoder   LTSSM log decoder
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMDecodeLog(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType log,
+        AriesLTSSMDecoderType* decoder);
+
+/**
+ * @brief Format the message of an event as scripts/print_link_logs.py does:
+ * a "%x ms" time stamp as milliseconds, %d and %u as decimal, and other
+ * conversions (%x, %c) as 4 hex digits
+ *
+ * @param[in]  event    Decoded event
+ * @param[out] buf      Message buffer
+ * @param[in]  size     Size of message buffer, in bytes
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMEventFormat(
+        const AriesLTSSMEventType* event,
+        char* buf,
+        size_t size);
+
+/**
+ * @brief Load a format table from a text file. Each line holds one format:
+ * "fmtID kind text", where kind is one of "msg", "state", "eq" or "rate",
+ * and text is the rest of the line. Empty lines and lines starting with '#'
+ * are ignored.
+ *
+ * @param[in]  filename  Format table file
+ * @param[out] fmts      Format table
+ * @param[in]  maxFmts   Num entries of format table
+ * @param[out] numFmts   Num formats loaded
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMFmtTableLoad(
+        const char* filename,
+        AriesLTSSMFmtType* fmts,
+        int maxFmts,
+        int* numFmts);
+
+/**
+ * @brief Load a format table from a FW format dictionary, as shipped with
+ * the FW (scripts/link_micro_logs/ALMainFmtIdDict.py for the Main Micro,
+ * ALPathFmtIdDict.py for the Path Micro). The kind of each format is derived
+ * from its text: "%x ms: " followed by an LSM_LNK_STATE_, LSM_LNK_PTH_STATE_
+ * or PSM_ state name is a state transition, an EQ phase (_EQ_P in the name)
+ * or a rate change (RATE_CH in the name), and "Next data rate" is a rate
+ * change. The dictionary must match the FW running on the Retimer.
+ *
+ * @param[in]  filename   FW format dictionary file
+ * @param[out] fmts       Format table
+ * @param[in]  maxFmts    Num entries of format table
+ * @param[out] numFmts    Num formats loaded
+ * @param[out] fwVersion  FW version of the dictionary (may be NULL)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMFmtTableLoadDict(
+        const char* filename,
+        AriesLTSSMFmtType* fmts,
+        int maxFmts,
+        int* numFmts,
+        AriesFWVersionType* fwVersion);
+
+/**
+ * @brief Initialize a tail of an LTSSM log. No bus access.
+ *
+ * @param[out] tail     LTSSM log tail
+ * @param[in]  link     Pointer to Aries Link struct object
+ * @param[in]  log      The specific log to tail
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMTailInit(
+        AriesLTSSMTailType* tail,
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType log);
+
+/**
+ * @brief Read the log bytes appended since the last poll, without pausing
+ * the micro. The first poll returns the whole log. The write offset is
+ * read before and after the bytes, and the last bytes consumed are checked,
+ * so that bytes overwritten before they were read are detected: overrun is
+ * set, and only bytes known to be intact are returned.
+ *
+ * @param[in,out] tail        LTSSM log tail
+ * @param[out]    entries     Log entries in log order; must hold the print
+ *                            buffer of the log
+ * @param[out]    numEntries  Num log entries returned
+ * @param[out]    overrun     Log bytes were lost since the last poll
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMTailPoll(
+        AriesLTSSMTailType* tail,
+        AriesLTSSMEntryType* entries,
+        int* numEntries,
+        bool* overrun);
+
+/**
+ * @brief Poll a log tail and feed the new bytes to a decoder. On an overrun
+ * an event of kind ARIES_LTSSM_EVENT_OVERRUN is delivered. When the new
+ * bytes start at the start of the log, the decoder is reset and decodes
+ * them from their first byte. Otherwise, on the first poll, after an
+ * overrun, and while the decoder is stalled on an unknown format ID, the
+ * decoder is reset and decoding resumes at the first message boundary of
+ * the new bytes. Each tail needs its own decoder.
+ *
+ * @param[in,out] tail      LTSSM log tail
+ * @param[in,out] decoder   LTSSM log decoder of the tail
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLTSSMTailDecode(
+        AriesLTSSMTailType* tail,
+        AriesLTSSMDecoderType* decoder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASTERA_ARIES_SDK_LTSSM_H_ */
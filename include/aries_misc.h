@@ -140,6 +140,23 @@ AriesErrorType ariesI2CMasterRewriteAndVerifyByte(
         int address,
         uint8_t* value);
 
+/**
+ * @brief Read back a byte from EEPROM to check if a write has completed. The
+ * EEPROM does not acknowledge reads during its write cycle, in which case
+ * the byte does not match, and the TX abort of the I2C Master is cleared.
+ *
+ * @param[in]  i2cDriver  Aries i2c driver
+ * @param[in]  address    EEPROM address (within the current page)
+ * @param[in]  expected   Expected (written) value
+ * @param[out] match      Flag set if the EEPROM returned the expected value
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesI2CMasterPollByte(
+        AriesI2CDriverType* i2cDriver,
+        int address,
+        uint8_t expected,
+        bool* match);
+
 /**
  * @brief Write multiple blocks of data to the EEPROM with help from
  * Main Micro
@@ -176,6 +193,21 @@ AriesErrorType ariesI2CMasterGetChecksum(
         uint16_t blockEnd,
         uint32_t* checksum);
 
+/**
+ * @brief Calculate checksum of this EEPROM block, polling the Main Micro for
+ * completion from the start instead of waiting a fixed time first. Use for
+ * short checksums (e.g. a few pages), which complete well within the wait.
+ *
+ * @param[in]  device     Struct containing device information
+ * @param[in]  blockEnd   End of checksum within the block (0 for all bytes)
+ * @param[out] checksum   Checksum value returned by function
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesI2CMasterGetChecksumPolled(
+        AriesDeviceType* device,
+        uint16_t blockEnd,
+        uint32_t* checksum);
+
 /**
  * @brief Set I2C Master frequency
  *
@@ -400,6 +432,25 @@ AriesErrorType ariesGetTxPst(
         int direction,
         int* txPst);
 
+/**
+ * @brief Get TX pre, current and post cursor values with one register read
+ *
+ * @param[in]  link   Link struct created by user
+ * @param[in]  lane    link lane number
+ * @param[in]  direction  link direction
+ * @param[in/out] txPre   tx pre cursor value
+ * @param[in/out] txCur   tx current cursor value
+ * @param[in/out] txPst   tx pst value
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesGetTxCoeffs(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        int* txPre,
+        int* txCur,
+        int* txPst);
+
 /**
  * @brief Get RX polarity code
  *
@@ -507,6 +558,37 @@ AriesErrorType ariesGetRxDfeCode(
         int tapNum,
         int* dfeCode);
 
+/**
+ * @brief: Capture RX termination, ATT, VGA, CTLE boost and pole, DFE taps,
+ * FoM and DPLL code of all lanes of a link on both pseudo ports, into
+ * link->state. All PMA reads are scheduled up front, ordered by side, PMA
+ * and lane, and issued back to back under one driver lock. The DPLL code is
+ * the median of ARIES_NUM_DPLL_FREQ_READINGS readings; lanes whose median is
+ * not a lock frequency are read again as one list, up to
+ * ARIES_NUM_DPLL_FREQ_READING_TRIES times in all
+ *
+ * @param[in,out]  link   Link struct created by user
+ * @param[in]  upstreamSide    PMA side of the upstream pseudo port
+ * @param[in]  downstreamSide  PMA side of the downstream pseudo port
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesLinkCaptureRxPmaState(
+        AriesLinkType* link,
+        int upstreamSide,
+        int downstreamSide);
+
+/**
+ * @brief: Get the bus transaction budget of ariesLinkCaptureRxPmaState()
+ * for the current link width, not counting extra polls of a busy Main Micro
+ * or DPLL code retries
+ *
+ * @param[in]  link   Link struct created by user
+ * @return     int - Number of bus transactions (transfers with
+ *             ARIES_I2C_BATCH)
+ */
+int ariesLinkCaptureRxPmaBudget(
+        AriesLinkType* link);
+
 /**
  * @brief: Get the last speed at which EQ was run (e.g. 3 for Gen-3)
  *
@@ -671,6 +753,23 @@ AriesErrorType ariesGetLastEqPresetReqFOM(
         int reqNum,
         int* val);
 
+/**
+ * @brief Read the FW state and last EQ results of a path from its
+ * gp_ctrl_sts_struct, as one Path micro SRAM region. Offsets into ctrlSts
+ * are the ARIES_CTRL_STS_STRUCT_* offsets
+ *
+ * @param[in]  link   Link struct created by user
+ * @param[in]  lane    link lane number
+ * @param[in]  direction  link direction
+ * @param[out] ctrlSts    ARIES_CTRL_STS_STRUCT_CAPTURE_NUM_BYTES bytes
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesGetPathCtrlSts(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        uint8_t* ctrlSts);
+
 /**
  * @brief Get the format ID at offset int he print buffer
  *
@@ -738,6 +837,64 @@ uint8_t ariesGetPecByte(
         uint8_t* polynomial,
         uint8_t length);
 
+/**
+ * @brief Fold data bytes into a running SMBus PEC (CRC-8). Start from 0 and
+ * call repeatedly to compute a PEC across transaction phases without copying
+ * them into one buffer.
+ *
+ * @param[in] crc     Running PEC (0 for a new computation)
+ * @param[in] data    Data bytes
+ * @param[in] length  Number of data bytes
+ * @return     uint8_t - updated PEC
+ */
+uint8_t ariesPecUpdate(
+        uint8_t crc,
+        uint8_t* data,
+        int length);
+
+/**
+ * @brief Fold one byte into a running SMBus PEC (CRC-8)
+ *
+ * @param[in] crc     Running PEC (0 for a new computation)
+ * @param[in] data    Data byte
+ * @return     uint8_t - updated PEC
+ */
+uint8_t ariesPecUpdateByte(
+        uint8_t crc,
+        uint8_t data);
+
+/**
+ * @brief Calculate PEC byte of an SMBus block write. Covers slave address
+ * and write bit, command code, and data.
+ *
+ * @param[in] slaveAddr  7-bit slave address
+ * @param[in] cmdCode    Command code
+ * @param[in] buf        Data bytes written (PEC byte excluded)
+ * @param[in] length     Number of data bytes
+ * @return     uint8_t - PEC byte
+ */
+uint8_t ariesGetWritePecByte(
+        uint8_t slaveAddr,
+        uint8_t cmdCode,
+        uint8_t* buf,
+        int length);
+
+/**
+ * @brief Check PEC byte of an SMBus block read. Covers slave address and
+ * write bit, command code, slave address and read bit, and data.
+ *
+ * @param[in] slaveAddr  7-bit slave address
+ * @param[in] cmdCode    Command code
+ * @param[in] buf        Data bytes read, followed by PEC byte
+ * @param[in] length     Number of bytes in buf (incl. PEC byte)
+ * @return     bool - true if PEC byte is correct
+ */
+bool ariesCheckReadPecByte(
+        uint8_t slaveAddr,
+        uint8_t cmdCode,
+        uint8_t* buf,
+        int length);
+
 /**
  * @brief Capture the min FoM value seen for a given lane.
  *
@@ -821,12 +978,80 @@ AriesErrorType ariesLoadBinFile(
         uint8_t* mem);
 
 /**
- * @brief This loads an intel hex file into the mem[] array
+ * @brief This loads an intel hex file into the mem[] array. Data records are
+ * placed at their address, including extended segment and extended linear
+ * address records. Files without extended address records continue in the
+ * next 64 KB bank when the record address wraps. Fails on a malformed record
+ * or a record outside the EEPROM.
  */
 AriesErrorType ariesLoadIhxFile(
         const char* filename,
         uint8_t* mem);
 
+/**
+ * @brief Open a firmware image without copying it onto the stack. A binary
+ * file or image cache is mapped read-only and used in place; an intel hex
+ * file is decoded into a heap buffer. The block checksums of an image cache
+ * are checked against its image. Release with ariesFWImageClose().
+ *
+ * @param[out] image     Firmware image
+ * @param[in]  filename  Filename of the FW image
+ * @param[in]  fileType  File type (IHX, BIN or CACHE)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesFWImageOpen(
+        AriesFWImageType* image,
+        const char* filename,
+        AriesFWImageFormatType fileType);
+
+/**
+ * @brief Release a firmware image opened with ariesFWImageOpen()
+ *
+ * @param[in,out] image  Firmware image
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesFWImageClose(
+        AriesFWImageType* image);
+
+/**
+ * @brief Write a firmware image as an image cache. The cache holds the
+ * image at a page aligned offset, the byte sum of every
+ * ARIES_FW_IMAGE_CACHE_BLOCK_SIZE block and the ariesGetEEPROMImageEnd()
+ * result, so it is opened with ARIES_FW_IMAGE_FORMAT_CACHE by mapping it,
+ * without parsing. The size, modification and status change times (with
+ * nanoseconds), device and inode number of the source image file are
+ * recorded to detect a stale cache.
+ *
+ * @param[in]  image           Firmware image
+ * @param[in]  sourceFilename  Image file the image was loaded from (may be
+ *                             NULL)
+ * @param[in]  cacheFilename   Image cache file to write
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesFWImageWriteCache(
+        AriesFWImageType* image,
+        const char* sourceFilename,
+        const char* cacheFilename);
+
+/**
+ * @brief Open a firmware image through an image cache. If the cache was
+ * built from the current image file (same size, times, device and inode), it
+ * is mapped and the image file is not parsed. Else the image file is loaded
+ * with ariesFWImageOpen() and the cache rebuilt. Release with
+ * ariesFWImageClose().
+ *
+ * @param[out] image          Firmware image
+ * @param[in]  filename       Filename of the FW image
+ * @param[in]  fileType       File type (IHX or BIN)
+ * @param[in]  cacheFilename  Image cache file
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesFWImageOpenCached(
+        AriesFWImageType* image,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        const char* cacheFilename);
+
 /**
  * @brief This is used by loadFile to get each line of intex hex
  */
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_shm.h
+ * @brief Definition of shared memory state publication. One process owns the
+ * Retimers and publishes the latest device and link state into a POSIX shared
+ * memory segment. Any number of reader processes take snapshots from the
+ * segment without I2C traffic and without blocking the publisher. Every entry
+ * is protected by its own sequence counter (seqlock), so snapshots are never
+ * torn.
+ */
+
+#ifndef ASTERA_ARIES_SDK_SHM_H_
+#define ASTERA_ARIES_SDK_SHM_H_
+
+#include "aries_globals.h"
+#include "aries_error.h"
+#include "aries_api_types.h"
+#include "astera_log.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create (or re-create) the shared memory state segment and map it
+ * writable. All entries start unpublished.
+ *
+ * @param[out] shm         Segment mapping
+ * @param[in]  name        Segment name (e.g. ARIES_SHM_DEFAULT_NAME)
+ * @param[in]  numDevices  Num device entries
+ * @param[in]  numLinks    Num link entries
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesShmPublisherOpen(
+        AriesShmType* shm,
+        const char* name,
+        int numDevices,
+        int numLinks);
+
+/**
+ * @brief Publish the current state of a device. No bus access.
+ *
+ * @param[in]  shm     Segment mapping (publisher)
+ * @param[in]  index   Device entry index
+ * @param[in]  device  Device
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesShmPublishDevice(
+        AriesShmType* shm,
+        int index,
+        AriesDeviceType* device);
+
+/**
+ * @brief Publish the current state of a link, e.g. after
+ * ariesCheckLinkHealth(). No bus access.
+ *
+ * @param[in]  shm          Segment mapping (publisher)
+ * @param[in]  index        Link entry index
+ * @param[in]  deviceIndex  Device entry index of the link's device
+ * @param[in]  link         Link
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesShmPublishLink(
+        AriesShmType* shm,
+        int index,
+        int deviceIndex,
+        AriesLinkType* link);
+
+/**
+ * @brief Map an existing shared memory state segment read-only
+ *
+ * @param[out] shm     Segment mapping
+ * @param[in]  name    Segment name
+ * @return     AriesErrorType - Aries error code (ARIES_SHM_FAILURE if the
+ *             segment does not exist or has a different layout version)
+ */
+AriesErrorType ariesShmReaderOpen(
+        AriesShmType* shm,
+        const char* name);
+
+/**
+ * @brief Take a consistent snapshot of a device entry
+ *
+ * @param[in]  shm     Segment mapping
+ * @param[in]  index   Device entry index
+ * @param[out] entry   Snapshot
+ * @return     AriesErrorType - Aries error code (ARIES_SHM_SNAPSHOT_BUSY if
+ *             no consistent snapshot within ARIES_SHM_READ_TRIES tries)
+ */
+AriesErrorType ariesShmReadDevice(
+        AriesShmType* shm,
+        int index,
+        AriesShmDeviceEntryType* entry);
+
+/**
+ * @brief Take a consistent snapshot of a link entry
+ *
+ * @param[in]  shm     Segment mapping
+ * @param[in]  index   Link entry index
+ * @param[out] entry   Snapshot
+ * @return     AriesErrorType - Aries error code (ARIES_SHM_SNAPSHOT_BUSY if
+ *             no consistent snapshot within ARIES_SHM_READ_TRIES tries)
+ */
+AriesErrorType ariesShmReadLink(
+        AriesShmType* shm,
+        int index,
+        AriesShmLinkEntryType* entry);
+
+/**
+ * @brief Unmap the segment. The publisher may also remove the segment name.
+ *
+ * @param[in]  shm     Segment mapping
+ * @param[in]  unlink  Remove the segment name (publisher only)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesShmClose(
+        AriesShmType* shm,
+        bool unlink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASTERA_ARIES_SDK_SHM_H_ */
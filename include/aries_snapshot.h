@@ -0,0 +1,151 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_snapshot.h
+ * @brief Definition of the binary snapshot reader. A snapshot, written by
+ * ariesLinkWriteSnapshot(), holds a header, a section table, a schema of the
+ * record fields, a device record, a link record, a record per lane and the
+ * raw LTSSM logs of a link. The reader maps the file read-only and returns
+ * pointers into the mapping, and converts snapshots to CSV or JSON. It does
+ * not access the bus, so it can run on any host.
+ */
+
+#ifndef ASTERA_ARIES_SDK_SNAPSHOT_H_
+#define ASTERA_ARIES_SDK_SNAPSHOT_H_
+
+#include "aries_globals.h"
+#include "aries_error.h"
+#include "aries_api_types.h"
+#include "astera_log.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Map a snapshot file read-only and check its layout. Snapshots of a
+ * different major version, or written with a different byte order, are
+ * rejected.
+ *
+ * @param[out] snapshot  Snapshot mapping
+ * @param[in]  filename  Snapshot file
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotOpen(
+        AriesSnapshotType* snapshot,
+        const char* filename);
+
+/**
+ * @brief Unmap a snapshot file. Pointers returned by the snapshot are no
+ * longer valid.
+ *
+ * @param[in,out] snapshot  Snapshot mapping
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotClose(
+        AriesSnapshotType* snapshot);
+
+/**
+ * @brief Get the device record of a snapshot
+ *
+ * @param[in]  snapshot  Snapshot mapping
+ * @param[out] device    Device record, in the mapping
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotGetDevice(
+        AriesSnapshotType* snapshot,
+        const AriesSnapshotDeviceType** device);
+
+/**
+ * @brief Get the link record of a snapshot
+ *
+ * @param[in]  snapshot  Snapshot mapping
+ * @param[out] link      Link record, in the mapping
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotGetLink(
+        AriesSnapshotType* snapshot,
+        const AriesSnapshotLinkType** link);
+
+/**
+ * @brief Get the record of a lane of a snapshot
+ *
+ * @param[in]  snapshot   Snapshot mapping
+ * @param[in]  laneIndex  Logical lane index (0 to numLanes-1)
+ * @param[out] lane       Lane record, in the mapping
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotGetLane(
+        AriesSnapshotType* snapshot,
+        int laneIndex,
+        const AriesSnapshotLaneType** lane);
+
+/**
+ * @brief Get a raw LTSSM log of a snapshot. The bytes are in log order; byte
+ * i was at print buffer offset (firstOffset + i) modulo the print buffer
+ * size of the log.
+ *
+ * @param[in]  snapshot     Snapshot mapping
+ * @param[in]  logIndex     Log index (0 to numLogs-1, Main Micro log first)
+ * @param[out] logType      Log type (AriesLTSSMLoggerEnumType)
+ * @param[out] firstOffset  Print buffer offset of the first byte
+ * @param[out] data         Log bytes, in the mapping
+ * @param[out] numBytes     Num log bytes
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotGetLog(
+        AriesSnapshotType* snapshot,
+        int logIndex,
+        int* logType,
+        int* firstOffset,
+        const uint8_t** data,
+        int* numBytes);
+
+/**
+ * @brief Convert a snapshot to JSON. Record fields are taken from the schema
+ * of the snapshot, so snapshots of a later minor version are converted in
+ * full.
+ *
+ * @param[in]  snapshot  Snapshot mapping
+ * @param[in]  fp        Output file
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotWriteJson(
+        AriesSnapshotType* snapshot,
+        FILE* fp);
+
+/**
+ * @brief Convert a snapshot to CSV, one "section,index,field,value" row per
+ * value. Array fields give a row per element (name[i]). Log bytes give a row
+ * per byte, with the log type as index and the print buffer offset as field.
+ *
+ * @param[in]  snapshot  Snapshot mapping
+ * @param[in]  fp        Output file
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesSnapshotWriteCsv(
+        AriesSnapshotType* snapshot,
+        FILE* fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASTERA_ARIES_SDK_SNAPSHOT_H_ */
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_telemetry.h
+ * @brief Definition of the link telemetry ring. The poller of a link records
+ * a compact timestamped sample of the link and device state after each poll,
+ * so history is kept instead of being overwritten. The ring has a single
+ * producer and any number of readers: the producer never blocks or
+ * allocates, and readers never block the producer. A sample overwritten
+ * while being read is dropped from the reader's window.
+ */
+
+#ifndef ASTERA_ARIES_SDK_TELEMETRY_H_
+#define ASTERA_ARIES_SDK_TELEMETRY_H_
+
+#include "aries_globals.h"
+#include "aries_error.h"
+#include "aries_api_types.h"
+#include "astera_log.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize a telemetry ring over caller allocated slots
+ *
+ * @param[out] ring      Telemetry ring
+ * @param[in]  slots     Slot array, valid for the life of the ring
+ * @param[in]  numSlots  Num slots, a power of 2
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesTelemetryRingInit(
+        AriesTelemetryRingType* ring,
+        AriesTelemetrySlotType* slots,
+        uint32_t numSlots);
+
+/**
+ * @brief Fill a telemetry sample from the last polled state of a link, e.g.
+ * after ariesCheckLinkHealth() or ariesHealthSchedPoll(). No bus access.
+ *
+ * @param[in]  link      Link
+ * @param[out] sample    Sample, timestamped now
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesTelemetrySampleFromLink(
+        AriesLinkType* link,
+        AriesTelemetrySampleType* sample);
+
+/**
+ * @brief Append a sample to the ring, overwriting the oldest sample once the
+ * ring is full. Must only be called by the single producer of the ring.
+ *
+ * @param[in,out] ring    Telemetry ring
+ * @param[in]     sample  Sample to append
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesTelemetryRingPush(
+        AriesTelemetryRingType* ring,
+        AriesTelemetrySampleType* sample);
+
+/**
+ * @brief Record the last polled state of a link in the ring. Shorthand for
+ * ariesTelemetrySampleFromLink() and ariesTelemetryRingPush().
+ *
+ * @param[in,out] ring    Telemetry ring
+ * @param[in]     link    Link
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesTelemetryRingRecord(
+        AriesTelemetryRingType* ring,
+        AriesLinkType* link);
+
+/**
+ * @brief Read samples from the ring, oldest first, starting at sample number
+ * *cursor. Samples already overwritten are skipped, and counted in numLost.
+ * On return *cursor is the number of the next sample to read. Start with
+ * *cursor = 0 to read all samples held in the ring.
+ *
+ * @param[in]     ring        Telemetry ring
+ * @param[in,out] cursor      Next sample number to read
+ * @param[out]    samples     Array of maxSamples samples
+ * @param[in]     maxSamples  Max num samples to read
+ * @param[out]    numSamples  Num samples read
+ * @param[out]    numLost     Num samples skipped since overwritten (may be
+ *                            NULL)
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesTelemetryRingRead(
+        AriesTelemetryRingType* ring,
+        uint64_t* cursor,
+        AriesTelemetrySampleType* samples,
+        int maxSamples,
+        int* numSamples,
+        uint64_t* numLost);
+
+/**
+ * @brief Read the most recent samples of the ring, oldest first
+ *
+ * @param[in]  ring        Telemetry ring
+ * @param[out] samples     Array of maxSamples samples
+ * @param[in]  maxSamples  Max num samples to read
+ * @param[out] numSamples  Num samples read
+ * @return     AriesErrorType - Aries error code
+ */
+AriesErrorType ariesTelemetryRingReadLatest(
+        AriesTelemetryRingType* ring,
+        AriesTelemetrySampleType* samples,
+        int maxSamples,
+        int* numSamples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASTERA_ARIES_SDK_TELEMETRY_H_ */
@@ -36,6 +36,17 @@ const uint8_t* ariesGetSDKVersion(void)
 }
 
 
+/*
+ * Get monotonic timestamp in us
+ */
+static uint64_t ariesGetTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+
 /*
  * Check the status of firmware
  */
@@ -122,10 +133,118 @@ AriesErrorType ariesFWStatusCheck(
 }
 
 
+/*
+ * Read FW struct addresses and sizes from Main Micro and Path Micro FW info
+ */
+static AriesErrorType ariesReadFwStructAddrs(
+        AriesDeviceType* device)
+{
+    AriesErrorType rc;
+    uint8_t dataByte[1];
+    uint8_t dataWord[2];
+
+    // Get link_path_struct size
+    // Prior to FW 1.1.52, this size is 38
+    device->linkPathStructSize = ARIES_LINK_PATH_STRUCT_SIZE;
+    if ((device->fwVersion.major >= 1) && (device->fwVersion.minor >= 1)
+        && (device->fwVersion.build >= 52))
+    {
+        rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
+            ARIES_LINK_PATH_STRUCT_SIZE_ADDR, 1, dataByte);
+        CHECK_SUCCESS(rc);
+        device->linkPathStructSize = dataByte[0];
+    }
+    else if ((device->fwVersion.major >= 1) && (device->fwVersion.minor >= 2))
+    {
+        rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
+            ARIES_LINK_PATH_STRUCT_SIZE_ADDR, 1, dataByte);
+        CHECK_SUCCESS(rc);
+        device->linkPathStructSize = dataByte[0];
+    }
+
+    // Get the al print info struct offset for Main Micro
+    rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
+        (ARIES_MAIN_MICRO_FW_INFO+ARIES_MM_AL_PRINT_INFO_STRUCT_ADDR), 2,
+        dataWord);
+    CHECK_SUCCESS(rc);
+    device->mm_print_info_struct_addr = AL_MAIN_SRAM_DMEM_OFFSET +
+        (dataWord[1] << 8) + dataWord[0];
+
+    // Get the gp ctrl status struct offset for Main Micro
+    rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
+        (ARIES_MAIN_MICRO_FW_INFO+ARIES_MM_GP_CTRL_STS_STRUCT_ADDR), 2,
+        dataWord);
+    CHECK_SUCCESS(rc);
+    device->mm_gp_ctrl_sts_struct_addr = AL_MAIN_SRAM_DMEM_OFFSET +
+        (dataWord[1] << 8) + dataWord[0];
+
+    // Get AL print info struct address for path micros
+    // All Path Micros will have same address, so get for PM 4 (present on both x16 and x8 devices)
+    rc = ariesReadBlockDataPathMicroIndirect(device->i2cDriver, 4,
+        (ARIES_PATH_MICRO_FW_INFO_ADDRESS+ARIES_PM_AL_PRINT_INFO_STRUCT_ADDR),
+        2, dataWord);
+    CHECK_SUCCESS(rc);
+    device->pm_print_info_struct_addr = AL_PATH_SRAM_DMEM_OFFSET +
+        (dataWord[1] << 8) + dataWord[0];
+
+    // Get GP ctrl status struct address for path micros
+    // All Path Micros will have same address, so get for PM 4 (present on both x16 and x8 devices)
+    rc = ariesReadBlockDataPathMicroIndirect(device->i2cDriver, 4,
+        (ARIES_PATH_MICRO_FW_INFO_ADDRESS+ARIES_PM_GP_CTRL_STS_STRUCT_ADDR),
+        2, dataWord);
+    CHECK_SUCCESS(rc);
+    device->pm_gp_ctrl_sts_struct_addr = AL_PATH_SRAM_DMEM_OFFSET +
+        (dataWord[1] << 8) + dataWord[0];
+
+    device->cache.fwStructAddrValid = true;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Re-read FW struct addresses if the device cache was invalidated since they
+ * were last read
+ */
+static AriesErrorType ariesDeviceCacheLoadFwStructAddrs(
+        AriesDeviceType* device)
+{
+    AriesErrorType rc;
+
+    if (device->cache.fwStructAddrValid)
+    {
+        return ARIES_SUCCESS;
+    }
+
+    // FW may have been reloaded, so refresh FW version first
+    rc = ariesFWStatusCheck(device);
+    CHECK_SUCCESS(rc);
+    if (!device->mmHeartbeatOkay)
+    {
+        // Keep previous addresses and try again on next use
+        return ARIES_SUCCESS;
+    }
+
+    return ariesReadFwStructAddrs(device);
+}
+
+
+/*
+ * Invalidate shadow copies of device metadata
+ */
+AriesErrorType ariesDeviceCacheInvalidate(
+        AriesDeviceType* device)
+{
+    memset(&device->cache, 0, sizeof(AriesDeviceCacheType));
+
+    return ARIES_SUCCESS;
+}
+
+
 /*
  * Initialize the device data structure
  */
-AriesErrorType ariesInitDevice(
+static AriesErrorType ariesInitDeviceUntracked(
         AriesDeviceType* device,
         uint8_t recoveryAddr)
 {
@@ -137,12 +256,12 @@ AriesErrorType ariesInitDevice(
     rc = ariesCheckConnectionHealth(device, recoveryAddr);
     CHECK_SUCCESS(rc);
 
-    // Set lock = 0 (if it hasnt been set before)
-    if (device->i2cDriver->lockInit == 0)
-    {
-        device->i2cDriver->lock = 0;
-        device->i2cDriver->lockInit = 1;
-    }
+    rc = ariesDeviceCacheInvalidate(device);
+    CHECK_SUCCESS(rc);
+
+    // Initialize lock (no-op if it has been initialized before)
+    rc = ariesLockInit(device->i2cDriver);
+    CHECK_SUCCESS(rc);
 
     // Read Code Load reg
     rc = ariesReadBlockData(device->i2cDriver, ARIES_CODE_LOAD_REG, 1,
@@ -240,58 +359,8 @@ AriesErrorType ariesInitDevice(
     device->deviceId = dataBytes[1];
     device->revNumber = dataBytes[0];
 
-    // Get link_path_struct size
-    // Prior to FW 1.1.52, this size is 38
-    device->linkPathStructSize = ARIES_LINK_PATH_STRUCT_SIZE;
-    if ((device->fwVersion.major >= 1) && (device->fwVersion.minor >= 1)
-        && (device->fwVersion.build >= 52))
-    {
-        rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
-            ARIES_LINK_PATH_STRUCT_SIZE_ADDR, 1, dataByte);
-        CHECK_SUCCESS(rc);
-        device->linkPathStructSize = dataByte[0];
-    }
-    else if ((device->fwVersion.major >= 1) && (device->fwVersion.minor >= 2))
-    {
-        rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
-            ARIES_LINK_PATH_STRUCT_SIZE_ADDR, 1, dataByte);
-        CHECK_SUCCESS(rc);
-        device->linkPathStructSize = dataByte[0];
-    }
-
-    // Get the al print info struct offset for Main Micro
-    rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
-        (ARIES_MAIN_MICRO_FW_INFO+ARIES_MM_AL_PRINT_INFO_STRUCT_ADDR), 2,
-        dataWord);
-    CHECK_SUCCESS(rc);
-    device->mm_print_info_struct_addr = AL_MAIN_SRAM_DMEM_OFFSET +
-        (dataWord[1] << 8) + dataWord[0];
-
-    // Get the gp ctrl status struct offset for Main Micro
-    rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
-        (ARIES_MAIN_MICRO_FW_INFO+ARIES_MM_GP_CTRL_STS_STRUCT_ADDR), 2,
-        dataWord);
-    CHECK_SUCCESS(rc);
-    device->mm_gp_ctrl_sts_struct_addr = AL_MAIN_SRAM_DMEM_OFFSET +
-        (dataWord[1] << 8) + dataWord[0];
-
-    // Get AL print info struct address for path micros
-    // All Path Micros will have same address, so get for PM 4 (present on both x16 and x8 devices)
-    rc = ariesReadBlockDataPathMicroIndirect(device->i2cDriver, 4,
-        (ARIES_PATH_MICRO_FW_INFO_ADDRESS+ARIES_PM_AL_PRINT_INFO_STRUCT_ADDR),
-        2, dataWord);
-    CHECK_SUCCESS(rc);
-    device->pm_print_info_struct_addr = AL_PATH_SRAM_DMEM_OFFSET +
-        (dataWord[1] << 8) + dataWord[0];
-
-    // Get GP ctrl status struct address for path micros
-    // All Path Micros will have same address, so get for PM 4 (present on both x16 and x8 devices)
-    rc = ariesReadBlockDataPathMicroIndirect(device->i2cDriver, 4,
-        (ARIES_PATH_MICRO_FW_INFO_ADDRESS+ARIES_PM_GP_CTRL_STS_STRUCT_ADDR),
-        2, dataWord);
+    rc = ariesReadFwStructAddrs(device);
     CHECK_SUCCESS(rc);
-    device->pm_gp_ctrl_sts_struct_addr = AL_PATH_SRAM_DMEM_OFFSET +
-        (dataWord[1] << 8) + dataWord[0];
 
     rc = ariesGetTempCalibrationCodes(device);
     CHECK_SUCCESS(rc);
@@ -303,6 +372,24 @@ AriesErrorType ariesInitDevice(
 }
 
 
+/*
+ * Wrapper which attributes I2C transactions to ariesInitDevice()
+ */
+AriesErrorType ariesInitDevice(
+        AriesDeviceType* device,
+        uint8_t recoveryAddr)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_INIT_DEVICE);
+    rc = ariesInitDeviceUntracked(device, recoveryAddr);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    return rc;
+}
+
+
 /*
  * Set the bifurcation mode
  */
@@ -322,6 +409,8 @@ AriesErrorType ariesSetBifurcationMode(
         // Bifurcation setting is in bits 12:7
         glbParam[0] = ((bifur & 0x01) << 7) | (glbParam[0] & 0x7f);
         glbParam[1] = ((bifur & 0x3e) >> 1) | (glbParam[1] & 0xe0);
+        // Link layout changes with bifurcation
+        ariesDeviceCacheInvalidate(device);
         return(ariesWriteBlockData(device->i2cDriver, 0x0, 4, glbParam));
     }
 }
@@ -341,10 +430,47 @@ AriesErrorType ariesGetBifurcationMode(
     CHECK_SUCCESS(rc);
     *bifur = ((glbParam[1] & 0x1f) << 1) + ((glbParam[0] & 0x80) >> 7);
 
+    device->cache.bifurcation = *bifur;
+    device->cache.bifurcationValid = true;
+
     return ARIES_SUCCESS;
 }
 
 
+/*
+ * Get the bifurcation mode, from the device cache if valid
+ */
+static AriesErrorType ariesGetBifurcationModeCached(
+        AriesDeviceType* device,
+        AriesBifurcationType* bifur)
+{
+    if (device->cache.bifurcationValid)
+    {
+        *bifur = device->cache.bifurcation;
+        return ARIES_SUCCESS;
+    }
+
+    return ariesGetBifurcationMode(device, bifur);
+}
+
+
+/*
+ * Get the port orientation, from the device cache if valid
+ */
+static AriesErrorType ariesGetPortOrientationCached(
+        AriesDeviceType* device,
+        int* orientation)
+{
+    if (device->cache.orientationValid)
+    {
+        *orientation = device->cache.orientation;
+        return ARIES_SUCCESS;
+    }
+
+    return ariesGetPortOrientation(device, orientation);
+}
+
+
 /*
  * Set the PCIe Protocol Reset.
  */
@@ -355,6 +481,9 @@ AriesErrorType ariesSetPcieReset(
     AriesErrorType rc;
     uint8_t dataByte[1];
 
+    rc = ariesDeviceCacheInvalidate(link->device);
+    CHECK_SUCCESS(rc);
+
     if (reset == 1)
     {
         rc = ariesReadByteData(link->device->i2cDriver, 0x604, dataByte);
@@ -389,6 +518,9 @@ AriesErrorType ariesSetHwReset(
     AriesErrorType rc;
     uint8_t dataWord[2];
 
+    rc = ariesDeviceCacheInvalidate(device);
+    CHECK_SUCCESS(rc);
+
     if (reset == 1) // Put retimer into reset
     {
         dataWord[0] = 0xff;
@@ -455,41 +587,40 @@ AriesErrorType ariesSetI2CMasterReset(
 
 
 /*
- * Update the FW image in the EEPROM connected to the Retimer.
+ * Check if the Main Micro can assist EEPROM writes and checksums
  */
-AriesErrorType ariesUpdateFirmware(
-        AriesDeviceType* device,
-        const char* filename,
-        AriesFWImageFormatType fileType)
+static bool ariesEEPROMMainMicroAssist(
+        AriesDeviceType* device)
 {
-    AriesErrorType rc;
-    bool legacyMode = false;
-    bool checksumVerifyFailed = false;
-    uint8_t image[ARIES_EEPROM_NUM_BYTES];
-
-    if (fileType == ARIES_FW_IMAGE_FORMAT_IHX)
+    // Legacy mode if ARP is enabled or not running valid FW
+    if (device->arpEnable || !device->mmHeartbeatOkay)
     {
-        // Load ihx file
-        rc = ariesLoadIhxFile(filename, image);
-        if (rc != ARIES_SUCCESS)
-        {
-            ASTERA_ERROR("Failed to load the .ihx file. RC = %d", rc);
-        }
+        return false;
     }
-    else if (fileType == ARIES_FW_IMAGE_FORMAT_BIN)
+    if ((device->fwVersion.major >= 1) && (device->fwVersion.minor >= 1))
     {
-        // Load bin file
-        rc = ariesLoadBinFile(filename, image);
-        if (rc != ARIES_SUCCESS)
-        {
-            ASTERA_ERROR("Failed to load the .bin file. RC = %d", rc);
-        }
+        return true;
     }
-    else
+    if ((device->fwVersion.major >= 1) && (device->fwVersion.build >= 48))
     {
-        ASTERA_ERROR("Invalid Aries FW image format type");
-        return ARIES_INVALID_ARGUMENT;
+        return true;
     }
+    return false;
+}
+
+
+/*
+ * Program and verify a FW image in the EEPROM connected to the Retimer
+ */
+static AriesErrorType ariesUpdateFirmwareImageUntracked(
+        AriesDeviceType* device,
+        uint8_t* image)
+{
+    AriesErrorType rc;
+    AriesErrorType writeRc;
+    AriesErrorType verifyRc = ARIES_SUCCESS;
+    bool legacyMode = false;
+    bool checksumVerifyFailed = false;
 
     // Enable legacy mode if ARP is enabled or not running valid FW
     if (device->arpEnable || !device->mmHeartbeatOkay)
@@ -503,6 +634,7 @@ AriesErrorType ariesUpdateFirmware(
     {
         ASTERA_ERROR("Failed to program the EEPROM. RC = %d", rc);
     }
+    writeRc = rc;
 
     if (!legacyMode)
     {
@@ -513,6 +645,7 @@ AriesErrorType ariesUpdateFirmware(
             ASTERA_ERROR("Failed to verify the EEPROM using checksum. RC = %d", rc);
             checksumVerifyFailed = true;
         }
+        verifyRc = rc;
     }
 
     // If the EEPROM verify via checksum failed, attempt the byte by byte verify
@@ -527,49 +660,333 @@ AriesErrorType ariesUpdateFirmware(
         {
             ASTERA_ERROR("Failed to read and verify the EEPROM. RC = %d", rc);
         }
+        verifyRc = rc;
     }
 
     device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_COMPLETE;
 
-    return ARIES_SUCCESS;
+    if (writeRc != ARIES_SUCCESS)
+    {
+        return writeRc;
+    }
+    return verifyRc;
 }
 
 
 /*
  * Update the FW image in the EEPROM connected to the Retimer.
  */
-AriesErrorType ariesFirmwareUpdateProgress(
+static AriesErrorType ariesUpdateFirmwareUntracked(
         AriesDeviceType* device,
-        uint8_t* percentComplete)
+        const char* filename,
+        AriesFWImageFormatType fileType)
 {
-    *percentComplete = 100 * device->fwUpdateProg / (ARIES_FW_UPDATE_PROGRESS_COMPLETE - ARIES_FW_UPDATE_PROGRESS_START + 1);
+    AriesErrorType rc;
+    AriesFWImageType image;
+
+    // Binary images are mapped and intel hex images decoded on the heap, so
+    // the 256 KB image is never on the caller's stack
+    rc = ariesFWImageOpen(&image, filename, fileType);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to load the FW image file. RC = %d", rc);
+        return rc;
+    }
+
+    // Program and verify EEPROM image. Failures are logged
+    ariesUpdateFirmwareImageUntracked(device, image.data);
+
+    ariesFWImageClose(&image);
 
     return ARIES_SUCCESS;
 }
 
 
 /*
- * Load a FW image into the EEPROM connected to the Retimer.
+ * Wrapper which attributes I2C transactions to ariesUpdateFirmware()
  */
-AriesErrorType ariesWriteEEPROMImage(
+AriesErrorType ariesUpdateFirmware(
         AriesDeviceType* device,
-        uint8_t* values,
-        bool legacyMode)
+        const char* filename,
+        AriesFWImageFormatType fileType)
 {
-    int currentPage = 0;
+    AriesI2CStatsApiType prevApi;
     AriesErrorType rc;
 
-    // Deassert HW and SW resets
-    uint8_t tmpData[2];
-    tmpData[0] = 0;
-    tmpData[1] = 0;
-    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
-    CHECK_SUCCESS(rc);
-    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_UPDATE_FIRMWARE);
+    rc = ariesUpdateFirmwareUntracked(device, filename, fileType);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer is reset and FW reloaded (also on failure part way through)
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesUpdateFirmwareImage()
+ */
+AriesErrorType ariesUpdateFirmwareImage(
+        AriesDeviceType* device,
+        uint8_t* image)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_UPDATE_FIRMWARE);
+    rc = ariesUpdateFirmwareImageUntracked(device, image);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer is reset and FW reloaded (also on failure part way through)
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
+/*
+ * Update the FW image in the EEPROM connected to the Retimer from an image,
+ * rewriting only the pages which differ
+ */
+static AriesErrorType ariesUpdateFirmwareDeltaImageUntracked(
+        AriesDeviceType* device,
+        uint8_t* image,
+        AriesEEPROMPageDeltaStatsType* stats)
+{
+    AriesErrorType rc;
+
+    memset(stats, 0, sizeof(AriesEEPROMPageDeltaStatsType));
+
+    // Page checksums are computed by the Main Micro. Without it, fall back to
+    // programming the full image
+    if (!ariesEEPROMMainMicroAssist(device))
+    {
+        ASTERA_WARN("Main Micro assist not available, updating full EEPROM");
+        return ariesUpdateFirmwareImageUntracked(device, image);
+    }
+
+    // Rewrite and re-verify the pages which differ
+    rc = ariesWriteEEPROMImagePageDelta(device, image, stats);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to update the EEPROM pages. RC = %d", rc);
+    }
+
+    device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_COMPLETE;
+
+    return rc;
+}
+
+
+/*
+ * Update the FW image in the EEPROM connected to the Retimer, rewriting only
+ * the pages which differ from the new image.
+ */
+static AriesErrorType ariesUpdateFirmwareDeltaUntracked(
+        AriesDeviceType* device,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        AriesEEPROMPageDeltaStatsType* stats)
+{
+    AriesErrorType rc;
+    AriesFWImageType image;
+
+    memset(stats, 0, sizeof(AriesEEPROMPageDeltaStatsType));
+
+    rc = ariesFWImageOpen(&image, filename, fileType);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to load the FW image file. RC = %d", rc);
+        return rc;
+    }
+
+    rc = ariesUpdateFirmwareDeltaImageUntracked(device, image.data, stats);
+
+    ariesFWImageClose(&image);
+
+    return rc;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesUpdateFirmwareDelta()
+ */
+AriesErrorType ariesUpdateFirmwareDelta(
+        AriesDeviceType* device,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        AriesEEPROMPageDeltaStatsType* stats)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_UPDATE_FIRMWARE_DELTA);
+    rc = ariesUpdateFirmwareDeltaUntracked(device, filename, fileType, stats);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer resets are toggled while writing the EEPROM
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesUpdateFirmwareDeltaImage()
+ */
+AriesErrorType ariesUpdateFirmwareDeltaImage(
+        AriesDeviceType* device,
+        uint8_t* image,
+        AriesEEPROMPageDeltaStatsType* stats)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_UPDATE_FIRMWARE_DELTA);
+    rc = ariesUpdateFirmwareDeltaImageUntracked(device, image, stats);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer resets are toggled while writing the EEPROM
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
+/*
+ * Update the FW image in the EEPROM connected to the Retimer.
+ */
+AriesErrorType ariesFirmwareUpdateProgress(
+        AriesDeviceType* device,
+        uint8_t* percentComplete)
+{
+    *percentComplete = 100 * device->fwUpdateProg / (ARIES_FW_UPDATE_PROGRESS_COMPLETE - ARIES_FW_UPDATE_PROGRESS_START + 1);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the EEPROM page program time statistics of the last EEPROM write
+ */
+AriesErrorType ariesGetEEPROMProgramStats(
+        AriesDeviceType* device,
+        AriesEEPROMProgramStatsType* stats)
+{
+    if ((device == NULL) || (stats == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    *stats = device->eepromProgStats;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Wait for the EEPROM to complete programming a block of bytes just written
+ * at addrI2C (in the current EEPROM bank). By default this is the fixed
+ * program time. Built with ARIES_EEPROM_PROGRAM_POLL, the block is polled
+ * until the EEPROM returns the written data, and the program time recorded
+ */
+static AriesErrorType ariesEEPROMWaitProgram(
+        AriesDeviceType* device,
+        int addrI2C,
+        uint8_t* values,
+        int numBytes)
+{
+    AriesEEPROMProgramStatsType* stats = &device->eepromProgStats;
+    AriesErrorType rc;
+    uint64_t startUs;
+    uint64_t elapsedUs = 0;
+    bool match = false;
+    int numComplete;
+    int byteIdx;
+    int bin;
+
+#ifndef ARIES_EEPROM_PROGRAM_POLL
+    // Completion polling is opt-in until validated on hardware
+    usleep(ARIES_DATA_BLOCK_PROGRAM_TIME_USEC);
+    return ARIES_SUCCESS;
+#endif
+
+    // Poll a byte which can not be mistaken for an idle bus (0xff) or a
+    // cleared data register (0x00). If there is none, use the fixed time
+    for (byteIdx = 0; byteIdx < numBytes; byteIdx++)
+    {
+        if ((values[byteIdx] != 0x00) && (values[byteIdx] != 0xff))
+        {
+            break;
+        }
+    }
+    if (byteIdx == numBytes)
+    {
+        usleep(ARIES_DATA_BLOCK_PROGRAM_TIME_USEC);
+        return ARIES_SUCCESS;
+    }
+
+    startUs = ariesGetTimeUs();
+    while (!match && (elapsedUs < ARIES_EEPROM_PAGE_PROGRAM_TIMEOUT_USEC))
+    {
+        rc = ariesI2CMasterPollByte(device->i2cDriver, addrI2C + byteIdx,
+            values[byteIdx], &match);
+        CHECK_SUCCESS(rc);
+        stats->numPolls++;
+        elapsedUs = ariesGetTimeUs() - startUs;
+    }
+    stats->numPages++;
+
+    // The block may not be programmed. Fail rather than carry on writing
+    if (!match)
+    {
+        stats->numTimeouts++;
+        ASTERA_ERROR("EEPROM addr 0x%04x: program not complete after %d us",
+            addrI2C, (int) elapsedUs);
+        return ARIES_EEPROM_WRITE_ERROR;
+    }
+
+    numComplete = stats->numPages - stats->numTimeouts;
+    if ((numComplete == 1) || (elapsedUs < stats->minUs))
+    {
+        stats->minUs = elapsedUs;
+    }
+    if (elapsedUs > stats->maxUs)
+    {
+        stats->maxUs = elapsedUs;
+    }
+    stats->totalUs += elapsedUs;
+    bin = elapsedUs / 1000;
+    if (bin >= ARIES_EEPROM_PROGRAM_TIME_HIST_BINS)
+    {
+        bin = ARIES_EEPROM_PROGRAM_TIME_HIST_BINS - 1;
+    }
+    stats->hist[bin]++;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Load a FW image into the EEPROM connected to the Retimer.
+ */
+static AriesErrorType ariesWriteEEPROMImageUntracked(
+        AriesDeviceType* device,
+        uint8_t* values,
+        bool legacyMode)
+{
+    int currentPage = 0;
+    AriesErrorType rc;
+
+    // Deassert HW and SW resets
+    uint8_t tmpData[2];
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
     CHECK_SUCCESS(rc);
 
     // Update device FW update progress state
     device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_WRITE_0;
+    memset(&device->eepromProgStats, 0, sizeof(AriesEEPROMProgramStatsType));
 
     // If operating in legacy mode, put MM in reset
     if (legacyMode)
@@ -714,6 +1131,10 @@ AriesErrorType ariesWriteEEPROMImage(
                     rc = ariesI2CMasterMultiBlockWrite(device,
                             addrBurst, addrDiff, data);
                     CHECK_SUCCESS(rc);
+                    // Wait for the EEPROM to program the block
+                    rc = ariesEEPROMWaitProgram(device, addrBurst, data,
+                        addrDiff);
+                    CHECK_SUCCESS(rc);
                 }
                 else
                 {
@@ -726,8 +1147,11 @@ AriesErrorType ariesWriteEEPROMImage(
                     rc = ariesI2CMasterMultiBlockWrite(device,
                         addrBurst, ARIES_MAX_BURST_SIZE, data);
                     CHECK_SUCCESS(rc);
+                    // Wait for the EEPROM to program the block
+                    rc = ariesEEPROMWaitProgram(device, addrBurst, data,
+                        ARIES_MAX_BURST_SIZE);
+                    CHECK_SUCCESS(rc);
                 }
-                usleep(ARIES_DATA_BLOCK_PROGRAM_TIME_USEC);
                 burst += ARIES_MAX_BURST_SIZE;
             }
 
@@ -780,6 +1204,10 @@ AriesErrorType ariesWriteEEPROMImage(
                     rc = ariesI2CMasterSendByteBlockData(device->i2cDriver,
                         addrBurst, addrDiff, data);
                     CHECK_SUCCESS(rc);
+                    // Wait for the EEPROM to program the block
+                    rc = ariesEEPROMWaitProgram(device, addrBurst, data,
+                        addrDiff);
+                    CHECK_SUCCESS(rc);
                 }
                 else
                 {
@@ -792,8 +1220,11 @@ AriesErrorType ariesWriteEEPROMImage(
                     rc = ariesI2CMasterSendByteBlockData(device->i2cDriver,
                         addrBurst, ARIES_MAX_BURST_SIZE, data);
                     CHECK_SUCCESS(rc);
+                    // Wait for the EEPROM to program the block
+                    rc = ariesEEPROMWaitProgram(device, addrBurst, data,
+                        ARIES_MAX_BURST_SIZE);
+                    CHECK_SUCCESS(rc);
                 }
-                usleep(ARIES_DATA_BLOCK_PROGRAM_TIME_USEC);
                 burst += ARIES_MAX_BURST_SIZE;
             }
 
@@ -810,6 +1241,15 @@ AriesErrorType ariesWriteEEPROMImage(
     // Stop timer
     time(&end_t);
     ASTERA_INFO("EEPROM load time: %.2f seconds", difftime(end_t, start_t));
+    if (device->eepromProgStats.numPages > device->eepromProgStats.numTimeouts)
+    {
+        ASTERA_INFO("EEPROM page program time: min %d us, avg %d us, max %d us, %d timeouts",
+            device->eepromProgStats.minUs,
+            (int) (device->eepromProgStats.totalUs /
+                (device->eepromProgStats.numPages -
+                 device->eepromProgStats.numTimeouts)),
+            device->eepromProgStats.maxUs, device->eepromProgStats.numTimeouts);
+    }
 
     // Update device FW update progress state
     device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_WRITE_DONE;
@@ -828,10 +1268,31 @@ AriesErrorType ariesWriteEEPROMImage(
 }
 
 
+/*
+ * Wrapper which attributes I2C transactions to ariesWriteEEPROMImage()
+ */
+AriesErrorType ariesWriteEEPROMImage(
+        AriesDeviceType* device,
+        uint8_t* values,
+        bool legacyMode)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_WRITE_EEPROM_IMAGE);
+    rc = ariesWriteEEPROMImageUntracked(device, values, legacyMode);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer resets are toggled while writing the EEPROM
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
 /*
  * Verify the FW image in the EEPROM connected to the Retimer.
  */
-AriesErrorType ariesVerifyEEPROMImage(
+static AriesErrorType ariesVerifyEEPROMImageUntracked(
         AriesDeviceType* device,
         uint8_t* values,
         bool legacyMode)
@@ -1135,10 +1596,29 @@ AriesErrorType ariesVerifyEEPROMImage(
 }
 
 
+/*
+ * Wrapper which attributes I2C transactions to ariesVerifyEEPROMImage()
+ */
+AriesErrorType ariesVerifyEEPROMImage(
+        AriesDeviceType* device,
+        uint8_t* values,
+        bool legacyMode)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_VERIFY_EEPROM_IMAGE);
+    rc = ariesVerifyEEPROMImageUntracked(device, values, legacyMode);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    return rc;
+}
+
+
 /*
  * Verify EEPROM via checksum
  */
-AriesErrorType ariesVerifyEEPROMImageViaChecksum(
+static AriesErrorType ariesVerifyEEPROMImageViaChecksumUntracked(
         AriesDeviceType* device,
         uint8_t* image)
 {
@@ -1326,6 +1806,24 @@ AriesErrorType ariesVerifyEEPROMImageViaChecksum(
 }
 
 
+/*
+ * Wrapper which attributes I2C transactions to ariesVerifyEEPROMImageViaChecksum()
+ */
+AriesErrorType ariesVerifyEEPROMImageViaChecksum(
+        AriesDeviceType* device,
+        uint8_t* image)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_VERIFY_EEPROM_IMAGE_CHECKSUM);
+    rc = ariesVerifyEEPROMImageViaChecksumUntracked(device, image);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    return rc;
+}
+
+
 /*
  * Calculate block CRCs from data in EEPROM
  */
@@ -1565,47 +2063,73 @@ AriesErrorType ariesWriteEEPROMImageDelta(
 
 
 /*
- * Read a byte from EEPROM.
+ * Get the end of the EEPROM region programmed for an image, rounded up to the
+ * Main Micro write block size
  */
-AriesErrorType ariesReadEEPROMByte(
+static int ariesGetEEPROMImageWriteEnd(
         AriesDeviceType* device,
-        int addr,
-        uint8_t* value)
+        uint8_t* image)
+{
+    int eepromEnd;
+    int eepromWriteDelta;
+
+    eepromEnd = ariesGetEEPROMImageEnd(image);
+    if (eepromEnd == -1)
+    {
+        return ARIES_EEPROM_NUM_BYTES;
+    }
+
+    eepromEnd += 8;
+    eepromWriteDelta = eepromEnd % device->fwUpdateMmAssistBlockSizeBytes;
+    if (eepromWriteDelta)
+    {
+        eepromEnd += device->fwUpdateMmAssistBlockSizeBytes - eepromWriteDelta;
+    }
+    if (eepromEnd > ARIES_EEPROM_NUM_BYTES)
+    {
+        eepromEnd = ARIES_EEPROM_NUM_BYTES;
+    }
+
+    return eepromEnd;
+}
+
+
+/*
+ * Get the checksum of the EEPROM bytes from the start of the bank holding
+ * address (addrEnd - 1) up to addrEnd. The Main Micro always sums from
+ * address 0 of a bank.
+ */
+static AriesErrorType ariesEEPROMGetBankPrefixChecksum(
+        AriesDeviceType* device,
+        int addrEnd,
+        uint32_t* checksum)
 {
     AriesErrorType rc;
+    uint8_t dataByte[1];
+    int bank;
+    int blockEnd;
 
-    // Deassert HW reset for I2C master interface
-    uint8_t tmpData[2];
-    tmpData[0] = 0;
-    tmpData[1] = 0;
-    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
-    CHECK_SUCCESS(rc);
+    bank = (addrEnd - 1) / ARIES_EEPROM_BANK_SIZE;
+    blockEnd = addrEnd - (bank * ARIES_EEPROM_BANK_SIZE);
 
-    // Toggle SW reset for I2C master interface
-    tmpData[0] = 0;
-    tmpData[1] = 2;
-    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
-    CHECK_SUCCESS(rc);
-    tmpData[0] = 0;
-    tmpData[1] = 0;
-    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    rc = ariesI2CMasterSetPage(device->i2cDriver, bank);
     CHECK_SUCCESS(rc);
 
-    // Set page address
-    uint8_t pageNum = floor(addr/ARIES_EEPROM_BANK_SIZE);
-    rc = ariesI2CMasterSetPage(device->i2cDriver, pageNum);
+    // Send EEPROM address 0
+    dataByte[0] = 0;
+    rc = ariesI2CMasterSendByte(device->i2cDriver, dataByte, 2);
     CHECK_SUCCESS(rc);
-
-    // The EEPROM access
-    rc = ariesEEPROMGetRandomByte(device->i2cDriver, addr, value);
+    dataByte[0] = 0;
+    rc = ariesI2CMasterSendByte(device->i2cDriver, dataByte, 1);
     CHECK_SUCCESS(rc);
 
-    // Assert HW/SW resets for I2C master interface
-    tmpData[0] = 0x00;
-    tmpData[1] = 0x02;
-    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
-    CHECK_SUCCESS(rc);
-    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    // A block end of 0 requests the full-bank checksum
+    if (blockEnd == ARIES_EEPROM_BANK_SIZE)
+    {
+        blockEnd = 0;
+    }
+
+    rc = ariesI2CMasterGetChecksumPolled(device, blockEnd, checksum);
     CHECK_SUCCESS(rc);
 
     return ARIES_SUCCESS;
@@ -1613,16 +2137,569 @@ AriesErrorType ariesReadEEPROMByte(
 
 
 /*
- * Write a byte to EEPROM.
+ * Get the checksum of an EEPROM page, computed by the Main Micro
  */
-AriesErrorType ariesWriteEEPROMByte(
+static AriesErrorType ariesEEPROMGetPageChecksum(
         AriesDeviceType* device,
-        int addr,
-        uint8_t* value)
+        int page,
+        int eepromEnd,
+        uint32_t* checksum)
 {
     AriesErrorType rc;
+    uint32_t prefixEnd;
+    uint32_t prefixStart = 0;
+    int pageStart = page * ARIES_EEPROM_PAGE_SIZE;
+    int pageEnd = pageStart + ARIES_EEPROM_PAGE_SIZE;
 
-    // Deassert HW reset for I2C master interface
+    if (pageEnd > eepromEnd)
+    {
+        pageEnd = eepromEnd;
+    }
+
+    rc = ariesEEPROMGetBankPrefixChecksum(device, pageEnd, &prefixEnd);
+    CHECK_SUCCESS(rc);
+    if (pageStart % ARIES_EEPROM_BANK_SIZE)
+    {
+        rc = ariesEEPROMGetBankPrefixChecksum(device, pageStart, &prefixStart);
+        CHECK_SUCCESS(rc);
+    }
+
+    *checksum = prefixEnd - prefixStart;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the checksum of a page of an image, as computed by the Main Micro
+ */
+static uint32_t ariesEEPROMImagePageChecksum(
+        uint8_t* image,
+        int page,
+        int eepromEnd)
+{
+    uint32_t checksum = 0;
+    int addr = page * ARIES_EEPROM_PAGE_SIZE;
+    int pageEnd = addr + ARIES_EEPROM_PAGE_SIZE;
+
+    if (pageEnd > eepromEnd)
+    {
+        pageEnd = eepromEnd;
+    }
+    for (; addr < pageEnd; addr++)
+    {
+        checksum += image[addr];
+    }
+
+    return checksum;
+}
+
+
+/*
+ * Write a page of an image to the EEPROM via Main Micro
+ */
+static AriesErrorType ariesEEPROMWritePage(
+        AriesDeviceType* device,
+        uint8_t* image,
+        int page,
+        int eepromEnd)
+{
+    AriesErrorType rc;
+    int pageStart = page * ARIES_EEPROM_PAGE_SIZE;
+    int numBytes = ARIES_EEPROM_PAGE_SIZE;
+
+    if ((pageStart + numBytes) > eepromEnd)
+    {
+        numBytes = eepromEnd - pageStart;
+    }
+
+    rc = ariesI2CMasterSetPage(device->i2cDriver,
+        pageStart / ARIES_EEPROM_BANK_SIZE);
+    CHECK_SUCCESS(rc);
+    rc = ariesI2CMasterMultiBlockWrite(device,
+        pageStart % ARIES_EEPROM_BANK_SIZE, numBytes, &image[pageStart]);
+    CHECK_SUCCESS(rc);
+    rc = ariesEEPROMWaitProgram(device, pageStart % ARIES_EEPROM_BANK_SIZE,
+        &image[pageStart], numBytes);
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Program EEPROM, but only rewrite pages whose checksum on the device differs
+ * from the image
+ */
+static AriesErrorType ariesWriteEEPROMImagePageDeltaUntracked(
+        AriesDeviceType* device,
+        uint8_t* image,
+        AriesEEPROMPageDeltaStatsType* stats)
+{
+    AriesErrorType rc;
+    uint8_t tmpData[2];
+    uint16_t changedPages[ARIES_EEPROM_PAGE_COUNT];
+    uint32_t prefixChecksum;
+    uint32_t prevPrefixChecksum = 0;
+    uint32_t checksum = 0;
+    uint32_t expected;
+    int eepromEnd;
+    int page;
+    int pageEnd;
+    int changeIdx;
+    int writeIdx;
+    bool pageOkay;
+    time_t start_t, end_t;
+
+    memset(stats, 0, sizeof(AriesEEPROMPageDeltaStatsType));
+    memset(&device->eepromProgStats, 0, sizeof(AriesEEPROMProgramStatsType));
+
+    if (!ariesEEPROMMainMicroAssist(device))
+    {
+        ASTERA_ERROR("Page delta update requires Main Micro assisted EEPROM access");
+        return ARIES_EEPROM_WRITE_ERROR;
+    }
+
+    eepromEnd = ariesGetEEPROMImageWriteEnd(device, image);
+    stats->numPages = (eepromEnd + ARIES_EEPROM_PAGE_SIZE - 1) /
+        ARIES_EEPROM_PAGE_SIZE;
+
+    // Deassert HW and SW resets and reset I2C Master
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+    tmpData[0] = 0;
+    tmpData[1] = 2;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+
+    rc = ariesI2cMasterSoftReset(device->i2cDriver);
+    CHECK_SUCCESS(rc);
+    usleep(2000);
+
+    // Init I2C Master
+    rc = ariesI2CMasterInit(device->i2cDriver);
+    CHECK_SUCCESS(rc);
+
+    // Start timer
+    time(&start_t);
+
+    // Update device FW update progress state
+    device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_WRITE_0;
+
+    // Checksums are summed from the start of a bank, so the checksum of a page
+    // is the difference of the checksums up to its end and up to its start
+    ASTERA_INFO("Comparing EEPROM page checksums with image");
+    for (page = 0; page < stats->numPages; page++)
+    {
+        if (((page * ARIES_EEPROM_PAGE_SIZE) % ARIES_EEPROM_BANK_SIZE) == 0)
+        {
+            prevPrefixChecksum = 0;
+        }
+        pageEnd = (page + 1) * ARIES_EEPROM_PAGE_SIZE;
+        if (pageEnd > eepromEnd)
+        {
+            pageEnd = eepromEnd;
+        }
+
+        rc = ariesEEPROMGetBankPrefixChecksum(device, pageEnd, &prefixChecksum);
+        CHECK_SUCCESS(rc);
+        if ((prefixChecksum - prevPrefixChecksum) !=
+            ariesEEPROMImagePageChecksum(image, page, eepromEnd))
+        {
+            changedPages[stats->numPagesChanged] = page;
+            stats->numPagesChanged++;
+        }
+        prevPrefixChecksum = prefixChecksum;
+    }
+    ASTERA_INFO("%d of %d EEPROM pages differ from image",
+        stats->numPagesChanged, stats->numPages);
+
+    // Rewrite the pages which differ
+    for (changeIdx = 0; changeIdx < stats->numPagesChanged; changeIdx++)
+    {
+        rc = ariesEEPROMWritePage(device, image, changedPages[changeIdx],
+            eepromEnd);
+        CHECK_SUCCESS(rc);
+        stats->numPageWrites++;
+
+        // Calculate and update progress
+        uint8_t prog = 10 * (changeIdx + 1) / stats->numPagesChanged;
+        device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_WRITE_0 + prog;
+    }
+
+    // Update device FW update progress state
+    device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_VERIFY_0;
+
+    // Verify the rewritten pages, writing them again on a mismatch
+    for (changeIdx = 0; changeIdx < stats->numPagesChanged; changeIdx++)
+    {
+        page = changedPages[changeIdx];
+        expected = ariesEEPROMImagePageChecksum(image, page, eepromEnd);
+        pageOkay = false;
+        for (writeIdx = 1; writeIdx <= ARIES_EEPROM_DELTA_PAGE_WRITE_TRIES;
+            writeIdx++)
+        {
+            if (writeIdx > 1)
+            {
+                ASTERA_WARN("Page %d: checksum mismatch, rewriting", page);
+                rc = ariesEEPROMWritePage(device, image, page, eepromEnd);
+                CHECK_SUCCESS(rc);
+                stats->numPageWrites++;
+            }
+            rc = ariesEEPROMGetPageChecksum(device, page, eepromEnd,
+                &checksum);
+            CHECK_SUCCESS(rc);
+            if (checksum == expected)
+            {
+                pageOkay = true;
+                break;
+            }
+        }
+
+        if (!pageOkay)
+        {
+            ASTERA_ERROR("Page %d: checksum did not match expected value", page);
+            ASTERA_ERROR("    Expected: %d", expected);
+            ASTERA_ERROR("    Received: %d", checksum);
+            stats->numPagesFailed++;
+        }
+
+        // Calculate and update progress
+        uint8_t prog = 10 * (changeIdx + 1) / stats->numPagesChanged;
+        device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_VERIFY_0 + prog;
+    }
+
+    // Stop timer
+    time(&end_t);
+    ASTERA_INFO("EEPROM page delta update time: %.2f seconds",
+        difftime(end_t, start_t));
+
+    // Update device FW update progress state
+    device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_VERIFY_DONE;
+
+    // Assert HW resets for I2C master interface
+    tmpData[0] = 0x00;
+    tmpData[1] = 0x02;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+
+    usleep(1000);
+
+    if (stats->numPagesFailed)
+    {
+        return ARIES_EEPROM_VERIFY_FAILURE;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesWriteEEPROMImagePageDelta()
+ */
+AriesErrorType ariesWriteEEPROMImagePageDelta(
+        AriesDeviceType* device,
+        uint8_t* image,
+        AriesEEPROMPageDeltaStatsType* stats)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_WRITE_EEPROM_IMAGE_PAGE_DELTA);
+    rc = ariesWriteEEPROMImagePageDeltaUntracked(device, image, stats);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer resets are toggled while writing the EEPROM
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
+/*
+ * Sum the EEPROM bytes in [addrStart, addrEnd) via I2C Master reads. The
+ * address is sent once per bank and the bytes are then read as a continuous
+ * stream.
+ */
+static AriesErrorType ariesEEPROMReadRangeSum(
+        AriesDeviceType* device,
+        int addrStart,
+        int addrEnd,
+        uint32_t* checksum)
+{
+    AriesErrorType rc;
+    uint8_t value[1];
+    int addr;
+    bool firstByte = true;
+
+    *checksum = 0;
+    for (addr = addrStart; addr < addrEnd; addr++)
+    {
+        if (firstByte || ((addr % ARIES_EEPROM_BANK_SIZE) == 0))
+        {
+            rc = ariesI2CMasterSetPage(device->i2cDriver,
+                addr / ARIES_EEPROM_BANK_SIZE);
+            CHECK_SUCCESS(rc);
+            rc = ariesI2CMasterSendAddress(device->i2cDriver,
+                addr % ARIES_EEPROM_BANK_SIZE);
+            CHECK_SUCCESS(rc);
+            rc = ariesI2CMasterReceiveByte(device->i2cDriver, value);
+            CHECK_SUCCESS(rc);
+            firstByte = false;
+        }
+        else
+        {
+            rc = ariesI2CMasterReceiveContinuousByte(device->i2cDriver, value);
+            CHECK_SUCCESS(rc);
+        }
+        *checksum += value[0];
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the checksums of an EEPROM address range, one per page or bank the
+ * range overlaps
+ */
+static AriesErrorType ariesEEPROMGetRangeChecksumsUntracked(
+        AriesDeviceType* device,
+        int startAddr,
+        int numBytes,
+        AriesEEPROMChecksumUnitType unit,
+        uint32_t* checksums,
+        int maxChecksums,
+        int* numChecksums)
+{
+    AriesErrorType rc;
+    uint8_t tmpData[2];
+    uint32_t prefixChecksum;
+    uint32_t prevPrefixChecksum = 0;
+    int unitSize;
+    int firstUnit;
+    int idx;
+    int segStart;
+    int segEnd;
+    int endAddr = startAddr + numBytes;
+    bool mainMicroAssist;
+    time_t start_t, end_t;
+
+    *numChecksums = 0;
+
+    if ((numBytes <= 0) || (startAddr < 0) ||
+        (endAddr > ARIES_EEPROM_NUM_BYTES))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    if (unit == ARIES_EEPROM_CHECKSUM_UNIT_PAGE)
+    {
+        unitSize = ARIES_EEPROM_PAGE_SIZE;
+    }
+    else if (unit == ARIES_EEPROM_CHECKSUM_UNIT_BANK)
+    {
+        unitSize = ARIES_EEPROM_BANK_SIZE;
+    }
+    else
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    firstUnit = startAddr / unitSize;
+    if ((((endAddr - 1) / unitSize) - firstUnit + 1) > maxChecksums)
+    {
+        ASTERA_ERROR("Range needs %d checksums, only room for %d",
+            ((endAddr - 1) / unitSize) - firstUnit + 1, maxChecksums);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    mainMicroAssist = ariesEEPROMMainMicroAssist(device);
+
+    // Deassert HW and SW resets and reset I2C Master
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+    tmpData[0] = 0;
+    tmpData[1] = 2;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+
+    if (mainMicroAssist)
+    {
+        rc = ariesI2cMasterSoftReset(device->i2cDriver);
+        CHECK_SUCCESS(rc);
+        usleep(2000);
+
+        // Init I2C Master
+        rc = ariesI2CMasterInit(device->i2cDriver);
+        CHECK_SUCCESS(rc);
+    }
+
+    // Start timer
+    time(&start_t);
+
+    // Checksums are summed from the start of a bank, so the checksum of a
+    // segment is the difference of the checksums up to its end and up to its
+    // start. Segments are contiguous, so the end of one is the start of the
+    // next and only the first may need its start computed separately.
+    segEnd = startAddr;
+    for (idx = 0; segEnd < endAddr; idx++)
+    {
+        segStart = segEnd;
+        segEnd = (firstUnit + idx + 1) * unitSize;
+        if (segEnd > endAddr)
+        {
+            segEnd = endAddr;
+        }
+
+        if (mainMicroAssist)
+        {
+            if ((segStart % ARIES_EEPROM_BANK_SIZE) == 0)
+            {
+                prevPrefixChecksum = 0;
+            }
+            else if (idx == 0)
+            {
+                rc = ariesEEPROMGetBankPrefixChecksum(device, segStart,
+                    &prevPrefixChecksum);
+                CHECK_SUCCESS(rc);
+            }
+            rc = ariesEEPROMGetBankPrefixChecksum(device, segEnd,
+                &prefixChecksum);
+            CHECK_SUCCESS(rc);
+            checksums[idx] = prefixChecksum - prevPrefixChecksum;
+            prevPrefixChecksum = prefixChecksum;
+        }
+        else
+        {
+            rc = ariesEEPROMReadRangeSum(device, segStart, segEnd,
+                &checksums[idx]);
+            CHECK_SUCCESS(rc);
+        }
+    }
+    *numChecksums = idx;
+
+    // Stop timer
+    time(&end_t);
+    ASTERA_INFO("EEPROM range checksum time: %.2f seconds",
+        difftime(end_t, start_t));
+
+    // Assert HW resets for I2C master interface
+    tmpData[0] = 0x00;
+    tmpData[1] = 0x02;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+
+    usleep(1000);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesEEPROMGetRangeChecksums()
+ */
+AriesErrorType ariesEEPROMGetRangeChecksums(
+        AriesDeviceType* device,
+        int startAddr,
+        int numBytes,
+        AriesEEPROMChecksumUnitType unit,
+        uint32_t* checksums,
+        int maxChecksums,
+        int* numChecksums)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_EEPROM_RANGE_CHECKSUMS);
+    rc = ariesEEPROMGetRangeChecksumsUntracked(device, startAddr, numBytes,
+        unit, checksums, maxChecksums, numChecksums);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    // Retimer resets are toggled while reading the EEPROM
+    ariesDeviceCacheInvalidate(device);
+    return rc;
+}
+
+
+/*
+ * Read a byte from EEPROM.
+ */
+AriesErrorType ariesReadEEPROMByte(
+        AriesDeviceType* device,
+        int addr,
+        uint8_t* value)
+{
+    AriesErrorType rc;
+
+    // Deassert HW reset for I2C master interface
+    uint8_t tmpData[2];
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+
+    // Toggle SW reset for I2C master interface
+    tmpData[0] = 0;
+    tmpData[1] = 2;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+    tmpData[0] = 0;
+    tmpData[1] = 0;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+
+    // Set page address
+    uint8_t pageNum = floor(addr/ARIES_EEPROM_BANK_SIZE);
+    rc = ariesI2CMasterSetPage(device->i2cDriver, pageNum);
+    CHECK_SUCCESS(rc);
+
+    // The EEPROM access
+    rc = ariesEEPROMGetRandomByte(device->i2cDriver, addr, value);
+    CHECK_SUCCESS(rc);
+
+    // Assert HW/SW resets for I2C master interface
+    tmpData[0] = 0x00;
+    tmpData[1] = 0x02;
+    rc = ariesWriteBlockData(device->i2cDriver, 0x600, 2, tmpData); // hw_rst
+    CHECK_SUCCESS(rc);
+    rc = ariesWriteBlockData(device->i2cDriver, 0x602, 2, tmpData); // sw_rst
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Write a byte to EEPROM.
+ */
+AriesErrorType ariesWriteEEPROMByte(
+        AriesDeviceType* device,
+        int addr,
+        uint8_t* value)
+{
+    AriesErrorType rc;
+
+    // Deassert HW reset for I2C master interface
     uint8_t tmpData[2];
     tmpData[0] = 0;
     tmpData[1] = 0;
@@ -1743,7 +2820,7 @@ AriesErrorType ariesCheckConnectionHealth(
  * Check if device has loaded firmware properly, and if retimer slave address
  * is correct
  */
-AriesErrorType ariesCheckDeviceHealth(
+static AriesErrorType ariesCheckDeviceHealthUntracked(
         AriesDeviceType* device)
 {
     AriesErrorType rc;
@@ -1778,19 +2855,34 @@ AriesErrorType ariesCheckDeviceHealth(
 
 
 /*
- * Check link health.
- * Check for eye height, width against thresholds
- * Check for temperature thresholds
+ * Wrapper which attributes I2C transactions to ariesCheckDeviceHealth()
  */
-AriesErrorType ariesCheckLinkHealth(
-        AriesLinkType* link)
+AriesErrorType ariesCheckDeviceHealth(
+        AriesDeviceType* device)
 {
+    AriesI2CStatsApiType prevApi;
     AriesErrorType rc;
 
-    link->state.linkOkay = true;
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_CHECK_DEVICE_HEALTH);
+    rc = ariesCheckDeviceHealthUntracked(device);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    return rc;
+}
 
-    rc = ariesGetLinkState(link);
-    CHECK_SUCCESS(rc);
+
+/*
+ * Read current and max temperature, and over-temp flag, and check against
+ * thresholds
+ */
+static AriesErrorType ariesLinkHealthCheckTemp(
+        AriesLinkType* link,
+        bool* okay)
+{
+    AriesErrorType rc;
+    uint8_t dataByte[1];
+
+    *okay = true;
 
     // Get current temperature and check against threshold
     rc = ariesReadPmaAvgTemp(link->device);
@@ -1801,7 +2893,7 @@ AriesErrorType ariesCheckLinkHealth(
         ASTERA_ERROR("Temperature alert! Current (average) temp observed is above threshold");
         ASTERA_ERROR("    Cur Temp observed (+uncertainty) = %f", (link->device->currentTempC+ARIES_TEMP_CALIBRATION_OFFSET));
         ASTERA_ERROR("    Alert threshold = %f", link->device->tempAlertThreshC);
-        link->state.linkOkay = false;
+        *okay = false;
     }
     else if ((link->device->currentTempC + ARIES_TEMP_CALIBRATION_OFFSET) >=
             link->device->tempWarnThreshC)
@@ -1820,7 +2912,7 @@ AriesErrorType ariesCheckLinkHealth(
         ASTERA_ERROR("Temperature alert! All-time max temp observed is above threshold");
         ASTERA_ERROR("    Max Temp observed (+uncertainty) = %f", (link->device->maxTempC+ARIES_TEMP_CALIBRATION_OFFSET));
         ASTERA_ERROR("    Alert threshold = %f", link->device->tempAlertThreshC);
-        link->state.linkOkay = false;
+        *okay = false;
     }
     else if ((link->device->maxTempC + ARIES_TEMP_CALIBRATION_OFFSET) >=
             link->device->tempWarnThreshC)
@@ -1832,7 +2924,6 @@ AriesErrorType ariesCheckLinkHealth(
 
     // Check over-temp alert
     // Read bit 0 from 0xD to check over-temp flag
-    uint8_t dataByte[1];
     rc = ariesReadByteData(link->device->i2cDriver, 0xD, dataByte);
     CHECK_SUCCESS(rc);
     // If bit 0 is 1, set temp alert as true
@@ -1845,14 +2936,33 @@ AriesErrorType ariesCheckLinkHealth(
         link->device->overtempAlert = false;
     }
 
-    // Get orientation - normal or reversed
-    // 0 is normal, 1 is reversed
-    int orientation;
-    rc = ariesGetPortOrientation(link->device, &orientation);
-    CHECK_SUCCESS(rc);
+    return ARIES_SUCCESS;
+}
+
 
+/*
+ * Read min FoM across all lanes of both pseudo ports and check against
+ * threshold. Requires current link state (width, rate).
+ */
+static AriesErrorType ariesLinkHealthCheckFoM(
+        AriesLinkType* link,
+        int orientation,
+        bool* okay)
+{
+    AriesErrorType rc;
     int upstreamSide;
     int downstreamSide;
+    int laneIndex;
+    int absLane;
+    int pathID;
+    int lane;
+    int startLane;
+    uint8_t dataWord[2];
+    uint8_t minFoM = 0xff;
+    uint8_t thisLaneFoM;
+    char* minFoMRx = "A_PER0";
+
+    *okay = true;
 
     if (orientation == 0)
     {
@@ -1865,26 +2975,8 @@ AriesErrorType ariesCheckLinkHealth(
         downstreamSide = 1;
     }
 
-    // Check Link State
-    // Set linkOkay to false if link is not in FWd state
-    if (link->state.state != ARIES_STATE_FWD)
-    {
-        link->state.linkOkay = false;
-    }
-
-    // Check link FoM values
-    int laneIndex;
-    int absLane;
-
-    int pathID;
-    int lane;
-
-    int startLane = ariesGetStartLane(link);
-
-    uint8_t dataWord[2];
-    uint8_t minFoM = 0xff;
-    uint8_t thisLaneFoM;
-    char* minFoMRx = "A_PER0";
+    startLane = ariesGetStartLane(link);
+
     for (laneIndex = 0; laneIndex < link->state.width; laneIndex++)
     {
         absLane = startLane + laneIndex;
@@ -1947,15 +3039,28 @@ AriesErrorType ariesCheckLinkHealth(
     if ((link->state.linkMinFoM <= link->device->minLinkFoMAlert)
             && (link->state.rate >= 3))
     {
-        link->state.linkOkay = false;
+        *okay = false;
         ASTERA_ERROR("Lane FoM alert! %s FoM below threshold (Val: 0x%02x)",
                 link->state.linkMinFoMRx, link->state.linkMinFoM);
     }
 
-    // Capture the recovery count
-    int recoveryCount = 0;
-    rc = ariesGetLinkRecoveryCount(link, &recoveryCount);
-    CHECK_SUCCESS(rc);
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Read median DPLL frequency code of all lanes of both pseudo ports and
+ * check against thresholds. Requires current link state (width).
+ */
+static AriesErrorType ariesLinkHealthCheckDPLL(
+        AriesLinkType* link,
+        int orientation)
+{
+    AriesErrorType rc;
+    int upstreamSide;
+    int downstreamSide;
+    int laneIndex;
+    int startLane;
 
     // Take a median of 7 readings
     uint16_t DPLLfreqs[ARIES_NUM_DPLL_FREQ_READINGS];
@@ -1964,97 +3069,445 @@ AriesErrorType ariesCheckLinkHealth(
     uint8_t dpll_i;
     uint8_t try_i;
 
+    if (orientation == 0)
+    {
+        upstreamSide = 1;
+        downstreamSide = 0;
+    }
+    else
+    {
+        upstreamSide = 0;
+        downstreamSide = 1;
+    }
+
+    startLane = ariesGetStartLane(link);
+
     // Initialize mins and maxs
     link->state.usppState.minDPLLCode = 0xffff;
     link->state.usppState.maxDPLLCode = 0x0;
     link->state.dsppState.minDPLLCode = 0xffff;
     link->state.dsppState.maxDPLLCode = 0x0;
 
-    for (laneIndex = 0; laneIndex < link->state.width; laneIndex++)
+    for (laneIndex = 0; laneIndex < link->state.width; laneIndex++)
+    {
+        int absLane = startLane + laneIndex;
+
+        try_i = 0;
+        while (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES)
+        {
+            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
+            {
+                rc = ariesGetDPLLFreq(link, upstreamSide, absLane, &DPLLVal);
+                CHECK_SUCCESS(rc);
+                DPLLfreqs[dpll_i] = DPLLVal;
+            }
+
+            DPLLFreq = ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
+
+            if ((DPLLFreq >= 4098) && (DPLLFreq <= 12288))
+            {
+                break;
+            }
+            try_i++;
+        }
+
+        link->state.usppState.rxState[laneIndex].DPLLCode = DPLLFreq;
+        if (DPLLFreq < link->state.usppState.minDPLLCode)
+        {
+            link->state.usppState.minDPLLCode = DPLLFreq;
+        }
+        if (DPLLFreq > link->state.usppState.maxDPLLCode)
+        {
+            link->state.usppState.maxDPLLCode = DPLLFreq;
+        }
+
+        if (link->device->minDPLLFreqAlert > DPLLFreq)
+        {
+            ASTERA_WARN("DPLL Frequency low [Side: %d, Lane: %d, Freq: %d]",
+                    upstreamSide, laneIndex, DPLLFreq);
+        }
+        else if (link->device->maxDPLLFreqAlert < DPLLFreq)
+        {
+            ASTERA_WARN("DPLL Frequency high [Side: %d, Lane: %d, Freq: %d]",
+                    upstreamSide, laneIndex, DPLLFreq);
+        }
+
+        try_i = 0;
+        while (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES)
+        {
+            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
+            {
+                rc = ariesGetDPLLFreq(link, downstreamSide, absLane, &DPLLVal);
+                CHECK_SUCCESS(rc);
+                DPLLfreqs[dpll_i] = DPLLVal;
+            }
+
+            DPLLFreq = ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
+
+            if ((DPLLFreq >= 4098) && (DPLLFreq <= 12288))
+            {
+                break;
+            }
+            try_i++;
+        }
+        link->state.dsppState.rxState[laneIndex].DPLLCode = DPLLFreq;
+        if (DPLLFreq < link->state.dsppState.minDPLLCode)
+        {
+            link->state.dsppState.minDPLLCode = DPLLFreq;
+        }
+        if (DPLLFreq > link->state.dsppState.maxDPLLCode)
+        {
+            link->state.dsppState.maxDPLLCode = DPLLFreq;
+        }
+
+        if (link->device->minDPLLFreqAlert > DPLLFreq)
+        {
+            ASTERA_WARN("DPLL Frequency low [Side: %d, Lane: %d, Freq: %d]",
+                    downstreamSide, laneIndex, DPLLFreq);
+        }
+        else if (link->device->maxDPLLFreqAlert < DPLLFreq)
+        {
+            ASTERA_WARN("DPLL Frequency high [Side: %d, Lane: %d, Freq: %d]",
+                    downstreamSide, laneIndex, DPLLFreq);
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Check link health.
+ * Check for eye height, width against thresholds
+ * Check for temperature thresholds
+ */
+static AriesErrorType ariesCheckLinkHealthUntracked(
+        AriesLinkType* link)
+{
+    AriesErrorType rc;
+    bool okay;
+    int orientation;
+    int recoveryCount = 0;
+
+    link->state.linkOkay = true;
+
+    rc = ariesGetLinkState(link);
+    CHECK_SUCCESS(rc);
+
+    rc = ariesLinkHealthCheckTemp(link, &okay);
+    CHECK_SUCCESS(rc);
+    link->state.linkOkay &= okay;
+
+    // Get orientation - normal or reversed
+    // 0 is normal, 1 is reversed
+    rc = ariesGetPortOrientation(link->device, &orientation);
+    CHECK_SUCCESS(rc);
+
+    // Check Link State
+    // Set linkOkay to false if link is not in FWd state
+    if (link->state.state != ARIES_STATE_FWD)
+    {
+        link->state.linkOkay = false;
+    }
+
+    // Check link FoM values
+    rc = ariesLinkHealthCheckFoM(link, orientation, &okay);
+    CHECK_SUCCESS(rc);
+    link->state.linkOkay &= okay;
+
+    // Capture the recovery count
+    rc = ariesGetLinkRecoveryCount(link, &recoveryCount);
+    CHECK_SUCCESS(rc);
+
+    rc = ariesLinkHealthCheckDPLL(link, orientation);
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesCheckLinkHealth()
+ */
+AriesErrorType ariesCheckLinkHealth(
+        AriesLinkType* link)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(link->device->i2cDriver,
+        ARIES_I2C_STATS_API_CHECK_LINK_HEALTH);
+    rc = ariesCheckLinkHealthUntracked(link);
+    ariesI2CStatsApiExit(link->device->i2cDriver, prevApi);
+    return rc;
+}
+
+
+/*
+ * Initialize health scheduler of a link with default metric periods
+ */
+AriesErrorType ariesHealthSchedInit(
+        AriesHealthSchedType* sched,
+        AriesLinkType* link)
+{
+    if ((sched == NULL) || (link == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(sched, 0, sizeof(AriesHealthSchedType));
+    sched->link = link;
+    sched->periodMs[ARIES_HEALTH_METRIC_LINK_STATE] =
+        ARIES_HEALTH_LINK_STATE_PERIOD_MS;
+    sched->periodMs[ARIES_HEALTH_METRIC_TEMP] = ARIES_HEALTH_TEMP_PERIOD_MS;
+    sched->periodMs[ARIES_HEALTH_METRIC_RECOVERY_COUNT] =
+        ARIES_HEALTH_RECOVERY_COUNT_PERIOD_MS;
+    sched->periodMs[ARIES_HEALTH_METRIC_FOM] = ARIES_HEALTH_FOM_PERIOD_MS;
+    sched->periodMs[ARIES_HEALTH_METRIC_DPLL] = ARIES_HEALTH_DPLL_PERIOD_MS;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Set refresh period of a health metric
+ */
+AriesErrorType ariesHealthSchedSetPeriod(
+        AriesHealthSchedType* sched,
+        AriesHealthMetricType metric,
+        uint32_t periodMs)
+{
+    if ((sched == NULL) || (metric < 0) ||
+        (metric >= ARIES_HEALTH_NUM_METRICS))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    sched->periodMs[metric] = periodMs;
+    if (periodMs == 0)
+    {
+        sched->metricOkay[metric] = true;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Time until a health metric is due, in us (0 if due, -1 if disabled)
+ */
+static int64_t ariesHealthSchedDueInUs(
+        AriesHealthSchedType* sched,
+        AriesHealthMetricType metric,
+        uint64_t nowUs)
+{
+    uint64_t dueUs;
+
+    if (sched->periodMs[metric] == 0)
+    {
+        return -1;
+    }
+    if (sched->timestampUs[metric] == 0)
+    {
+        return 0;
+    }
+
+    dueUs = sched->timestampUs[metric] +
+        ((uint64_t) sched->periodMs[metric] * 1000);
+    if (dueUs <= nowUs)
+    {
+        return 0;
+    }
+    return dueUs - nowUs;
+}
+
+
+/*
+ * Read the health metrics which are due, in one pass with the bus held
+ */
+static AriesErrorType ariesHealthSchedPollUntracked(
+        AriesHealthSchedType* sched,
+        uint32_t* mask)
+{
+    AriesLinkType* link = sched->link;
+    AriesErrorType rc;
+    uint64_t nowUs;
+    int64_t dueInUs;
+    int recoveryCount;
+    int orientation;
+    int metric;
+
+    // Pick due metrics, and those which become due within the merge window
+    nowUs = ariesGetTimeUs();
+    for (metric = 0; metric < ARIES_HEALTH_NUM_METRICS; metric++)
+    {
+        dueInUs = ariesHealthSchedDueInUs(sched, metric, nowUs);
+        if ((dueInUs >= 0) && (dueInUs <= ((int64_t) sched->periodMs[metric] *
+            1000 / ARIES_HEALTH_MERGE_WINDOW_DIV)))
+        {
+            *mask |= (1 << metric);
+        }
+    }
+
+    // FoM and DPLL are read per lane of the current link width and rate
+    if ((*mask & ((1 << ARIES_HEALTH_METRIC_FOM) |
+        (1 << ARIES_HEALTH_METRIC_DPLL))) &&
+        (sched->timestampUs[ARIES_HEALTH_METRIC_LINK_STATE] == 0))
+    {
+        *mask |= (1 << ARIES_HEALTH_METRIC_LINK_STATE);
+    }
+
+    if (*mask == 0)
+    {
+        return ARIES_SUCCESS;
+    }
+
+    if (*mask & (1 << ARIES_HEALTH_METRIC_LINK_STATE))
+    {
+        rc = ariesGetLinkState(link);
+        CHECK_SUCCESS(rc);
+        sched->metricOkay[ARIES_HEALTH_METRIC_LINK_STATE] =
+            (link->state.state == ARIES_STATE_FWD);
+        sched->timestampUs[ARIES_HEALTH_METRIC_LINK_STATE] =
+            ariesGetTimeUs();
+    }
+
+    if (*mask & (1 << ARIES_HEALTH_METRIC_TEMP))
+    {
+        rc = ariesLinkHealthCheckTemp(link,
+            &sched->metricOkay[ARIES_HEALTH_METRIC_TEMP]);
+        CHECK_SUCCESS(rc);
+        sched->timestampUs[ARIES_HEALTH_METRIC_TEMP] = ariesGetTimeUs();
+    }
+
+    if (*mask & (1 << ARIES_HEALTH_METRIC_RECOVERY_COUNT))
+    {
+        rc = ariesGetLinkRecoveryCount(link, &recoveryCount);
+        CHECK_SUCCESS(rc);
+        sched->metricOkay[ARIES_HEALTH_METRIC_RECOVERY_COUNT] = true;
+        sched->timestampUs[ARIES_HEALTH_METRIC_RECOVERY_COUNT] =
+            ariesGetTimeUs();
+    }
+
+    // Orientation is kept in the device cache, so it is only read again
+    // after ariesDeviceCacheInvalidate()
+    if (*mask & ((1 << ARIES_HEALTH_METRIC_FOM) |
+        (1 << ARIES_HEALTH_METRIC_DPLL)))
+    {
+        rc = ariesGetPortOrientationCached(link->device, &orientation);
+        CHECK_SUCCESS(rc);
+    }
+
+    if (*mask & (1 << ARIES_HEALTH_METRIC_FOM))
+    {
+        rc = ariesLinkHealthCheckFoM(link, orientation,
+            &sched->metricOkay[ARIES_HEALTH_METRIC_FOM]);
+        CHECK_SUCCESS(rc);
+        sched->timestampUs[ARIES_HEALTH_METRIC_FOM] = ariesGetTimeUs();
+    }
+
+    if (*mask & (1 << ARIES_HEALTH_METRIC_DPLL))
+    {
+        rc = ariesLinkHealthCheckDPLL(link, orientation);
+        CHECK_SUCCESS(rc);
+        sched->metricOkay[ARIES_HEALTH_METRIC_DPLL] = true;
+        sched->timestampUs[ARIES_HEALTH_METRIC_DPLL] = ariesGetTimeUs();
+    }
+
+    sched->numPasses++;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Refresh due health metrics of a link and update linkOkay from the latest
+ * reading of every metric
+ */
+AriesErrorType ariesHealthSchedPoll(
+        AriesHealthSchedType* sched,
+        uint32_t* updatedMask)
+{
+    AriesI2CDriverType* i2cDriver;
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+    AriesErrorType lc;
+    uint32_t mask = 0;
+    int metric;
+
+    if ((sched == NULL) || (sched->link == NULL))
     {
-        int absLane = startLane + laneIndex;
+        return ARIES_INVALID_ARGUMENT;
+    }
+    i2cDriver = sched->link->device->i2cDriver;
 
-        try_i = 0;
-        while (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES)
-        {
-            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
-            {
-                rc = ariesGetDPLLFreq(link, upstreamSide, absLane, &DPLLVal);
-                CHECK_SUCCESS(rc);
-                DPLLfreqs[dpll_i] = DPLLVal;
-            }
+    // Hold the bus for the whole pass, so that due metrics are read back to
+    // back
+    lc = ariesLock(i2cDriver);
+    CHECK_SUCCESS(lc);
 
-            DPLLFreq = ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
+    prevApi = ariesI2CStatsApiEnter(i2cDriver,
+        ARIES_I2C_STATS_API_HEALTH_SCHED_POLL);
+    rc = ariesHealthSchedPollUntracked(sched, &mask);
+    ariesI2CStatsApiExit(i2cDriver, prevApi);
 
-            if ((DPLLFreq >= 4098) && (DPLLFreq <= 12288))
-            {
-                break;
-            }
-            try_i++;
-        }
+    lc = ariesUnlock(i2cDriver);
+    if (lc != 0)
+    {
+        ASTERA_ERROR("Aries lock not released!");
+        return lc;
+    }
+    CHECK_SUCCESS(rc);
 
-        link->state.usppState.rxState[laneIndex].DPLLCode = DPLLFreq;
-        if (DPLLFreq < link->state.usppState.minDPLLCode)
-        {
-            link->state.usppState.minDPLLCode = DPLLFreq;
-        }
-        if (DPLLFreq > link->state.usppState.maxDPLLCode)
+    sched->link->state.linkOkay = true;
+    for (metric = 0; metric < ARIES_HEALTH_NUM_METRICS; metric++)
+    {
+        if ((sched->timestampUs[metric] != 0) && !sched->metricOkay[metric])
         {
-            link->state.usppState.maxDPLLCode = DPLLFreq;
+            sched->link->state.linkOkay = false;
         }
+    }
 
-        if (link->device->minDPLLFreqAlert > DPLLFreq)
-        {
-            ASTERA_WARN("DPLL Frequency low [Side: %d, Lane: %d, Freq: %d]",
-                    upstreamSide, laneIndex, DPLLFreq);
-        }
-        else if (link->device->maxDPLLFreqAlert < DPLLFreq)
-        {
-            ASTERA_WARN("DPLL Frequency high [Side: %d, Lane: %d, Freq: %d]",
-                    upstreamSide, laneIndex, DPLLFreq);
-        }
+    if (updatedMask != NULL)
+    {
+        *updatedMask = mask;
+    }
 
-        try_i = 0;
-        while (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES)
-        {
-            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
-            {
-                rc = ariesGetDPLLFreq(link, downstreamSide, absLane, &DPLLVal);
-                CHECK_SUCCESS(rc);
-                DPLLfreqs[dpll_i] = DPLLVal;
-            }
+    return ARIES_SUCCESS;
+}
 
-            DPLLFreq = ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
 
-            if ((DPLLFreq >= 4098) && (DPLLFreq <= 12288))
-            {
-                break;
-            }
-            try_i++;
-        }
-        link->state.dsppState.rxState[laneIndex].DPLLCode = DPLLFreq;
-        if (DPLLFreq < link->state.dsppState.minDPLLCode)
-        {
-            link->state.dsppState.minDPLLCode = DPLLFreq;
-        }
-        if (DPLLFreq > link->state.dsppState.maxDPLLCode)
-        {
-            link->state.dsppState.maxDPLLCode = DPLLFreq;
-        }
+/*
+ * Get time until the next health metric is due, in ms
+ */
+uint32_t ariesHealthSchedNextDueMs(
+        AriesHealthSchedType* sched)
+{
+    uint64_t nowUs;
+    int64_t dueInUs;
+    int64_t minDueInUs = -1;
+    int metric;
 
-        if (link->device->minDPLLFreqAlert > DPLLFreq)
-        {
-            ASTERA_WARN("DPLL Frequency low [Side: %d, Lane: %d, Freq: %d]",
-                    downstreamSide, laneIndex, DPLLFreq);
-        }
-        else if (link->device->maxDPLLFreqAlert < DPLLFreq)
+    if (sched == NULL)
+    {
+        return UINT32_MAX;
+    }
+
+    nowUs = ariesGetTimeUs();
+    for (metric = 0; metric < ARIES_HEALTH_NUM_METRICS; metric++)
+    {
+        dueInUs = ariesHealthSchedDueInUs(sched, metric, nowUs);
+        if ((dueInUs >= 0) && ((minDueInUs < 0) || (dueInUs < minDueInUs)))
         {
-            ASTERA_WARN("DPLL Frequency high [Side: %d, Lane: %d, Freq: %d]",
-                    downstreamSide, laneIndex, DPLLFreq);
+            minDueInUs = dueInUs;
         }
     }
 
-    return ARIES_SUCCESS;
+    if (minDueInUs < 0)
+    {
+        return UINT32_MAX;
+    }
+    return (uint32_t) ((minDueInUs + 999) / 1000);
 }
 
 
@@ -2070,6 +3523,9 @@ AriesErrorType ariesGetLinkRecoveryCount(
     uint8_t byteVal[1];
     int address;
 
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
     // Initialize Main Micro logger
     baseAddress = link->device->mm_print_info_struct_addr;
 
@@ -2097,6 +3553,9 @@ AriesErrorType ariesClearLinkRecoveryCount(
     uint8_t dataByte[1];
     int address;
 
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
     // Initialize Main Micro logger
     baseAddress = link->device->mm_print_info_struct_addr;
 
@@ -2119,7 +3578,14 @@ AriesErrorType ariesClearLinkRecoveryCount(
 AriesErrorType ariesGetMaxTemp(
         AriesDeviceType* device)
 {
-    return ariesReadPmaTempMax(device);
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_GET_MAX_TEMP);
+    rc = ariesReadPmaTempMax(device);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    return rc;
 }
 
 
@@ -2129,27 +3595,74 @@ AriesErrorType ariesGetMaxTemp(
 AriesErrorType ariesGetCurrentTemp(
         AriesDeviceType* device)
 {
-    return ariesReadPmaAvgTemp(device);
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(device->i2cDriver,
+        ARIES_I2C_STATS_API_GET_CURRENT_TEMP);
+    rc = ariesReadPmaAvgTemp(device);
+    ariesI2CStatsApiExit(device->i2cDriver, prevApi);
+    return rc;
 }
 
 
 /*
- * Get the current Link state.
+ * Get the MM link struct address of a link, from the device cache if valid
  */
-AriesErrorType ariesGetLinkState(
-        AriesLinkType* link)
+static AriesErrorType ariesGetLinkStructAddr(
+        AriesDeviceType* device,
+        int linkNum,
+        uint16_t* linkStructAddr)
 {
     AriesErrorType rc;
-    AriesBifurcationType bifMode;
-    uint8_t dataByte[1];
     uint8_t dataWord[2];
-    uint32_t baseAddress;
     uint32_t addressOffset;
+
+    if ((linkNum < 0) || (linkNum >= 8))
+    {
+        return ARIES_LINK_CONFIG_INVALID;
+    }
+
+    if (device->cache.linkStructAddrValid & (1 << linkNum))
+    {
+        *linkStructAddr = device->cache.linkStructAddr[linkNum];
+        return ARIES_SUCCESS;
+    }
+
+    addressOffset = ARIES_MAIN_MICRO_FW_INFO +
+        ARIES_MM_LINK_STRUCT_ADDR_OFFSET +
+        (linkNum*ARIES_LINK_ADDR_EL_SIZE);
+
+    rc = ariesReadBlockDataMainMicroIndirect(device->i2cDriver,
+            addressOffset, 2, dataWord);
+    CHECK_SUCCESS(rc);
+    *linkStructAddr = dataWord[0] + (dataWord[1] << 8);
+
+    device->cache.linkStructAddr[linkNum] = *linkStructAddr;
+    device->cache.linkStructAddrValid |= (1 << linkNum);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the Main Micro SRAM address at which link struct members are available
+ */
+static AriesErrorType ariesGetLinkStructBaseAddr(
+        AriesLinkType* link,
+        uint32_t* baseAddress)
+{
+    AriesErrorType rc;
+    AriesBifurcationType bifMode;
+    uint16_t linkStructAddr;
     int linkNum;
     int linkIdx;
 
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
     // Get current bifurcation settings
-    rc = ariesGetBifurcationMode(link->device, &bifMode);
+    rc = ariesGetBifurcationModeCached(link->device, &bifMode);
     CHECK_SUCCESS(rc);
 
     // Get link number in bifurcation mode
@@ -2175,19 +3688,31 @@ AriesErrorType ariesGetLinkState(
     // The link path struct sits on top of the MM link struct
     // Hence need to compute this offset first, before getting link struct
     // parameters
-    addressOffset = ARIES_MAIN_MICRO_FW_INFO +
-        ARIES_MM_LINK_STRUCT_ADDR_OFFSET +
-        (linkNum*ARIES_LINK_ADDR_EL_SIZE);
-
-    rc = ariesReadBlockDataMainMicroIndirect(link->device->i2cDriver,
-            addressOffset, 2, dataWord);
+    rc = ariesGetLinkStructAddr(link->device, linkNum, &linkStructAddr);
     CHECK_SUCCESS(rc);
-    int linkStructAddr = dataWord[0] + (dataWord[1] << 8);
 
     // Compute offset, at which link struct members are available
-    baseAddress = AL_MAIN_SRAM_DMEM_OFFSET + linkStructAddr +
+    *baseAddress = AL_MAIN_SRAM_DMEM_OFFSET + linkStructAddr +
         (link->device->linkPathStructSize*2);
 
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the current Link state.
+ */
+static AriesErrorType ariesGetLinkStateUntracked(
+        AriesLinkType* link)
+{
+    AriesErrorType rc;
+    uint8_t dataByte[1];
+    uint32_t baseAddress;
+    uint32_t addressOffset;
+
+    rc = ariesGetLinkStructBaseAddr(link, &baseAddress);
+    CHECK_SUCCESS(rc);
+
     // Read link width
     // Detected link width is offset at 46 from base address
     /*addressOffset = baseAddress + ARIES_LINK_STRUCT_DETECTED_WIDTH_OFFSET;*/
@@ -2225,16 +3750,32 @@ AriesErrorType ariesGetLinkState(
 }
 
 
+/*
+ * Wrapper which attributes I2C transactions to ariesGetLinkState()
+ */
+AriesErrorType ariesGetLinkState(
+        AriesLinkType* link)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(link->device->i2cDriver,
+        ARIES_I2C_STATS_API_GET_LINK_STATE);
+    rc = ariesGetLinkStateUntracked(link);
+    ariesI2CStatsApiExit(link->device->i2cDriver, prevApi);
+    return rc;
+}
+
+
 /*
  * Get detailed link state
  */
-AriesErrorType ariesGetLinkStateDetailed(
+static AriesErrorType ariesGetLinkStateDetailedUntracked(
         AriesLinkType* link)
 {
     AriesErrorType rc;
     float usppSpeed = 0.0;
     float dsppSpeed = 0.0;
-    uint8_t dataWord[2];
 
     // Update link state parameters
     //rc = ariesGetLinkState(link);
@@ -2375,325 +3916,92 @@ AriesErrorType ariesGetLinkStateDetailed(
             link->state.usppState.rxState[laneIndex].physicalPinName =
                 link->device->pins[absLane].pinSet2.rxPin;
             link->state.usppState.txState[laneIndex].physicalPinName =
-                link->device->pins[absLane].pinSet2.txPin;
-        }
-    }
-
-
-    // Current TX Pre-Cursor value (valid for Gen-3 and above)
-    // else 0
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        if ((usppSpeed == 2.5) || (usppSpeed == 5))
-        {
-            link->state.usppState.txState[laneIndex].pre = 0;
-            link->state.dsppState.txState[laneIndex].pre = 0;
-        }
-        else
-        {
-            // Physical Path N drives the TX de-emphasis values for Path 1-N
-            // Hence upstream stats will be in downstream path
-            int txPre;
-            int absLane = startLane + laneIndex;
-            // Upstream direction
-            rc = ariesGetTxPre(link, absLane, downstreamDirection, &txPre);
-            CHECK_SUCCESS(rc);
-            link->state.usppState.txState[laneIndex].pre = txPre;
-
-            // Downstream parameters
-            rc = ariesGetTxPre(link, absLane, upstreamDirection, &txPre);
-            CHECK_SUCCESS(rc);
-            link->state.dsppState.txState[laneIndex].pre = txPre;
-        }
-    }
-
-    // Get TX Current Cursor value (valid for Gen-3 and above)
-    // else 0
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        if ((usppSpeed == 2.5) || (usppSpeed == 5))
-        {
-            link->state.usppState.txState[laneIndex].cur = 0;
-            link->state.dsppState.txState[laneIndex].cur = 0;
-        }
-        else
-        {
-            // Physical Path N drives the TX de-emphasis values for Path 1-N
-            // Hence upstream stats will be in downstream path
-            int txCur;
-            int absLane = startLane + laneIndex;
-            // Upstream parameters
-            rc = ariesGetTxCur(link, absLane, downstreamDirection, &txCur);
-            CHECK_SUCCESS(rc);
-            link->state.usppState.txState[laneIndex].cur = txCur;
-
-            // Downstream parameters
-            rc = ariesGetTxCur(link, absLane, upstreamDirection, &txCur);
-            CHECK_SUCCESS(rc);
-            link->state.dsppState.txState[laneIndex].cur = txCur;
-        }
-    }
-
-    // Get RX Polarity
-    // Get RX pseudoport param - opposite paths
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        int rxPolarity;
-        int absLane = startLane + laneIndex;
-        // Upstream parameters
-        rc = ariesGetRxPolarityCode(link, absLane, usppRxDirection,
-                upstreamPinSet, &rxPolarity);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].polarity = rxPolarity;
-
-        // Downstream parameters
-        rc = ariesGetRxPolarityCode(link, absLane, dsppRxDirection,
-                downstreamPinSet, &rxPolarity);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].polarity = rxPolarity;
-    }
-
-    // Get TX Post Cursor Value (valid for gen-3 and above)
-    // else get post val from tx-pre val
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        // Physical Path N drives the TX de-emphasis values for Path 1-N
-        // Hence upstream stats will be in downstream path
-        if ((usppSpeed == 2.5) || (usppSpeed == 5))
-        {
-            // For gen 1 and 2, pre-cursor mode has de-emphasis value
-            // Compute pst from this value
-            int txPre;
-            float txPst;
-            int absLane = startLane + laneIndex;
-
-            // Upstream parameters (USPP)
-            rc = ariesGetTxPre(link, absLane, downstreamDirection, &txPre);
-            CHECK_SUCCESS(rc);
-            if (txPre == 0)
-            {
-                txPst = -6;
-            }
-            else if (txPre == 1)
-            {
-                txPst = -3.5;
-            }
-            else
-            {
-                txPst = 0;
-            }
-            link->state.usppState.txState[laneIndex].pst = txPst;
-            // De-emphasis value is in tx pre cursor val
-            link->state.usppState.txState[laneIndex].de = txPre;
-
-            // Downstream parameters (DSPP)
-            rc = ariesGetTxPre(link, absLane, upstreamDirection, &txPre);
-            CHECK_SUCCESS(rc);
-            if (txPre == 0)
-            {
-                txPst = -6;
-            }
-            else if (txPre == 1)
-            {
-                txPst = -3.5;
-            }
-            else
-            {
-                txPst = 0;
-            }
-            link->state.dsppState.txState[laneIndex].pst = txPst;
-            // De-emphasis value is in tx pre cursor val
-            link->state.dsppState.txState[laneIndex].de = txPre;
-        }
-        else
-        {
-            int txPst;
-            int absLane = startLane + laneIndex;
-            // Upstream parameters
-            rc = ariesGetTxPst(link, absLane, downstreamDirection, &txPst);
-            CHECK_SUCCESS(rc);
-            link->state.usppState.txState[laneIndex].pst = txPst;
-            // De-emphasis value does not apply here
-            link->state.usppState.txState[laneIndex].de = 0;
-
-            // Downstream parameters
-            rc = ariesGetTxPst(link, absLane, upstreamDirection, &txPst);
-            CHECK_SUCCESS(rc);
-            link->state.dsppState.txState[laneIndex].pst = txPst;
-            // De-emphasis value does not apply here
-            link->state.dsppState.txState[laneIndex].de = 0;
+                link->device->pins[absLane].pinSet2.txPin;
         }
     }
 
-    // Get RX TERM (Calculate based on pseudo-port path)
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        int rxTerm;
-        int absLane = startLane + laneIndex;
-
-        // Upstream path
-        rc = ariesGetLinkRxTerm(link, upstreamSide, absLane, &rxTerm);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].termination = rxTerm;
-        // Downstream path
-        rc = ariesGetLinkRxTerm(link, downstreamSide, absLane, &rxTerm);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].termination = rxTerm;
-    }
 
-    // Get RX ATT, VGA, CTLE Boost
+    // Get TX Pre-Cursor, Current Cursor and Post Cursor values (valid for
+    // Gen-3 and above), which are fields of one register, else 0 and the
+    // post value from the de-emphasis value
     for (laneIndex = 0; laneIndex < width; laneIndex++)
     {
-        int boostCode;
-        int attCode;
-        float attValDb;
-        int vgaCode;
-        float boostValDb;
+        // Physical Path N drives the TX de-emphasis values for Path 1-N
+        // Hence upstream stats will be in downstream path
+        AriesTxStateType* txStates[2];
+        int directions[2];
+        int portIndex;
         int absLane = startLane + laneIndex;
 
-        // Upstream parameters
-        rc = ariesGetRxCtleBoostCode(link, upstreamSide, absLane, &boostCode);
-        CHECK_SUCCESS(rc);
-        rc = ariesGetRxAttCode(link, upstreamSide, absLane, &attCode);
-        CHECK_SUCCESS(rc);
-        attValDb = attCode * -1.5;
-        rc = ariesGetRxVgaCode(link, upstreamSide, absLane, &vgaCode);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].attdB = attValDb;
-        link->state.usppState.rxState[laneIndex].vgadB = vgaCode * 0.9;
-        boostValDb = ariesGetRxBoostValueDb(boostCode, attValDb, vgaCode);
-        link->state.usppState.rxState[laneIndex].ctleBoostdB = boostValDb;
+        txStates[0] = &link->state.usppState.txState[laneIndex];
+        directions[0] = downstreamDirection;
+        txStates[1] = &link->state.dsppState.txState[laneIndex];
+        directions[1] = upstreamDirection;
+        for (portIndex = 0; portIndex < 2; portIndex++)
+        {
+            int txPre;
+            int txCur;
+            int txPst;
+            rc = ariesGetTxCoeffs(link, absLane, directions[portIndex],
+                &txPre, &txCur, &txPst);
+            CHECK_SUCCESS(rc);
 
-        // Downstream parameters
-        rc = ariesGetRxCtleBoostCode(link, downstreamSide, absLane, &boostCode);
-        CHECK_SUCCESS(rc);
-        rc = ariesGetRxAttCode(link, downstreamSide, absLane, &attCode);
-        CHECK_SUCCESS(rc);
-        attValDb = attCode * -1.5;
-        rc = ariesGetRxVgaCode(link, downstreamSide, absLane, &vgaCode);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].attdB = attValDb;
-        link->state.dsppState.rxState[laneIndex].vgadB = vgaCode * 0.9;
-        boostValDb = ariesGetRxBoostValueDb(boostCode, attValDb, vgaCode);
-        link->state.dsppState.rxState[laneIndex].ctleBoostdB = boostValDb;
+            if ((usppSpeed == 2.5) || (usppSpeed == 5))
+            {
+                // For gen 1 and 2, pre-cursor mode has de-emphasis value
+                // Compute pst from this value
+                txStates[portIndex]->pre = 0;
+                txStates[portIndex]->cur = 0;
+                if (txPre == 0)
+                {
+                    txStates[portIndex]->pst = -6;
+                }
+                else if (txPre == 1)
+                {
+                    txStates[portIndex]->pst = -3.5;
+                }
+                else
+                {
+                    txStates[portIndex]->pst = 0;
+                }
+                // De-emphasis value is in tx pre cursor val
+                txStates[portIndex]->de = txPre;
+            }
+            else
+            {
+                txStates[portIndex]->pre = txPre;
+                txStates[portIndex]->cur = txCur;
+                txStates[portIndex]->pst = txPst;
+                // De-emphasis value does not apply here
+                txStates[portIndex]->de = 0;
+            }
+        }
     }
 
-    // Get RX Pole Code
+    // Get RX Polarity
+    // Get RX pseudoport param - opposite paths
     for (laneIndex = 0; laneIndex < width; laneIndex++)
     {
-        int poleCode;
+        int rxPolarity;
         int absLane = startLane + laneIndex;
-
         // Upstream parameters
-        rc = ariesGetRxCtlePoleCode(link, upstreamSide, absLane, &poleCode);
+        rc = ariesGetRxPolarityCode(link, absLane, usppRxDirection,
+                upstreamPinSet, &rxPolarity);
         CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].ctlePole = poleCode;
+        link->state.usppState.rxState[laneIndex].polarity = rxPolarity;
 
         // Downstream parameters
-        rc = ariesGetRxCtlePoleCode(link, downstreamSide, absLane, &poleCode);
+        rc = ariesGetRxPolarityCode(link, absLane, dsppRxDirection,
+                downstreamPinSet, &rxPolarity);
         CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].ctlePole = poleCode;
+        link->state.dsppState.rxState[laneIndex].polarity = rxPolarity;
     }
 
-    // Get RX DFE Values
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        int tap = 1;
-        int code;
-        float dfe;
-        int absLane = startLane + laneIndex;
-
-        for (tap = 1; tap <= 8; tap++)
-        {
-            // Upstream parameters
-            rc = ariesGetRxDfeCode(link, upstreamSide, absLane, tap, &code);
-            CHECK_SUCCESS(rc);
-
-            switch(tap)
-            {
-                case 1:
-                    dfe = code * 1.85;
-                    link->state.usppState.rxState[laneIndex].dfe1 = dfe;
-                    break;
-                case 2:
-                    dfe = code * 0.35;
-                    link->state.usppState.rxState[laneIndex].dfe2 = dfe;
-                    break;
-                case 3:
-                    dfe = code * 0.7;
-                    link->state.usppState.rxState[laneIndex].dfe3 = dfe;
-                    break;
-                case 4:
-                    dfe = code * 0.35;
-                    link->state.usppState.rxState[laneIndex].dfe4 = dfe;
-                    break;
-                case 5:
-                    dfe = code * 0.35;
-                    link->state.usppState.rxState[laneIndex].dfe5 = dfe;
-                    break;
-                case 6:
-                    dfe = code * 0.35;
-                    link->state.usppState.rxState[laneIndex].dfe6 = dfe;
-                    break;
-                case 7:
-                    dfe = code * 0.35;
-                    link->state.usppState.rxState[laneIndex].dfe7 = dfe;
-                    break;
-                case 8:
-                    dfe = code * 0.35;
-                    link->state.usppState.rxState[laneIndex].dfe8 = dfe;
-                    break;
-                default:
-                    ASTERA_ERROR("Invalid DFE tap argument");
-                    return ARIES_INVALID_ARGUMENT;
-                    break;
-            }
-
-            // Downstream parameters
-            rc = ariesGetRxDfeCode(link, downstreamSide, absLane, tap, &code);
-            CHECK_SUCCESS(rc);
-
-            switch(tap)
-            {
-                case 1:
-                    dfe = code * 1.85;
-                    link->state.dsppState.rxState[laneIndex].dfe1 = dfe;
-                    break;
-                case 2:
-                    dfe = code * 0.35;
-                    link->state.dsppState.rxState[laneIndex].dfe2 = dfe;
-                    break;
-                case 3:
-                    dfe = code * 0.7;
-                    link->state.dsppState.rxState[laneIndex].dfe3 = dfe;
-                    break;
-                case 4:
-                    dfe = code * 0.35;
-                    link->state.dsppState.rxState[laneIndex].dfe4 = dfe;
-                    break;
-                case 5:
-                    dfe = code * 0.35;
-                    link->state.dsppState.rxState[laneIndex].dfe5 = dfe;
-                    break;
-                case 6:
-                    dfe = code * 0.35;
-                    link->state.dsppState.rxState[laneIndex].dfe6 = dfe;
-                    break;
-                case 7:
-                    dfe = code * 0.35;
-                    link->state.dsppState.rxState[laneIndex].dfe7 = dfe;
-                    break;
-                case 8:
-                    dfe = code * 0.35;
-                    link->state.dsppState.rxState[laneIndex].dfe8 = dfe;
-                    break;
-                default:
-                    ASTERA_ERROR("Invalid DFE tap argument");
-                    return ARIES_INVALID_ARGUMENT;
-                    break;
-            }
-        }
-    }
+    // Get RX TERM (Calculate based on pseudo-port path), ATT, VGA, CTLE
+    // Boost and Pole, DFE, FoM and DPLL code values of all lanes in one
+    // capture
+    rc = ariesLinkCaptureRxPmaState(link, upstreamSide, downstreamSide);
+    CHECK_SUCCESS(rc);
 
     // Get Temperature Values
     // Each PMA has a temp sensor. Read that and store value accordingly in
@@ -2813,278 +4121,114 @@ AriesErrorType ariesGetLinkStateDetailed(
         link->state.coreState.dsDeskewNs[laneIndex] = status*clkPeriod;
     }
 
+    // Get FW state and RX EQ parameters. Each path micro holds them for a
+    // pair of lanes in its gp_ctrl_sts_struct, which is read once per path
+    uint8_t ctrlSts[2][ARIES_CTRL_STS_STRUCT_CAPTURE_NUM_BYTES];
     for (laneIndex = 0; laneIndex < width; laneIndex++)
     {
+        AriesPseudoPortStateType* portStates[2];
+        int* fwStates[2];
+        int rxDirections[2];
+        int txDirections[2];
+        int portIndex;
         int absLane = startLane + laneIndex;
-        int pathID = floor(absLane/4) * 4;
-        int lane = absLane % 4;
-
-        rc = ariesGetMinFoMVal(link->device, upstreamSide, pathID, lane,
-                ARIES_PMA_RAWLANE_DIG_PCS_XF_RX_ADAPT_FOM, dataWord);
-        CHECK_SUCCESS(rc);
-        // FoM value is 7:0 of word.
-        link->state.usppState.rxState[laneIndex].FoM = dataWord[0];
-
-        rc = ariesGetMinFoMVal(link->device, downstreamSide, pathID, lane,
-                ARIES_PMA_RAWLANE_DIG_PCS_XF_RX_ADAPT_FOM, dataWord);
-        CHECK_SUCCESS(rc);
-        // FoM value is 7:0 of word.
-        link->state.dsppState.rxState[laneIndex].FoM = dataWord[0];
-    }
-
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        int absLane = laneIndex + startLane;
-        int state;
-        // FW state
-        rc = ariesGetPathFWState(link, absLane, usppRxDirection, &state);
-        CHECK_SUCCESS(rc);
-        link->state.coreState.usppPathFWState[laneIndex] = state;
-        // FW state
-        rc = ariesGetPathFWState(link, absLane, dsppRxDirection, &state);
-        CHECK_SUCCESS(rc);
-        link->state.coreState.dsppPathFWState[laneIndex] = state;
-    }
-
-    // Get DPLL Codes
-    // Take a median of 7 readings
-    uint16_t DPLLfreqs[ARIES_NUM_DPLL_FREQ_READINGS];
-    uint16_t DPLLVal;
-    uint16_t DPLLFreq;
-    uint8_t dpll_i;
-    uint8_t try_i;
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        int absLane = laneIndex + startLane;
-        try_i = 0;
-        while (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES)
+        int pathLane = absLane % 2;
+        int presetReqsOffset;
+        int fomsOffset;
+        int direction;
+
+        portStates[0] = &link->state.usppState;
+        fwStates[0] = &link->state.coreState.usppPathFWState[laneIndex];
+        rxDirections[0] = usppRxDirection;
+        txDirections[0] = usppTxDirection;
+        portStates[1] = &link->state.dsppState;
+        fwStates[1] = &link->state.coreState.dsppPathFWState[laneIndex];
+        rxDirections[1] = dsppRxDirection;
+        txDirections[1] = dsppTxDirection;
+
+        if (pathLane == 0)
         {
-            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
-            {
-                rc = ariesGetDPLLFreq(link, upstreamSide, absLane, &DPLLVal);
-                CHECK_SUCCESS(rc);
-                DPLLfreqs[dpll_i] = DPLLVal;
-            }
-
-            DPLLFreq = ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
-
-            if ((DPLLFreq >= 4098) && (DPLLFreq <= 12288))
-            {
-                break;
-            }
-            try_i++;
+            presetReqsOffset = ARIES_CTRL_STS_STRUCT_LAST_EQ_PRESET_REQS_LN0;
+            fomsOffset = ARIES_CTRL_STS_STRUCT_LAST_EQ_FOMS_LN0;
+        }
+        else
+        {
+            presetReqsOffset = ARIES_CTRL_STS_STRUCT_LAST_EQ_PRESET_REQS_LN1;
+            fomsOffset = ARIES_CTRL_STS_STRUCT_LAST_EQ_FOMS_LN1;
         }
-        link->state.usppState.rxState[laneIndex].DPLLCode = DPLLFreq;
 
-        try_i = 0;
-        while (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES)
+        // Both lanes of a path share its struct, and the RX path of one
+        // pseudo port is the TX path of the other
+        if ((laneIndex == 0) || (pathLane == 0))
         {
-            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
+            for (direction = 0; direction < 2; direction++)
             {
-                rc = ariesGetDPLLFreq(link, downstreamSide, absLane, &DPLLVal);
+                rc = ariesGetPathCtrlSts(link, absLane, direction,
+                    ctrlSts[direction]);
                 CHECK_SUCCESS(rc);
-                DPLLfreqs[dpll_i] = DPLLVal;
             }
+        }
 
-            DPLLFreq = ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
-
-            if ((DPLLFreq >= 4098) && (DPLLFreq <= 12288))
-            {
-                break;
-            }
-            try_i++;
+        for (portIndex = 0; portIndex < 2; portIndex++)
+        {
+            AriesRxStateType* rxState =
+                &portStates[portIndex]->rxState[laneIndex];
+            AriesTxStateType* txState =
+                &portStates[portIndex]->txState[laneIndex];
+            uint8_t* rxCtrlSts = ctrlSts[rxDirections[portIndex]];
+            uint8_t* txCtrlSts = ctrlSts[txDirections[portIndex]];
+
+            // FW state
+            *fwStates[portIndex] = rxCtrlSts[ARIES_CTRL_STS_STRUCT_FW_STATE];
+
+            // EQ Speed RX and TX Param
+            rxState->lastEqRate =
+                rxCtrlSts[ARIES_CTRL_STS_STRUCT_LAST_EQ_PCIE_GEN];
+            txState->lastEqRate =
+                txCtrlSts[ARIES_CTRL_STS_STRUCT_LAST_EQ_PCIE_GEN];
+
+            // Final preset request, and if it was a preset, the pre, cur
+            // and post values
+            txState->lastPresetReq = txCtrlSts[
+                ARIES_CTRL_STS_STRUCT_LAST_EQ_FINAL_REQ_PRESET_LN0 + pathLane];
+            txState->lastPreReq = txCtrlSts[
+                ARIES_CTRL_STS_STRUCT_LAST_EQ_FINAL_REQ_PRE_LN0 + pathLane];
+            txState->lastCurReq = txCtrlSts[
+                ARIES_CTRL_STS_STRUCT_LAST_EQ_FINAL_REQ_CUR_LN0 + pathLane];
+            txState->lastPstReq = txCtrlSts[
+                ARIES_CTRL_STS_STRUCT_LAST_EQ_FINAL_REQ_PST_LN0 + pathLane];
+
+            // Final, Final-1, Final-2 and Final-3 preset requests and their
+            // FOM values
+            rxState->lastPresetReq = rxCtrlSts[presetReqsOffset + 3];
+            rxState->lastPresetReqM1 = rxCtrlSts[presetReqsOffset + 2];
+            rxState->lastPresetReqM2 = rxCtrlSts[presetReqsOffset + 1];
+            rxState->lastPresetReqM3 = rxCtrlSts[presetReqsOffset];
+            rxState->lastPresetReqFom = rxCtrlSts[fomsOffset + 3];
+            rxState->lastPresetReqFomM1 = rxCtrlSts[fomsOffset + 2];
+            rxState->lastPresetReqFomM2 = rxCtrlSts[fomsOffset + 1];
+            rxState->lastPresetReqFomM3 = rxCtrlSts[fomsOffset];
         }
-        link->state.dsppState.rxState[laneIndex].DPLLCode = DPLLFreq;
     }
 
-    // Get RX EQ parameters
-    for (laneIndex = 0; laneIndex < width; laneIndex++)
-    {
-        int absLane = startLane + laneIndex;
-        int speed;
-        int presetReq;
-        int preReq;
-        int curReq;
-        int pstReq;
-        int req;
-        int req1;
-        int req2;
-        int req3;
-        int fom;
-        int fom1;
-        int fom2;
-        int fom3;
-
-        ///////////////////// Upstream parameters ///////////////////
-
-        // EQ Speed RX Param
-        rc = ariesGetLastEqSpeed(link, absLane, usppRxDirection, &speed);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastEqRate = speed;
-
-        // EQ Speed TX Param
-        rc = ariesGetLastEqSpeed(link, absLane, usppTxDirection, &speed);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.txState[laneIndex].lastEqRate = speed;
-
-        // Get EQ Preset values
-        rc = ariesGetLastEqReqPreset(link, absLane, usppTxDirection,
-                &presetReq);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.txState[laneIndex].lastPresetReq = presetReq;
-
-        // If final request was a preset, this is the pre value
-        rc = ariesGetLastEqReqPre(link, absLane, usppTxDirection,
-                &preReq);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.txState[laneIndex].lastPreReq = preReq;
-
-        // If final request was a preset, this is the current value
-        rc = ariesGetLastEqReqCur(link, absLane, usppTxDirection,
-                &curReq);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.txState[laneIndex].lastCurReq = curReq;
-
-        // If final request was a preset, this is the post value
-        rc = ariesGetLastEqReqPst(link, absLane, usppTxDirection,
-                &pstReq);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.txState[laneIndex].lastPstReq = pstReq;
-
-        // Final preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, usppRxDirection, 3,
-                &req);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReq = req;
-
-        // Final-1 preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, usppRxDirection, 2,
-                &req1);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqM1 = req1;
-
-        // Final-2 preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, usppRxDirection, 1,
-                &req2);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqM2 = req2;
-
-        // Final-3 preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, usppRxDirection, 0,
-                &req3);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqM3 = req3;
-
-        // Final preset request FOM value
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, usppRxDirection, 3,
-                &fom);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqFom = fom;
-
-        // Final-1 preset request FOM value
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, usppRxDirection, 2,
-                &fom1);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqFomM1 = fom1;
-
-        // Final-2 preset request FOM Value
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, usppRxDirection, 1,
-                &fom2);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqFomM2 = fom2;
-
-        // Final-3 preset request FOM Value
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, usppRxDirection, 0,
-                &fom3);
-        CHECK_SUCCESS(rc);
-        link->state.usppState.rxState[laneIndex].lastPresetReqFomM3 = fom3;
-
-        ///////////////////// Downstream parameters ///////////////////
-
-        // Downstream EQ speed param (RX)
-        rc = ariesGetLastEqSpeed(link, absLane, dsppRxDirection, &speed);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastEqRate = speed;
-
-        // Downstream EQ speed param (TX)
-        rc = ariesGetLastEqSpeed(link, absLane, dsppTxDirection, &speed);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.txState[laneIndex].lastEqRate = speed;
-
-        // Get EQ Preset values
-        rc = ariesGetLastEqReqPreset(link, absLane, dsppTxDirection,
-                &presetReq);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.txState[laneIndex].lastPresetReq = presetReq;
-
-        // If final request was a preset, this is the pre value
-        rc = ariesGetLastEqReqPre(link, absLane, dsppTxDirection,
-                &preReq);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.txState[laneIndex].lastPreReq = preReq;
-
-        // If final request was a preset, this is the cur value
-        rc = ariesGetLastEqReqCur(link, absLane, dsppTxDirection,
-                &curReq);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.txState[laneIndex].lastCurReq = curReq;
-
-        // If final request was a preset, this is the post value
-        rc = ariesGetLastEqReqPst(link, absLane, dsppTxDirection,
-                &pstReq);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.txState[laneIndex].lastPstReq = pstReq;
-
-        // Final preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, dsppRxDirection, 3,
-                &req);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReq = req;
-
-        // Final-1 preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, dsppRxDirection, 2,
-                &req1);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqM1 = req1;
-
-        // Final-2 preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, dsppRxDirection, 1,
-                &req2);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqM2 = req2;
-
-        // Final-3 preset request
-        rc = ariesGetLastEqPresetReq(link, absLane, dsppRxDirection, 0,
-                &req3);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqM3 = req3;
-
-        // Final preset request FOM
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, dsppRxDirection, 3,
-                &fom);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqFom = fom;
-
-        // Final-1 preset request FOM
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, dsppRxDirection, 2,
-                &fom1);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqFomM1 = fom1;
+    return ARIES_SUCCESS;
+}
 
-        // Final-2 preset request FOM
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, dsppRxDirection, 1,
-                &fom2);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqFomM2 = fom2;
 
-        // Final-3 preset request FOM
-        rc = ariesGetLastEqPresetReqFOM(link, absLane, dsppRxDirection, 0,
-                &fom3);
-        CHECK_SUCCESS(rc);
-        link->state.dsppState.rxState[laneIndex].lastPresetReqFomM3 = fom3;
-    }
+/*
+ * Wrapper which attributes I2C transactions to ariesGetLinkStateDetailed()
+ */
+AriesErrorType ariesGetLinkStateDetailed(
+        AriesLinkType* link)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
 
-    return ARIES_SUCCESS;
+    prevApi = ariesI2CStatsApiEnter(link->device->i2cDriver,
+        ARIES_I2C_STATS_API_GET_LINK_STATE_DETAILED);
+    rc = ariesGetLinkStateDetailedUntracked(link);
+    ariesI2CStatsApiExit(link->device->i2cDriver, prevApi);
+    return rc;
 }
 
 
@@ -3110,6 +4254,9 @@ AriesErrorType ariesLTSSMLoggerInit(
     int startLane = ariesGetStartLane(link);
     int baseAddress;
 
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
     // Initialize Main Micro logger
     baseAddress = link->device->mm_print_info_struct_addr;
 
@@ -3200,6 +4347,9 @@ AriesErrorType ariesLTSSMLoggerPrintEn(
 
     int startLane = ariesGetStartLane(link);
 
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
     // Do for Main Micro
     baseAddress = link->device->mm_print_info_struct_addr;
     address = baseAddress + ARIES_PRINT_INFO_STRUCT_PRINT_EN_OFFSET;
@@ -3234,7 +4384,7 @@ AriesErrorType ariesLTSSMLoggerPrintEn(
 /*
  * Read an entry from the LTSSM logger
  */
-AriesErrorType ariesLTSSMLoggerReadEntry(
+static AriesErrorType ariesLTSSMLoggerReadEntryUntracked(
         AriesLinkType* link,
         AriesLTSSMLoggerEnumType logType,
         int* offset,
@@ -3245,6 +4395,9 @@ AriesErrorType ariesLTSSMLoggerReadEntry(
     int address;
     uint8_t dataByte[1];
 
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
     // Main Micro entry
     if (logType == ARIES_LTSSM_LINK_LOGGER)
     {
@@ -3274,6 +4427,99 @@ AriesErrorType ariesLTSSMLoggerReadEntry(
 }
 
 
+/*
+ * Wrapper which attributes I2C transactions to ariesLTSSMLoggerReadEntry()
+ */
+AriesErrorType ariesLTSSMLoggerReadEntry(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType logType,
+        int* offset,
+        AriesLTSSMEntryType* entry)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(link->device->i2cDriver,
+        ARIES_I2C_STATS_API_LTSSM_LOGGER_READ_ENTRY);
+    rc = ariesLTSSMLoggerReadEntryUntracked(link, logType, offset, entry);
+    ariesI2CStatsApiExit(link->device->i2cDriver, prevApi);
+    return rc;
+}
+
+
+/*
+ * Read a range of the LTSSM logger print buffer
+ */
+static AriesErrorType ariesLTSSMLoggerReadBufferUntracked(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType logType,
+        int offset,
+        int numBytes,
+        uint8_t* values)
+{
+    AriesErrorType rc;
+    int bufferSize;
+    int address;
+
+    if (logType == ARIES_LTSSM_LINK_LOGGER)
+    {
+        bufferSize = ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE;
+    }
+    else
+    {
+        bufferSize = ARIES_PM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE;
+    }
+    if ((offset < 0) || (numBytes < 0) || ((offset + numBytes) > bufferSize))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    rc = ariesDeviceCacheLoadFwStructAddrs(link->device);
+    CHECK_SUCCESS(rc);
+
+    if (logType == ARIES_LTSSM_LINK_LOGGER)
+    {
+        address = link->device->mm_print_info_struct_addr +
+            ARIES_PRINT_INFO_STRUCT_PRINT_BUFFER_OFFSET + offset;
+        rc = ariesReadBlockDataMainMicroIndirectBulk(link->device->i2cDriver,
+            address, numBytes, values);
+        CHECK_SUCCESS(rc);
+    }
+    else
+    {
+        address = link->device->pm_print_info_struct_addr +
+            ARIES_PRINT_INFO_STRUCT_PRINT_BUFFER_OFFSET + offset;
+        rc = ariesReadBlockDataPathMicroIndirectBulk(link->device->i2cDriver,
+            logType, address, numBytes, values);
+        CHECK_SUCCESS(rc);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Wrapper which attributes I2C transactions to ariesLTSSMLoggerReadBuffer()
+ */
+AriesErrorType ariesLTSSMLoggerReadBuffer(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType logType,
+        int offset,
+        int numBytes,
+        uint8_t* values)
+{
+    AriesI2CStatsApiType prevApi;
+    AriesErrorType rc;
+
+    prevApi = ariesI2CStatsApiEnter(link->device->i2cDriver,
+        ARIES_I2C_STATS_API_LTSSM_LOGGER_READ_BUFFER);
+    rc = ariesLTSSMLoggerReadBufferUntracked(link, logType, offset, numBytes,
+        values);
+    ariesI2CStatsApiExit(link->device->i2cDriver, prevApi);
+    return rc;
+}
+
+
 /*
  * Set max data rate
  */
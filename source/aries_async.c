@@ -0,0 +1,893 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_async.c
+ * @brief Implementation of the async execution layer for the SDK.
+ */
+
+#include "../include/aries_async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Worker thread and FIFO request queue of one I2C bus
+ */
+typedef struct AriesAsyncWorker
+{
+    bool inUse;
+    int i2cBus;
+    pthread_t thread;
+    pthread_cond_t workCond;
+    bool stop;
+    AriesAsyncRequestType* head;
+    AriesAsyncRequestType* tail;
+} AriesAsyncWorkerType;
+
+static AriesAsyncWorkerType ariesAsyncWorkers[ARIES_ASYNC_MAX_BUSES];
+
+// Protects the worker table and all queues
+static pthread_mutex_t ariesAsyncMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Signalled when any request is done. It is never destroyed, so waiters do
+// not depend on the worker which ran their request
+static pthread_cond_t ariesAsyncDoneCond = PTHREAD_COND_INITIALIZER;
+
+// Set while ariesAsyncShutdown() stops the workers; submits are rejected
+static bool ariesAsyncStopping = false;
+
+
+/*
+ * Worker thread: run queued requests of one bus in order
+ */
+static void* ariesAsyncWorkerMain(
+        void* arg)
+{
+    AriesAsyncWorkerType* worker = (AriesAsyncWorkerType*) arg;
+    AriesAsyncRequestType* request;
+
+    pthread_mutex_lock(&ariesAsyncMutex);
+    while (true)
+    {
+        while ((worker->head == NULL) && !worker->stop)
+        {
+            pthread_cond_wait(&worker->workCond, &ariesAsyncMutex);
+        }
+        if (worker->head == NULL)
+        {
+            break;
+        }
+
+        request = worker->head;
+        worker->head = request->next;
+        if (worker->head == NULL)
+        {
+            worker->tail = NULL;
+        }
+        pthread_mutex_unlock(&ariesAsyncMutex);
+
+        request->rc = request->fn(request);
+        if (request->callback != NULL)
+        {
+            request->callback(request, request->userData);
+        }
+
+        pthread_mutex_lock(&ariesAsyncMutex);
+        request->done = true;
+        pthread_cond_broadcast(&ariesAsyncDoneCond);
+    }
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    return NULL;
+}
+
+
+/*
+ * Find the worker of a bus, starting it if needed. Called with
+ * ariesAsyncMutex held
+ */
+static int ariesAsyncGetWorker(
+        int i2cBus)
+{
+    int index;
+    int freeIndex = -1;
+    AriesAsyncWorkerType* worker;
+
+    for (index = 0; index < ARIES_ASYNC_MAX_BUSES; index++)
+    {
+        if (ariesAsyncWorkers[index].inUse)
+        {
+            if (ariesAsyncWorkers[index].i2cBus == i2cBus)
+            {
+                return index;
+            }
+        }
+        else if (freeIndex < 0)
+        {
+            freeIndex = index;
+        }
+    }
+
+    if (freeIndex < 0)
+    {
+        ASTERA_ERROR("No free async worker for I2C bus %d", i2cBus);
+        return -1;
+    }
+
+    worker = &ariesAsyncWorkers[freeIndex];
+    memset(worker, 0, sizeof(AriesAsyncWorkerType));
+    worker->i2cBus = i2cBus;
+    pthread_cond_init(&worker->workCond, NULL);
+    if (pthread_create(&worker->thread, NULL, ariesAsyncWorkerMain, worker)
+        != 0)
+    {
+        ASTERA_ERROR("Could not start async worker for I2C bus %d", i2cBus);
+        pthread_cond_destroy(&worker->workCond);
+        return -1;
+    }
+    worker->inUse = true;
+
+    return freeIndex;
+}
+
+
+/*
+ * Submit an operation to the worker of the device's I2C bus
+ */
+AriesErrorType ariesAsyncSubmit(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        AriesAsyncFnType fn,
+        AriesAsyncCallbackType callback,
+        void* userData)
+{
+    AriesAsyncWorkerType* worker;
+    int index;
+
+    if ((request == NULL) || (device == NULL) || (fn == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    request->device = device;
+    request->fn = fn;
+    request->callback = callback;
+    request->userData = userData;
+    request->rc = ARIES_SUCCESS;
+    request->done = false;
+    request->next = NULL;
+
+    pthread_mutex_lock(&ariesAsyncMutex);
+    if (ariesAsyncStopping)
+    {
+        ASTERA_ERROR("Async workers are shutting down");
+        index = -1;
+    }
+    else
+    {
+        index = ariesAsyncGetWorker(device->i2cBus);
+    }
+    if (index < 0)
+    {
+        // A rejected request is done, so waiting on it does not block
+        request->rc = ARIES_ASYNC_WORKER_FAILURE;
+        request->done = true;
+        pthread_mutex_unlock(&ariesAsyncMutex);
+        return ARIES_ASYNC_WORKER_FAILURE;
+    }
+    request->workerIndex = index;
+
+    worker = &ariesAsyncWorkers[index];
+    if (worker->tail == NULL)
+    {
+        worker->head = request;
+    }
+    else
+    {
+        worker->tail->next = request;
+    }
+    worker->tail = request;
+    pthread_cond_signal(&worker->workCond);
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    return ARIES_SUCCESS;
+}
+
+
+static AriesErrorType ariesAsyncCheckLinkHealthFn(
+        AriesAsyncRequestType* request)
+{
+    return ariesCheckLinkHealth(request->link);
+}
+
+
+static AriesErrorType ariesAsyncCheckDeviceHealthFn(
+        AriesAsyncRequestType* request)
+{
+    return ariesCheckDeviceHealth(request->device);
+}
+
+
+static AriesErrorType ariesAsyncGetCurrentTempFn(
+        AriesAsyncRequestType* request)
+{
+    return ariesGetCurrentTemp(request->device);
+}
+
+
+static AriesErrorType ariesAsyncLinkDumpDebugInfoFn(
+        AriesAsyncRequestType* request)
+{
+    return ariesLinkDumpDebugInfo(request->link);
+}
+
+
+static AriesErrorType ariesAsyncWriteEEPROMImageFn(
+        AriesAsyncRequestType* request)
+{
+    return ariesWriteEEPROMImage(request->device, request->image,
+        request->legacyMode);
+}
+
+
+/*
+ * Submit ariesCheckLinkHealth()
+ */
+AriesErrorType ariesAsyncCheckLinkHealth(
+        AriesAsyncRequestType* request,
+        AriesLinkType* link,
+        AriesAsyncCallbackType callback,
+        void* userData)
+{
+    request->link = link;
+    return ariesAsyncSubmit(request, link->device,
+        ariesAsyncCheckLinkHealthFn, callback, userData);
+}
+
+
+/*
+ * Submit ariesCheckDeviceHealth()
+ */
+AriesErrorType ariesAsyncCheckDeviceHealth(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        AriesAsyncCallbackType callback,
+        void* userData)
+{
+    return ariesAsyncSubmit(request, device, ariesAsyncCheckDeviceHealthFn,
+        callback, userData);
+}
+
+
+/*
+ * Submit ariesGetCurrentTemp()
+ */
+AriesErrorType ariesAsyncGetCurrentTemp(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        AriesAsyncCallbackType callback,
+        void* userData)
+{
+    return ariesAsyncSubmit(request, device, ariesAsyncGetCurrentTempFn,
+        callback, userData);
+}
+
+
+/*
+ * Submit ariesLinkDumpDebugInfo()
+ */
+AriesErrorType ariesAsyncLinkDumpDebugInfo(
+        AriesAsyncRequestType* request,
+        AriesLinkType* link,
+        AriesAsyncCallbackType callback,
+        void* userData)
+{
+    request->link = link;
+    return ariesAsyncSubmit(request, link->device,
+        ariesAsyncLinkDumpDebugInfoFn, callback, userData);
+}
+
+
+/*
+ * Submit ariesWriteEEPROMImage()
+ */
+AriesErrorType ariesAsyncWriteEEPROMImage(
+        AriesAsyncRequestType* request,
+        AriesDeviceType* device,
+        uint8_t* image,
+        bool legacyMode,
+        AriesAsyncCallbackType callback,
+        void* userData)
+{
+    request->image = image;
+    request->legacyMode = legacyMode;
+    return ariesAsyncSubmit(request, device, ariesAsyncWriteEEPROMImageFn,
+        callback, userData);
+}
+
+
+/*
+ * Get monotonic timestamp in us
+ */
+static double ariesAsyncTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
+
+
+/*
+ * Fleet health check of one link, run on the bus worker of its device
+ */
+static AriesErrorType ariesAsyncFleetHealthFn(
+        AriesAsyncRequestType* request)
+{
+    AriesFleetHealthResultType* result;
+    AriesErrorType rc;
+    double startUs;
+
+    result = (AriesFleetHealthResultType*) request->arg;
+    startUs = ariesAsyncTimeUs();
+
+    rc = ARIES_SUCCESS;
+    if (result->deviceChecked)
+    {
+        rc = ariesCheckDeviceHealth(request->device);
+    }
+    if (rc == ARIES_SUCCESS)
+    {
+        rc = ariesCheckLinkHealth(request->link);
+    }
+
+    result->deviceOkay = request->device->deviceOkay;
+    result->linkOkay = request->link->state.linkOkay;
+    result->state = request->link->state.state;
+    result->rate = request->link->state.rate;
+    result->curWidth = request->link->state.curWidth;
+    result->linkMinFoM = request->link->state.linkMinFoM;
+    result->currentTempC = request->device->currentTempC;
+    result->maxTempC = request->device->maxTempC;
+    result->durationUs = ariesAsyncTimeUs() - startUs;
+
+    return rc;
+}
+
+
+/*
+ * Check device and link health of a set of links, one worker per I2C bus
+ */
+AriesErrorType ariesFleetCheckHealth(
+        AriesLinkType** links,
+        int numLinks,
+        AriesFleetHealthResultType* results)
+{
+    AriesAsyncRequestType* requests;
+    AriesErrorType rc;
+    int numSubmitted;
+    int index;
+    int prev;
+
+    if ((links == NULL) || (results == NULL) || (numLinks < 1))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    requests = (AriesAsyncRequestType*) calloc(numLinks,
+        sizeof(AriesAsyncRequestType));
+    if (requests == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+
+    // Device health is checked once, with the first link of each device
+    for (index = 0; index < numLinks; index++)
+    {
+        memset(&results[index], 0, sizeof(AriesFleetHealthResultType));
+        results[index].link = links[index];
+        results[index].deviceChecked = true;
+        for (prev = 0; prev < index; prev++)
+        {
+            if (links[prev]->device == links[index]->device)
+            {
+                results[index].deviceChecked = false;
+                break;
+            }
+        }
+    }
+
+    // Queued in order on the worker of each bus, so the sweep takes as long
+    // as the busiest bus
+    rc = ARIES_SUCCESS;
+    for (numSubmitted = 0; numSubmitted < numLinks; numSubmitted++)
+    {
+        requests[numSubmitted].link = links[numSubmitted];
+        requests[numSubmitted].arg = &results[numSubmitted];
+        rc = ariesAsyncSubmit(&requests[numSubmitted],
+            links[numSubmitted]->device, ariesAsyncFleetHealthFn, NULL, NULL);
+        if (rc != ARIES_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    for (index = 0; index < numSubmitted; index++)
+    {
+        results[index].rc = ariesAsyncWait(&requests[index]);
+    }
+    for (index = numSubmitted; index < numLinks; index++)
+    {
+        results[index].rc = rc;
+    }
+
+    free(requests);
+
+    return rc;
+}
+
+
+/*
+ * Fleet FW update of one device, run on the bus worker of the device
+ */
+static AriesErrorType ariesAsyncFleetUpdateFn(
+        AriesAsyncRequestType* request)
+{
+    AriesFleetUpdateType* update;
+    AriesFleetUpdateResultType* result;
+    AriesErrorType rc;
+    double startUs;
+
+    update = (AriesFleetUpdateType*) request->arg;
+    result = &update->results[request - update->requests];
+    startUs = ariesAsyncTimeUs();
+
+    pthread_mutex_lock(&ariesAsyncMutex);
+    result->state = ARIES_FLEET_UPDATE_RUNNING;
+    result->startUs = startUs;
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    request->device->fwUpdateProg = ARIES_FW_UPDATE_PROGRESS_START;
+    if (update->delta)
+    {
+        rc = ariesUpdateFirmwareDeltaImage(request->device, request->image,
+            &result->deltaStats);
+    }
+    else
+    {
+        rc = ariesUpdateFirmwareImage(request->device, request->image);
+    }
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("FW update of device on I2C bus %d addr 0x%02x failed. RC = %d",
+            request->device->i2cBus, request->device->i2cDriver->slaveAddr,
+            rc);
+    }
+
+    pthread_mutex_lock(&ariesAsyncMutex);
+    result->durationUs = ariesAsyncTimeUs() - startUs;
+    result->rc = rc;
+    result->state = (rc == ARIES_SUCCESS) ? ARIES_FLEET_UPDATE_DONE :
+        ARIES_FLEET_UPDATE_FAILED;
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    return rc;
+}
+
+
+/*
+ * Start a FW update of a set of devices, one worker per I2C bus
+ */
+AriesErrorType ariesFleetUpdateFirmwareStart(
+        AriesFleetUpdateType* update,
+        AriesDeviceType** devices,
+        int numDevices,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        bool delta,
+        AriesFleetUpdateResultType* results)
+{
+    AriesErrorType rc;
+    int index;
+
+    if ((update == NULL) || (devices == NULL) || (results == NULL) ||
+        (numDevices < 1))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(update, 0, sizeof(AriesFleetUpdateType));
+    update->results = results;
+    update->numDevices = numDevices;
+    update->delta = delta;
+
+    // The image is loaded once and shared (read only) by all workers
+    rc = ariesFWImageOpen(&update->image, filename, fileType);
+    if (rc != ARIES_SUCCESS)
+    {
+        ASTERA_ERROR("Failed to load the FW image file. RC = %d", rc);
+        return rc;
+    }
+
+    if (update->image.imageEnd == -1)
+    {
+        update->imageBytes = ARIES_EEPROM_NUM_BYTES;
+    }
+    else
+    {
+        update->imageBytes = update->image.imageEnd + 8;
+    }
+
+    update->requests = (AriesAsyncRequestType*) calloc(numDevices,
+        sizeof(AriesAsyncRequestType));
+    if (update->requests == NULL)
+    {
+        ariesFWImageClose(&update->image);
+        return ARIES_FAILURE;
+    }
+
+    for (index = 0; index < numDevices; index++)
+    {
+        memset(&results[index], 0, sizeof(AriesFleetUpdateResultType));
+        results[index].device = devices[index];
+        results[index].state = ARIES_FLEET_UPDATE_QUEUED;
+    }
+
+    update->startUs = ariesAsyncTimeUs();
+
+    // Devices on different buses are updated in parallel, devices sharing a
+    // bus one after the other. A device which cannot be queued is failed on
+    // its own, the others are still updated
+    for (index = 0; index < numDevices; index++)
+    {
+        update->requests[index].image = update->image.data;
+        update->requests[index].arg = update;
+        rc = ariesAsyncSubmit(&update->requests[index], devices[index],
+            ariesAsyncFleetUpdateFn, NULL, NULL);
+        if (rc != ARIES_SUCCESS)
+        {
+            ASTERA_ERROR("Could not queue FW update of device %d. RC = %d",
+                index, rc);
+            pthread_mutex_lock(&ariesAsyncMutex);
+            results[index].rc = rc;
+            results[index].state = ARIES_FLEET_UPDATE_FAILED;
+            pthread_mutex_unlock(&ariesAsyncMutex);
+            update->requests[index].done = true;
+        }
+        else
+        {
+            update->numSubmitted++;
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the aggregate and per device progress of a fleet FW update
+ */
+AriesErrorType ariesFleetUpdateFirmwareProgress(
+        AriesFleetUpdateType* update,
+        AriesFleetUpdateProgressType* progress)
+{
+    AriesFleetUpdateResultType* result;
+    double busRemainingUs[ARIES_ASYNC_MAX_BUSES];
+    bool busPending[ARIES_ASYNC_MAX_BUSES];
+    AriesFleetUpdateStateType state;
+    double elapsedUs;
+    double nowUs;
+    double deviceUs;
+    double doneUs;
+    double sumPercent;
+    int numDoneUs;
+    int numEstimates;
+    int numPending;
+    int workerIndex;
+    int index;
+    uint8_t percent;
+
+    if ((update == NULL) || (progress == NULL) || (update->results == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(progress, 0, sizeof(AriesFleetUpdateProgressType));
+    progress->numDevices = update->numDevices;
+    nowUs = ariesAsyncTimeUs();
+    elapsedUs = nowUs - update->startUs;
+
+    // Per device progress. Devices which finished give the expected duration
+    // of a device update, else it is extrapolated from the running devices
+    sumPercent = 0;
+    doneUs = 0;
+    numDoneUs = 0;
+    pthread_mutex_lock(&ariesAsyncMutex);
+    for (index = 0; index < update->numDevices; index++)
+    {
+        result = &update->results[index];
+        if (result->state == ARIES_FLEET_UPDATE_RUNNING)
+        {
+            ariesFirmwareUpdateProgress(result->device, &percent);
+            result->percentComplete = (percent > 99) ? 99 : percent;
+            progress->numRunning++;
+        }
+        else if (result->state == ARIES_FLEET_UPDATE_QUEUED)
+        {
+            result->percentComplete = 0;
+            progress->numQueued++;
+        }
+        else
+        {
+            result->percentComplete = 100;
+            if (result->state == ARIES_FLEET_UPDATE_DONE)
+            {
+                progress->numDone++;
+                doneUs += result->durationUs;
+                numDoneUs++;
+            }
+            else
+            {
+                progress->numFailed++;
+            }
+        }
+        sumPercent += result->percentComplete;
+    }
+    numEstimates = numDoneUs;
+    if (numEstimates == 0)
+    {
+        for (index = 0; index < update->numDevices; index++)
+        {
+            result = &update->results[index];
+            if ((result->state == ARIES_FLEET_UPDATE_RUNNING) &&
+                (result->percentComplete > 0))
+            {
+                doneUs += (nowUs - result->startUs) * 100 /
+                    result->percentComplete;
+                numEstimates++;
+            }
+        }
+    }
+    if (numEstimates > 0)
+    {
+        doneUs /= numEstimates;
+    }
+
+    // Buses are worked in parallel, so the fleet is done when the bus with
+    // the most remaining work is done
+    for (workerIndex = 0; workerIndex < ARIES_ASYNC_MAX_BUSES; workerIndex++)
+    {
+        busRemainingUs[workerIndex] = 0;
+        busPending[workerIndex] = false;
+    }
+    numPending = 0;
+    for (index = 0; index < update->numDevices; index++)
+    {
+        result = &update->results[index];
+        state = result->state;
+        if ((state != ARIES_FLEET_UPDATE_QUEUED) &&
+            (state != ARIES_FLEET_UPDATE_RUNNING))
+        {
+            continue;
+        }
+        workerIndex = update->requests[index].workerIndex;
+        deviceUs = doneUs;
+        if (state == ARIES_FLEET_UPDATE_RUNNING)
+        {
+            // Progress is not linear in time (verify waits on the Main Micro
+            // checksum), so the duration of finished devices is preferred
+            deviceUs -= nowUs - result->startUs;
+            if ((numDoneUs == 0) && (result->percentComplete > 0))
+            {
+                deviceUs = (nowUs - result->startUs) *
+                    (100 - result->percentComplete) / result->percentComplete;
+            }
+            if (deviceUs < 0)
+            {
+                deviceUs = 0;
+            }
+        }
+        busRemainingUs[workerIndex] += deviceUs;
+        busPending[workerIndex] = true;
+        numPending++;
+    }
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    progress->percentComplete = sumPercent / update->numDevices;
+    progress->elapsedSec = elapsedUs / 1e6;
+    if (elapsedUs > 0)
+    {
+        progress->bytesPerSec = (sumPercent / 100) * update->imageBytes /
+            progress->elapsedSec;
+    }
+
+    progress->etaSec = 0;
+    if (numPending > 0)
+    {
+        if (numEstimates == 0)
+        {
+            progress->etaSec = -1;
+        }
+        else
+        {
+            for (workerIndex = 0; workerIndex < ARIES_ASYNC_MAX_BUSES;
+                workerIndex++)
+            {
+                if (busPending[workerIndex] &&
+                    (busRemainingUs[workerIndex] / 1e6 > progress->etaSec))
+                {
+                    progress->etaSec = busRemainingUs[workerIndex] / 1e6;
+                }
+            }
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Block until all devices of a fleet FW update are done and release the
+ * update
+ */
+AriesErrorType ariesFleetUpdateFirmwareWait(
+        AriesFleetUpdateType* update)
+{
+    AriesErrorType rc;
+    int index;
+
+    if ((update == NULL) || (update->requests == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Requests which could not be queued are already marked done
+    for (index = 0; index < update->numDevices; index++)
+    {
+        ariesAsyncWait(&update->requests[index]);
+    }
+
+    rc = ARIES_SUCCESS;
+    for (index = 0; index < update->numDevices; index++)
+    {
+        if (update->results[index].rc != ARIES_SUCCESS)
+        {
+            rc = update->results[index].rc;
+            break;
+        }
+    }
+
+    free(update->requests);
+    update->requests = NULL;
+    ariesFWImageClose(&update->image);
+
+    return rc;
+}
+
+
+/*
+ * Update the FW of a set of devices, one worker per I2C bus
+ */
+AriesErrorType ariesFleetUpdateFirmware(
+        AriesDeviceType** devices,
+        int numDevices,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        bool delta,
+        AriesFleetUpdateResultType* results)
+{
+    AriesFleetUpdateType update;
+    AriesErrorType rc;
+
+    rc = ariesFleetUpdateFirmwareStart(&update, devices, numDevices, filename,
+        fileType, delta, results);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    return ariesFleetUpdateFirmwareWait(&update);
+}
+
+
+/*
+ * Check if a submitted operation is done
+ */
+bool ariesAsyncPoll(
+        AriesAsyncRequestType* request)
+{
+    bool done;
+
+    pthread_mutex_lock(&ariesAsyncMutex);
+    done = request->done;
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    return done;
+}
+
+
+/*
+ * Block until a submitted operation is done
+ */
+AriesErrorType ariesAsyncWait(
+        AriesAsyncRequestType* request)
+{
+    pthread_mutex_lock(&ariesAsyncMutex);
+    while (!request->done)
+    {
+        pthread_cond_wait(&ariesAsyncDoneCond, &ariesAsyncMutex);
+    }
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    return request->rc;
+}
+
+
+/*
+ * Stop all bus workers once their queues are drained
+ */
+AriesErrorType ariesAsyncShutdown(void)
+{
+    int index;
+
+    // New submits are rejected from here on, so the queues only shrink
+    pthread_mutex_lock(&ariesAsyncMutex);
+    if (ariesAsyncStopping)
+    {
+        pthread_mutex_unlock(&ariesAsyncMutex);
+        ASTERA_ERROR("Async workers are already shutting down");
+        return ARIES_ASYNC_WORKER_FAILURE;
+    }
+    ariesAsyncStopping = true;
+    for (index = 0; index < ARIES_ASYNC_MAX_BUSES; index++)
+    {
+        if (ariesAsyncWorkers[index].inUse)
+        {
+            ariesAsyncWorkers[index].stop = true;
+            pthread_cond_signal(&ariesAsyncWorkers[index].workCond);
+        }
+    }
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    // A worker exits once its queue is empty, after marking every request
+    // done and waking its waiters
+    for (index = 0; index < ARIES_ASYNC_MAX_BUSES; index++)
+    {
+        if (ariesAsyncWorkers[index].inUse)
+        {
+            pthread_join(ariesAsyncWorkers[index].thread, NULL);
+        }
+    }
+
+    // Only the (joined) worker waited on its workCond
+    pthread_mutex_lock(&ariesAsyncMutex);
+    for (index = 0; index < ARIES_ASYNC_MAX_BUSES; index++)
+    {
+        if (ariesAsyncWorkers[index].inUse)
+        {
+            pthread_cond_destroy(&ariesAsyncWorkers[index].workCond);
+            ariesAsyncWorkers[index].inUse = false;
+        }
+    }
+    ariesAsyncStopping = false;
+    pthread_mutex_unlock(&ariesAsyncMutex);
+
+    return ARIES_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -94,6 +94,7 @@ AriesErrorType ariesWriteBlockData(
     uint8_t addr7To0;
     int pos;
     AriesErrorType rc;
+    uint64_t statsStartUs;
 
     int handle;
 
@@ -177,36 +178,19 @@ AriesErrorType ariesWriteBlockData(
             // Set PEC bits
             if (pecEn)
             {
-                // Include slave address and write bit, and cmd Code
-                // PEC byte accounted in writeNumBytes
-                uint8_t wrStreamLen = writeNumBytes + 2;
-                uint8_t wrStream[wrStreamLen];
-                uint8_t wrPec;
-
-                // Include slave address and write bit (0)
-                wrStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-                wrStream[1] = cmdCode;
-                ASTERA_TRACE("        pecBuf[0] = 0x%02x", wrStream[0]);
-                ASTERA_TRACE("        pecBuf[1] = 0x%02x", wrStream[1]);
-
-                uint8_t wrStreamIdx;
-                for (wrStreamIdx = 2; wrStreamIdx < (wrStreamLen-1); wrStreamIdx++)
-                {
-                    wrStream[wrStreamIdx] = writeBuf[(wrStreamIdx-2)];
-                    ASTERA_TRACE("        pecBuf[%d] = 0x%02x", wrStreamIdx,
-                        wrStream[wrStreamIdx]);
-                }
-                wrStream[(wrStreamLen-1)] = 0x0;
-                ASTERA_TRACE("        pecBuf[last] = 0x0");
-
-                // Calculate CRC8 byte from polynomial
-                wrPec = ariesGetPecByte(wrStream, wrStreamLen);
+                // Include slave address and write bit, cmd code and data
+                // (PEC byte position excluded)
+                uint8_t wrPec = ariesGetWritePecByte(i2cDriver->slaveAddr,
+                    cmdCode, writeBuf, (writeNumBytes-1));
                 writeBuf[(writeNumBytes-1)] = wrPec;
                 ASTERA_TRACE("    writeBuf[last] = 0x%02x", wrPec);
             }
 
+            statsStartUs = ariesI2CStatsStart(i2cDriver);
             rc = asteraI2CWriteBlockData(handle, cmdCode, writeNumBytes,
                 writeBuf);
+            ariesI2CStatsRecordTransaction(i2cDriver, false, writeNumBytes,
+                (rc != ARIES_SUCCESS), statsStartUs);
             CHECK_SUCCESS(rc);
 
             // Increment iteration count
@@ -281,36 +265,20 @@ AriesErrorType ariesWriteBlockData(
         // Set PEC bits
         if (pecEn)
         {
-            // Include slave address and write bit, and cmd Code
-            // PEC byte accounted in writeNumBytes
-            uint8_t wrStreamLen = wrBufLen + 2;
-            uint8_t wrStream[wrStreamLen];
-            uint8_t wrPec;
-
-            // Include slave address and write bit (0)
-            wrStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-            wrStream[1] = cmdCode;
-            ASTERA_TRACE("        pecBuf[0] = 0x%02x", wrStream[0]);
-            ASTERA_TRACE("        pecBuf[1] = 0x%02x", wrStream[1]);
-
-            uint8_t wrStreamIdx;
-            for (wrStreamIdx = 2; wrStreamIdx < (wrStreamLen-1); wrStreamIdx++)
-            {
-                wrStream[wrStreamIdx] = writeBuf[(wrStreamIdx-2)];
-                ASTERA_TRACE("        pecBuf[%d] = 0x%02x", wrStreamIdx,
-                    wrStream[wrStreamIdx]);
-            }
-            wrStream[(wrStreamLen-1)] = 0x0;
-
-            // Calculate CRC8 byte from polynomial
-            wrPec = ariesGetPecByte(wrStream, wrStreamLen);
+            // Include slave address and write bit, cmd code and data
+            // (PEC byte position excluded)
+            uint8_t wrPec = ariesGetWritePecByte(i2cDriver->slaveAddr,
+                cmdCode, writeBuf, (wrBufLen-1));
             writeBuf[(wrBufLen-1)] = wrPec;
             ASTERA_TRACE("    writeBuf[%d] = 0x%02x", (wrBufLen-1), writeBuf[(wrBufLen-1)]);
         }
 
         // This translates to actual low level library call
         // Function definition part of user application
+        statsStartUs = ariesI2CStatsStart(i2cDriver);
         rc = asteraI2CWriteBlockData(handle, cmdCode, wrBufLen, writeBuf);
+        ariesI2CStatsRecordTransaction(i2cDriver, false, wrBufLen,
+            (rc != ARIES_SUCCESS), statsStartUs);
         CHECK_SUCCESS(rc);
     }
 
@@ -356,6 +324,7 @@ AriesErrorType ariesReadBlockData(
 
     uint8_t tryIndex;
     uint8_t readTryCount = 3;
+    uint64_t statsStartUs;
 
     if (i2cDriver->i2cFormat == ARIES_I2C_FORMAT_INTEL)
     {
@@ -416,29 +385,10 @@ AriesErrorType ariesReadBlockData(
 
             if (pecEn)
             {
-                // Include slave addr and write bit (0) in wrStream
-                // Include cmd code in wrStream
-                // PEC bit is already accounted for
-                uint8_t wrStreamLen = 2 + writeBufLen;
-                uint8_t wrStream[wrStreamLen];
-
-                // Fill wrStream
-                wrStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-                wrStream[1] = wrCmdCode;
-                ASTERA_TRACE("        pecBuf[0] = 0x%02x", wrStream[0]);
-                ASTERA_TRACE("        pecBuf[1] = 0x%02x", wrStream[1]);
-                int byteIdx;
-                for (byteIdx = 2; byteIdx < (wrStreamLen-1); byteIdx++)
-                {
-                    wrStream[byteIdx] = writeBuf[(byteIdx-2)];
-                    ASTERA_TRACE("        pecBuf[%d] = 0x%02x", byteIdx,
-                        wrStream[byteIdx]);
-                }
-                // Append 0x0 as CRC Polynomial
-                wrStream[(wrStreamLen-1)] = 0x0;
-                ASTERA_TRACE("        pecBuf[last] = 0x0");
-
-                uint8_t wrPec = ariesGetPecByte(wrStream, wrStreamLen);
+                // Include slave address and write bit, cmd code and data
+                // (PEC byte position excluded)
+                uint8_t wrPec = ariesGetWritePecByte(i2cDriver->slaveAddr,
+                    wrCmdCode, writeBuf, (writeBufLen-1));
                 writeBuf[3] = wrPec;
                 ASTERA_TRACE("    writeBuf[3] = 0x%02x", writeBuf[3]);
             }
@@ -460,8 +410,16 @@ AriesErrorType ariesReadBlockData(
 
             for (tryIndex = 0; tryIndex < readTryCount; tryIndex++)
             {
+                if (tryIndex > 0)
+                {
+                    ariesI2CStatsRecordReadRetry(i2cDriver);
+                }
+
+                statsStartUs = ariesI2CStatsStart(i2cDriver);
                 rc = asteraI2CWriteBlockData(handle, wrCmdCode, writeBufLen,
                 writeBuf);
+                ariesI2CStatsRecordTransaction(i2cDriver, false, writeBufLen,
+                    (rc != ARIES_SUCCESS), statsStartUs);
                 if (rc != ARIES_SUCCESS)
                 {
                     lc = ariesUnlock(i2cDriver);
@@ -483,8 +441,11 @@ AriesErrorType ariesReadBlockData(
                 ASTERA_TRACE("Read:");
                 ASTERA_TRACE("    cmdCode = 0x%02x", rdCmdCode);
 
+                statsStartUs = ariesI2CStatsStart(i2cDriver);
                 rc = asteraI2CReadBlockData(handle, rdCmdCode, readBufLen,
                     readBuf);
+                ariesI2CStatsRecordTransaction(i2cDriver, true, readBufLen,
+                    (rc != readBufLen), statsStartUs);
 
                 if ((rc != readBufLen) || (readBuf[0] >= 5))
                 {
@@ -517,24 +478,10 @@ AriesErrorType ariesReadBlockData(
 
             if (pecEn)
             {
-                // In read PEC calculation, include write (2 bytes - addr,
-                // w bit and command) and read portions (addr, r bit, data
-                // returned) of smbus instruction
-                uint8_t readStreamLen = readBufLen + 2 + 1;
-                uint8_t readStream[readStreamLen];
-                uint8_t rdPec;
-
-                readStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-                readStream[1] = rdCmdCode;
-                readStream[2] = (i2cDriver->slaveAddr << 1) + 1;
-
-                uint8_t rdStreamId;
-                for (rdStreamId = 3; rdStreamId < readStreamLen; rdStreamId++)
-                {
-                    readStream[rdStreamId] = readBuf[rdStreamId-3];
-                }
-                rdPec = ariesGetPecByte(readStream, readStreamLen);
-                if (rdPec != 0)
+                // Include write portion of read (addr and wr bit, and cmd
+                // code) and read portion (addr and rd bit, data and PEC)
+                if (!ariesCheckReadPecByte(i2cDriver->slaveAddr, rdCmdCode,
+                    readBuf, readBufLen))
                 {
                     ASTERA_ERROR("PEC value not as expected");
                     return ARIES_I2C_BLOCK_READ_FAILURE;
@@ -554,6 +501,19 @@ AriesErrorType ariesReadBlockData(
     }
     else
     {
+#ifdef ARIES_I2C_BATCH
+        // Issue address write and data read in one low-level transfer
+        if (numBytes <= ARIES_I2C_SUBMIT_MAX_OP_BYTES)
+        {
+            AriesI2COpType op;
+            op.isRead = true;
+            op.address = address;
+            op.numBytes = numBytes;
+            op.values = values;
+            return ariesI2CSubmit(i2cDriver, &op, 1);
+        }
+#endif
+
         pecEn = 0;
         rsvd = 0;
         funcCode = 2;
@@ -603,25 +563,10 @@ AriesErrorType ariesReadBlockData(
 
         if (pecEn)
         {
-            // Add address and w bit, and cmd code to wrStream
-            // PEC byte is already accounted for
-            uint8_t wrStreamLen = wrBufLength + 2;
-            uint8_t wrStream[wrStreamLen];
-            wrStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-            wrStream[1] = wrCmdCode;
-            ASTERA_TRACE("        pecBuf[0] = 0x%02x", wrStream[0]);
-            ASTERA_TRACE("        pecBuf[1] = 0x%02x", wrStream[1]);
-
-            uint8_t wrStreamIdx;
-            for (wrStreamIdx = 2; wrStreamIdx < (wrStreamLen-1); wrStreamIdx++)
-            {
-                wrStream[wrStreamIdx] = writeBuf[(wrStreamIdx-2)];
-                ASTERA_TRACE("        pecBuf[%d] = 0x%02x", wrStreamIdx, wrStream[wrStreamIdx]);
-            }
-            wrStream[(wrStreamLen-1)] = 0x0;  // Addition PEC byte
-            ASTERA_TRACE("        pecBuf[last] = 0x0");
-
-            uint8_t wrPec = ariesGetPecByte(wrStream, wrStreamLen);
+            // Include slave address and write bit, cmd code and data
+            // (PEC byte position excluded)
+            uint8_t wrPec = ariesGetWritePecByte(i2cDriver->slaveAddr,
+                wrCmdCode, writeBuf, (wrBufLength-1));
             writeBuf[4] = wrPec;
             ASTERA_TRACE("    writeBuf[4] = 0x%02x", writeBuf[4]);
         }
@@ -640,9 +585,17 @@ AriesErrorType ariesReadBlockData(
         // Try the read operation upto 3 times before issuing a block read failure
         for (tryIndex = 0; tryIndex < readTryCount; tryIndex++)
         {
+            if (tryIndex > 0)
+            {
+                ariesI2CStatsRecordReadRetry(i2cDriver);
+            }
+
             // First write address you wish to read from
+            statsStartUs = ariesI2CStatsStart(i2cDriver);
             rc = asteraI2CWriteBlockData(handle, wrCmdCode, wrBufLength,
                 writeBuf);
+            ariesI2CStatsRecordTransaction(i2cDriver, false, wrBufLength,
+                (rc != ARIES_SUCCESS), statsStartUs);
             if (rc != ARIES_SUCCESS)
             {
                 lc = ariesUnlock(i2cDriver);
@@ -665,8 +618,11 @@ AriesErrorType ariesReadBlockData(
 
             // Perform read operation
             // First byte returned is length. Hence add length+1 as bytes to read
+            statsStartUs = ariesI2CStatsStart(i2cDriver);
             readBytes = asteraI2CReadBlockData(handle, rdCmdCode, readBufLen,
                 readBuf);
+            ariesI2CStatsRecordTransaction(i2cDriver, true, readBufLen,
+                (readBytes != readBufLen), statsStartUs);
                 /*printf("Read (Rd): ");*/
                 /*printf("0x%02x ", rdCmdCode);*/
                 /*for (i = 0; i < readBufLen; i++)*/
@@ -706,29 +662,14 @@ AriesErrorType ariesReadBlockData(
         // Verify PEC checksum
         if (pecEn)
         {
-            // Include write portion of read (addr and wr bit, and cmd Code)
-            // and extra read portion (addr and rd bit)
-            uint8_t rdStreamLen = readBufLen + 2 + 1;
-            uint8_t rdStream[rdStreamLen];
-            uint8_t rdPec;
-
-            rdStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-            rdStream[1] = rdCmdCode;
-            rdStream[2] = (i2cDriver->slaveAddr << 1) + 1;
-
-            uint8_t rdStreamIdx;
-            for (rdStreamIdx = 3; rdStreamIdx < rdStreamLen; rdStreamIdx++)
-            {
-                rdStream[rdStreamIdx] = readBuf[rdStreamIdx-3];
-            }
-
-            rdPec = ariesGetPecByte(rdStream, rdStreamLen);
-            if (rdPec != 0)
+            // Include write portion of read (addr and wr bit, and cmd
+            // code) and read portion (addr and rd bit, data and PEC)
+            if (!ariesCheckReadPecByte(i2cDriver->slaveAddr, rdCmdCode,
+                readBuf, readBufLen))
             {
                 ASTERA_ERROR("PEC value not as expected");
                 return ARIES_I2C_BLOCK_READ_FAILURE;
             }
-
         }
 
         // Print the values
@@ -755,6 +696,277 @@ AriesErrorType ariesReadByteData(
 }
 
 
+#ifdef ARIES_I2C_BATCH
+/*
+ * Build the Astera format transaction(s) for a register access. A write is
+ * a single block write. A read is a block write of the address followed by a
+ * block read of the data. Returns the number of transactions built
+ */
+static int ariesI2CBuildTransactions(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2COpType* op,
+        AriesI2CTransactionType* txns,
+        uint8_t (*bufs)[ARIES_I2C_SUBMIT_MAX_FRAME_LEN])
+{
+    uint8_t pecEn = 0;
+    uint8_t rsvd = 0;
+    uint8_t funcCode;
+    uint8_t start = 1;
+    uint8_t end;
+    uint8_t cfg_type;
+    uint8_t bdcst = 0;
+    uint8_t burstLen = (op->numBytes-1);
+    uint8_t addr17 = (op->address & 0x10000) >> 16;
+
+    if (i2cDriver->pecEnable == ARIES_I2C_PEC_ENABLE)
+    {
+        pecEn = 1;
+    }
+
+    if (op->isRead)
+    {
+        // Address write: no data bytes, does not end the transaction
+        funcCode = 2;
+        end = 0;
+        cfg_type = 0;
+        txns[0].bufLen = 4 + pecEn;
+    }
+    else
+    {
+        funcCode = 3;
+        end = 1;
+        cfg_type = 1;
+        txns[0].bufLen = op->numBytes + 4 + pecEn;
+    }
+
+    txns[0].isRead = false;
+    txns[0].cmdCode = (pecEn << 7) + (rsvd << 5) + (funcCode << 2) +
+        (start << 1) + (end << 0);
+    txns[0].buf = bufs[0];
+    txns[0].rc = 0;
+
+    bufs[0][0] = txns[0].bufLen - 1 - pecEn;
+    bufs[0][1] = (cfg_type << 6) + (bdcst << 4) + (burstLen << 1) +
+        (addr17 << 0);
+    bufs[0][2] = (op->address & 0xff00) >> 8;
+    bufs[0][3] = op->address & 0xff;
+    if (!op->isRead)
+    {
+        memcpy(&bufs[0][4], op->values, op->numBytes);
+    }
+    if (pecEn)
+    {
+        bufs[0][(txns[0].bufLen-1)] = ariesGetWritePecByte(
+            i2cDriver->slaveAddr, txns[0].cmdCode, bufs[0], (txns[0].bufLen-1));
+    }
+
+    if (!op->isRead)
+    {
+        return 1;
+    }
+
+    // Data read: first byte returned is length
+    funcCode = 2;
+    start = 0;
+    end = 1;
+    txns[1].isRead = true;
+    txns[1].cmdCode = (pecEn << 7) + (rsvd << 5) + (funcCode << 2) +
+        (start << 1) + (end << 0);
+    txns[1].bufLen = op->numBytes + pecEn + 1;
+    txns[1].buf = bufs[1];
+    txns[1].rc = 0;
+
+    return 2;
+}
+
+
+/*
+ * Issue up to ARIES_I2C_SUBMIT_MAX_OPS register accesses in one low-level
+ * transfer. A transfer made up of reads only is retried, like
+ * ariesReadBlockData(), if a read returned an unexpected number of bytes
+ */
+static AriesErrorType ariesI2CSubmitBatch(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2COpType* ops,
+        int numOps)
+{
+    AriesErrorType rc;
+    AriesErrorType lc;
+    AriesI2CTransactionType txns[(2 * ARIES_I2C_SUBMIT_MAX_OPS)];
+    uint8_t bufs[(2 * ARIES_I2C_SUBMIT_MAX_OPS)][ARIES_I2C_SUBMIT_MAX_FRAME_LEN];
+    int numTxns = 0;
+    int opIndex;
+    int txnIndex;
+    bool readOnly = true;
+    bool complete = false;
+    uint8_t tryIndex;
+    uint8_t readTryCount = 3;
+    uint64_t statsStartUs;
+
+    for (opIndex = 0; opIndex < numOps; opIndex++)
+    {
+        numTxns += ariesI2CBuildTransactions(i2cDriver, &ops[opIndex],
+            &txns[numTxns], &bufs[numTxns]);
+        if (!ops[opIndex].isRead)
+        {
+            readOnly = false;
+        }
+    }
+
+    rc = ariesLock(i2cDriver);
+    CHECK_SUCCESS(rc);
+
+    for (tryIndex = 0; tryIndex < readTryCount; tryIndex++)
+    {
+        if (tryIndex > 0)
+        {
+            ariesI2CStatsRecordReadRetry(i2cDriver);
+        }
+
+        statsStartUs = ariesI2CStatsStart(i2cDriver);
+        rc = asteraI2CTransfer(i2cDriver->handle, txns, numTxns);
+
+        complete = true;
+        for (txnIndex = 0; txnIndex < numTxns; txnIndex++)
+        {
+            int expected = txns[txnIndex].isRead ? txns[txnIndex].bufLen : 0;
+            if (txns[txnIndex].rc != expected)
+            {
+                complete = false;
+            }
+            ariesI2CStatsRecordTransaction(i2cDriver, txns[txnIndex].isRead,
+                txns[txnIndex].bufLen, (txns[txnIndex].rc != expected),
+                statsStartUs);
+        }
+
+        if (complete || !readOnly)
+        {
+            break;
+        }
+        ASTERA_TRACE("ariesI2CSubmit() interrupted by intervening transaction");
+        ASTERA_TRACE("Perform transfer again ... ");
+    }
+
+    lc = ariesUnlock(i2cDriver);
+    if (lc != 0)
+    {
+        ASTERA_ERROR("Aries lock not released!");
+        return lc;
+    }
+
+    if (!complete)
+    {
+        ASTERA_ERROR("I2C transfer failed (%d)", rc);
+        if (readOnly)
+        {
+            return ARIES_I2C_BLOCK_READ_FAILURE;
+        }
+        return ARIES_I2C_BLOCK_WRITE_FAILURE;
+    }
+
+    // Verify PEC checksum and fill up user given arrays
+    txnIndex = 0;
+    for (opIndex = 0; opIndex < numOps; opIndex++)
+    {
+        txnIndex++;
+        if (!ops[opIndex].isRead)
+        {
+            continue;
+        }
+        if ((i2cDriver->pecEnable == ARIES_I2C_PEC_ENABLE) &&
+            !ariesCheckReadPecByte(i2cDriver->slaveAddr,
+                txns[txnIndex].cmdCode, txns[txnIndex].buf,
+                txns[txnIndex].bufLen))
+        {
+            ASTERA_ERROR("PEC value not as expected");
+            return ARIES_I2C_BLOCK_READ_FAILURE;
+        }
+        memcpy(ops[opIndex].values, &txns[txnIndex].buf[1],
+            ops[opIndex].numBytes);
+        txnIndex++;
+    }
+
+    return ARIES_SUCCESS;
+}
+#endif
+
+
+/*
+ * Submit a list of register reads and writes to Aries over I2C
+ */
+AriesErrorType ariesI2CSubmit(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2COpType* ops,
+        int numOps)
+{
+    AriesErrorType rc;
+    AriesErrorType lc;
+    int opIndex;
+
+    for (opIndex = 0; opIndex < numOps; opIndex++)
+    {
+        if ((ops[opIndex].numBytes == 0) ||
+            (ops[opIndex].numBytes > ARIES_I2C_SUBMIT_MAX_OP_BYTES))
+        {
+            ASTERA_ERROR("Invalid num bytes (%d) in I2C op %d",
+                ops[opIndex].numBytes, opIndex);
+            return ARIES_INVALID_ARGUMENT;
+        }
+    }
+
+    // Keep the whole list atomic
+    rc = ariesLock(i2cDriver);
+    CHECK_SUCCESS(rc);
+
+    opIndex = 0;
+    while (opIndex < numOps)
+    {
+#ifdef ARIES_I2C_BATCH
+        if (i2cDriver->i2cFormat == ARIES_I2C_FORMAT_ASTERA)
+        {
+            int batchOps = numOps - opIndex;
+            if (batchOps > ARIES_I2C_SUBMIT_MAX_OPS)
+            {
+                batchOps = ARIES_I2C_SUBMIT_MAX_OPS;
+            }
+            rc = ariesI2CSubmitBatch(i2cDriver, &ops[opIndex], batchOps);
+            opIndex += batchOps;
+        }
+        else
+#endif
+        {
+            if (ops[opIndex].isRead)
+            {
+                rc = ariesReadBlockData(i2cDriver, ops[opIndex].address,
+                    ops[opIndex].numBytes, ops[opIndex].values);
+            }
+            else
+            {
+                rc = ariesWriteBlockData(i2cDriver, ops[opIndex].address,
+                    ops[opIndex].numBytes, ops[opIndex].values);
+            }
+            opIndex++;
+        }
+
+        if (rc != ARIES_SUCCESS)
+        {
+            lc = ariesUnlock(i2cDriver);
+            if (lc != 0)
+            {
+                ASTERA_ERROR("Aries lock not released!");
+                return lc;
+            }
+            return rc;
+        }
+    }
+
+    lc = ariesUnlock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    return ARIES_SUCCESS;
+}
+
+
 /*
  * Read multiple (up to eight) data bytes from micro SRAM over I2C
  */
@@ -769,7 +981,7 @@ AriesErrorType ariesReadBlockDataMainMicroIndirectA0(
     AriesErrorType lc;
     int byteIndex;
     uint8_t dataByte[1];
-    bool complete = true;
+    AriesI2COpType ops[3];
 
     // Grab lock
     lc = ariesLock(i2cDriver);
@@ -778,15 +990,39 @@ AriesErrorType ariesReadBlockDataMainMicroIndirectA0(
     // No multi-byte indirect support here. Hence read a byte at a time
     for (byteIndex = 0; byteIndex < numBytes; byteIndex++)
     {
-        // Write eeprom addr
-        uint8_t eepromAddrBytes[3];
+        // Write eeprom addr and eeprom cmd in one burst (the data byte in
+        // between is not used by a read)
+        uint8_t eepromAddrCmdBytes[5];
         int eepromAccAddr = address - AL_MAIN_SRAM_DMEM_OFFSET + byteIndex;
-        eepromAddrBytes[0] = (eepromAccAddr) & 0xff;
-        eepromAddrBytes[1] = (eepromAccAddr >> 8) & 0xff;
-        eepromAddrBytes[2] = (eepromAccAddr >> 16) & 0xff;
-        rc = ariesWriteBlockData(i2cDriver, microIndStructOffset, 3,
-            eepromAddrBytes);
-        // CHECK_SUCCESS(rc);
+        eepromAddrCmdBytes[0] = (eepromAccAddr) & 0xff;
+        eepromAddrCmdBytes[1] = (eepromAccAddr >> 8) & 0xff;
+        eepromAddrCmdBytes[2] = (eepromAccAddr >> 16) & 0xff;
+        eepromAddrCmdBytes[3] = 0;
+        eepromAddrCmdBytes[4] = AL_TG_RD_LOC_IND_SRAM;
+
+        // Read status right behind the command. When the accesses go out in
+        // one transfer, also read data speculatively. The data byte is only
+        // used if the status shows the access completed
+        uint8_t status;
+        uint8_t rdata[1];
+        uint8_t count = 1;
+        int numOps = 2;
+#ifdef ARIES_I2C_BATCH
+        numOps = 3;
+#endif
+        ops[0].isRead = false;
+        ops[0].address = microIndStructOffset;
+        ops[0].numBytes = 5;
+        ops[0].values = eepromAddrCmdBytes;
+        ops[1].isRead = true;
+        ops[1].address = microIndStructOffset + 4;
+        ops[1].numBytes = 1;
+        ops[1].values = rdata;
+        ops[2].isRead = true;
+        ops[2].address = microIndStructOffset + 3;
+        ops[2].numBytes = 1;
+        ops[2].values = dataByte;
+        rc = ariesI2CSubmit(i2cDriver, ops, numOps);
         if (rc != ARIES_SUCCESS)
         {
             lc = ariesUnlock(i2cDriver);
@@ -797,33 +1033,32 @@ AriesErrorType ariesReadBlockDataMainMicroIndirectA0(
             }
             return rc;
         }
+        status = rdata[0] & 0x1;
+        ariesI2CStatsRecordPoll(i2cDriver);
 
-        // Write eeprom cmd
-        uint8_t eepromCmdByte[1];
-        eepromCmdByte[0] = AL_TG_RD_LOC_IND_SRAM;
-        rc = ariesWriteByteData(i2cDriver, (microIndStructOffset+4),
-            eepromCmdByte);
-        // CHECK_SUCCESS(rc);
-        if (rc != ARIES_SUCCESS)
+        if ((status != 0) || (numOps < 3))
         {
-            lc = ariesUnlock(i2cDriver);
-            if (lc != 0)
+            // Test successfull access
+            while ((status != 0) && (count < 0xff))
             {
-                ASTERA_ERROR("Aries lock not released!");
-                return lc;
+                rc = ariesReadByteData(i2cDriver, (microIndStructOffset+4),
+                    rdata);
+                if (rc != ARIES_SUCCESS)
+                {
+                    lc = ariesUnlock(i2cDriver);
+                    if (lc != 0)
+                    {
+                        ASTERA_ERROR("Aries lock not released!");
+                        return lc;
+                    }
+                    return rc;
+                }
+                status = rdata[0] & 0x1;
+                count += 1;
+                ariesI2CStatsRecordPoll(i2cDriver);
             }
-            return rc;
-        }
 
-        // Test successfull access
-        uint8_t status = 1;
-        uint8_t rdata[1];
-        uint8_t count = 0;
-        while ((status != 0) && (count < 0xff))
-        {
-            rc = ariesReadByteData(i2cDriver, (microIndStructOffset+4), rdata);
-            // CHECK_SUCCESS(rc);
-            if (rc != ARIES_SUCCESS)
+            if (status != 0)
             {
                 lc = ariesUnlock(i2cDriver);
                 if (lc != 0)
@@ -831,27 +1066,11 @@ AriesErrorType ariesReadBlockDataMainMicroIndirectA0(
                     ASTERA_ERROR("Aries lock not released!");
                     return lc;
                 }
-                return rc;
+                return(ARIES_FAILURE_SRAM_IND_ACCESS_TIMEOUT);
             }
-            status = rdata[0] & 0x1;
-            count += 1;
-        }
 
-        if (status != 0)
-        {
-            lc = ariesUnlock(i2cDriver);
-            if (lc != 0)
-            {
-                ASTERA_ERROR("Aries lock not released!");
-                return lc;
-            }
-            return(ARIES_FAILURE_SRAM_IND_ACCESS_TIMEOUT);
-        }
-        else
-        {
             rc = ariesReadByteData(i2cDriver, (microIndStructOffset+3),
                 dataByte);
-            // CHECK_SUCCESS(rc);
             if (rc != ARIES_SUCCESS)
             {
                 lc = ariesUnlock(i2cDriver);
@@ -862,8 +1081,8 @@ AriesErrorType ariesReadBlockDataMainMicroIndirectA0(
                 }
                 return rc;
             }
-            values[(byteIndex)] = dataByte[0];
         }
+        values[(byteIndex)] = dataByte[0];
     }
 
     lc = ariesUnlock(i2cDriver);
@@ -982,6 +1201,7 @@ AriesErrorType ariesReadBlockDataMainMicroIndirectMPW(
                 }
                 status = rdata[0] & 0x1;
                 count += 1;
+                ariesI2CStatsRecordPoll(i2cDriver);
             }
             if ((status == 0) || (count == 0xff))
             {
@@ -1119,6 +1339,7 @@ AriesErrorType ariesWriteBlockDataMainMicroIndirectA0(
             }
             status = rdata[0] & 0x1;
             count += 1;
+            ariesI2CStatsRecordPoll(i2cDriver);
         }
 
         if (status != 0)
@@ -1267,6 +1488,7 @@ AriesErrorType ariesWriteBlockDataMainMicroIndirectMPW(
                 }
                 status = rdata[0] & 0x1;
                 count += 1;
+                ariesI2CStatsRecordPoll(i2cDriver);
             }
             if ((status == 0) || (count == 0xff))
             {
@@ -1330,37 +1552,214 @@ AriesErrorType ariesReadBlockDataMainMicroIndirect(
 }
 
 
+#if defined(ARIES_I2C_BATCH) && !defined(ARIES_MPW)
 /*
- * Write a data byte to Main micro SRAM over I2C
+ * Read up to ARIES_MM_IND_PIPELINE_BYTES bytes from Main micro SRAM, with
+ * the byte accesses pipelined in one transfer. The Main Micro moves one byte
+ * per indirect access, so each access is followed by its status and data
+ * reads before the next access is issued. Bytes whose status shows the
+ * mailbox still busy are read again one at a time, and pipelined is
+ * cleared. The caller holds the driver lock
  */
-AriesErrorType ariesWriteByteDataMainMicroIndirect(
+static AriesErrorType ariesReadBlockDataMainMicroIndirectA0Pipelined(
         AriesI2CDriverType* i2cDriver,
+        uint32_t microIndStructOffset,
         uint32_t address,
-        uint8_t* value)
+        int numBytes,
+        uint8_t* values,
+        bool* pipelined)
 {
     AriesErrorType rc;
-#ifdef ARIES_MPW
-    rc = ariesWriteBlockDataMainMicroIndirectMPW(i2cDriver, 0xe00, address, 1,
-        value);
-#else
-    rc = ariesWriteBlockDataMainMicroIndirectA0(i2cDriver, 0xd99, address, 1,
-        value);
-#endif
-    return rc;
-}
+    AriesI2COpType ops[3*ARIES_MM_IND_PIPELINE_BYTES];
+    uint8_t eepromAddrCmdBytes[ARIES_MM_IND_PIPELINE_BYTES][5];
+    uint8_t status[ARIES_MM_IND_PIPELINE_BYTES];
+    uint8_t rdata[1];
+    uint8_t count;
+    int eepromAccAddr;
+    int byteIndex;
 
+    for (byteIndex = 0; byteIndex < numBytes; byteIndex++)
+    {
+        eepromAccAddr = address - AL_MAIN_SRAM_DMEM_OFFSET + byteIndex;
+        eepromAddrCmdBytes[byteIndex][0] = (eepromAccAddr) & 0xff;
+        eepromAddrCmdBytes[byteIndex][1] = (eepromAccAddr >> 8) & 0xff;
+        eepromAddrCmdBytes[byteIndex][2] = (eepromAccAddr >> 16) & 0xff;
+        eepromAddrCmdBytes[byteIndex][3] = 0;
+        eepromAddrCmdBytes[byteIndex][4] = AL_TG_RD_LOC_IND_SRAM;
+
+        ops[3*byteIndex].isRead = false;
+        ops[3*byteIndex].address = microIndStructOffset;
+        ops[3*byteIndex].numBytes = 5;
+        ops[3*byteIndex].values = eepromAddrCmdBytes[byteIndex];
+        ops[(3*byteIndex)+1].isRead = true;
+        ops[(3*byteIndex)+1].address = microIndStructOffset + 4;
+        ops[(3*byteIndex)+1].numBytes = 1;
+        ops[(3*byteIndex)+1].values = &status[byteIndex];
+        ops[(3*byteIndex)+2].isRead = true;
+        ops[(3*byteIndex)+2].address = microIndStructOffset + 3;
+        ops[(3*byteIndex)+2].numBytes = 1;
+        ops[(3*byteIndex)+2].values = &values[byteIndex];
+    }
+
+    rc = ariesI2CSubmit(i2cDriver, ops, (3*numBytes));
+    CHECK_SUCCESS(rc);
 
-/*
- * Write multiple (up to eight) data bytes to Main micro SRAM over I2C
- */
-AriesErrorType ariesWriteBlockDataMainMicroIndirect(
-        AriesI2CDriverType* i2cDriver,
-        uint32_t address,
-        uint8_t numBytes,
-        uint8_t* values)
-{
-    AriesErrorType rc;
-#ifdef ARIES_MPW
+    for (byteIndex = 0; byteIndex < numBytes; byteIndex++)
+    {
+        ariesI2CStatsRecordPoll(i2cDriver);
+        if ((status[byteIndex] & 0x1) != 0)
+        {
+            break;
+        }
+    }
+    if (byteIndex == numBytes)
+    {
+        return ARIES_SUCCESS;
+    }
+
+    // An access was still busy when its data was read, and later accesses
+    // were issued behind it. Wait for the mailbox to go idle and read the
+    // remaining bytes again (reads have no side effects)
+    *pipelined = false;
+    rdata[0] = status[byteIndex];
+    count = 0;
+    while (((rdata[0] & 0x1) != 0) && (count < 0xff))
+    {
+        rc = ariesReadByteData(i2cDriver, (microIndStructOffset+4), rdata);
+        CHECK_SUCCESS(rc);
+        count += 1;
+        ariesI2CStatsRecordPoll(i2cDriver);
+    }
+    if ((rdata[0] & 0x1) != 0)
+    {
+        return ARIES_FAILURE_SRAM_IND_ACCESS_TIMEOUT;
+    }
+
+    rc = ariesReadBlockDataMainMicroIndirectA0(i2cDriver, microIndStructOffset,
+        (address + byteIndex), (numBytes - byteIndex), &values[byteIndex]);
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+#endif
+
+
+/*
+ * Read an arbitrary length region of Main micro SRAM over I2C
+ */
+AriesErrorType ariesReadBlockDataMainMicroIndirectBulk(
+        AriesI2CDriverType* i2cDriver,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values)
+{
+    AriesErrorType rc;
+    AriesErrorType lc;
+    int offset;
+    int chunkBytes;
+#if defined(ARIES_I2C_BATCH) && !defined(ARIES_MPW)
+    bool pipelined = true;
+#endif
+
+    if (numBytes < 0)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Keep the whole region consistent with respect to other SDK users
+    lc = ariesLock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    for (offset = 0; offset < numBytes; offset += chunkBytes)
+    {
+        chunkBytes = numBytes - offset;
+#ifdef ARIES_MPW
+        if (chunkBytes > 8)
+        {
+            chunkBytes = 8;
+        }
+        rc = ariesReadBlockDataMainMicroIndirectMPW(i2cDriver, 0xe00,
+            (address + offset), chunkBytes, &values[offset]);
+#elif defined(ARIES_I2C_BATCH)
+        // Pipeline the byte accesses until the mailbox is seen busy, then
+        // fall back to one access at a time
+        if (pipelined)
+        {
+            if (chunkBytes > ARIES_MM_IND_PIPELINE_BYTES)
+            {
+                chunkBytes = ARIES_MM_IND_PIPELINE_BYTES;
+            }
+            rc = ariesReadBlockDataMainMicroIndirectA0Pipelined(i2cDriver,
+                0xd99, (address + offset), chunkBytes, &values[offset],
+                &pipelined);
+        }
+        else
+        {
+            if (chunkBytes > 0xff)
+            {
+                chunkBytes = 0xff;
+            }
+            rc = ariesReadBlockDataMainMicroIndirectA0(i2cDriver, 0xd99,
+                (address + offset), chunkBytes, &values[offset]);
+        }
+#else
+        if (chunkBytes > 0xff)
+        {
+            chunkBytes = 0xff;
+        }
+        rc = ariesReadBlockDataMainMicroIndirectA0(i2cDriver, 0xd99,
+            (address + offset), chunkBytes, &values[offset]);
+#endif
+        if (rc != ARIES_SUCCESS)
+        {
+            lc = ariesUnlock(i2cDriver);
+            if (lc != 0)
+            {
+                ASTERA_ERROR("Aries lock not released!");
+                return lc;
+            }
+            return rc;
+        }
+    }
+
+    lc = ariesUnlock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Write a data byte to Main micro SRAM over I2C
+ */
+AriesErrorType ariesWriteByteDataMainMicroIndirect(
+        AriesI2CDriverType* i2cDriver,
+        uint32_t address,
+        uint8_t* value)
+{
+    AriesErrorType rc;
+#ifdef ARIES_MPW
+    rc = ariesWriteBlockDataMainMicroIndirectMPW(i2cDriver, 0xe00, address, 1,
+        value);
+#else
+    rc = ariesWriteBlockDataMainMicroIndirectA0(i2cDriver, 0xd99, address, 1,
+        value);
+#endif
+    return rc;
+}
+
+
+/*
+ * Write multiple (up to eight) data bytes to Main micro SRAM over I2C
+ */
+AriesErrorType ariesWriteBlockDataMainMicroIndirect(
+        AriesI2CDriverType* i2cDriver,
+        uint32_t address,
+        uint8_t numBytes,
+        uint8_t* values)
+{
+    AriesErrorType rc;
+#ifdef ARIES_MPW
     rc = ariesWriteBlockDataMainMicroIndirectMPW(i2cDriver, 0xe00, address,
         numBytes, values);
 #else
@@ -1411,6 +1810,133 @@ AriesErrorType ariesReadByteDataPathMicroIndirect(
 }
 
 
+/*
+ * Read up to four bytes from Path micro SRAM with one indirect access. The
+ * caller holds the driver lock
+ */
+static AriesErrorType ariesReadPathMicroIndirectChunk(
+        AriesI2CDriverType* i2cDriver,
+        uint32_t microIndStructOffset,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values)
+{
+    AriesErrorType rc;
+    AriesI2COpType ops[3];
+    uint8_t cmdBytes[3];
+    uint8_t rdata[1];
+    uint8_t status;
+    uint8_t count = 1;
+    int numOps = 2;
+
+    // Write command and address in one burst. The address lower byte goes
+    // last and triggers the access
+    cmdBytes[0] = ((numBytes-1) << 5) | (((address>>16) & 0x1) << 1);
+    cmdBytes[1] = (address>>8) & 0xff;
+    cmdBytes[2] = address & 0xff;
+
+    // Read status right behind the command. When the accesses go out in one
+    // transfer, also read the data speculatively. It is only used if the
+    // status shows the access completed
+#ifdef ARIES_I2C_BATCH
+    numOps = 3;
+#endif
+    ops[0].isRead = false;
+    ops[0].address = microIndStructOffset;
+    ops[0].numBytes = 3;
+    ops[0].values = cmdBytes;
+    ops[1].isRead = true;
+    ops[1].address = microIndStructOffset + 0xb;
+    ops[1].numBytes = 1;
+    ops[1].values = rdata;
+    ops[2].isRead = true;
+    ops[2].address = microIndStructOffset + 3;
+    ops[2].numBytes = numBytes;
+    ops[2].values = values;
+    rc = ariesI2CSubmit(i2cDriver, ops, numOps);
+    CHECK_SUCCESS(rc);
+    status = rdata[0] & 0x1;
+    ariesI2CStatsRecordPoll(i2cDriver);
+
+    if ((status == 0) || (numOps < 3))
+    {
+        while ((status == 0) && (count < 0xff))
+        {
+            rc = ariesReadByteData(i2cDriver, (microIndStructOffset+0xb),
+                rdata);
+            CHECK_SUCCESS(rc);
+            status = rdata[0] & 0x1;
+            count += 1;
+            ariesI2CStatsRecordPoll(i2cDriver);
+        }
+        if (status == 0)
+        {
+            return ARIES_FAILURE_SRAM_IND_ACCESS_TIMEOUT;
+        }
+
+        rc = ariesReadBlockData(i2cDriver, (microIndStructOffset+3),
+            numBytes, values);
+        CHECK_SUCCESS(rc);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Read an arbitrary length region of Path micro SRAM over I2C
+ */
+AriesErrorType ariesReadBlockDataPathMicroIndirectBulk(
+        AriesI2CDriverType* i2cDriver,
+        uint8_t pathID,
+        uint32_t address,
+        int numBytes,
+        uint8_t* values)
+{
+    AriesErrorType rc;
+    AriesErrorType lc;
+    uint32_t microIndStructOffset;
+    int offset;
+    int chunkBytes;
+
+    if ((pathID > 15) || (numBytes < 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+    microIndStructOffset = 0x4200 + (pathID*ARIES_PATH_WRP_STRIDE);
+
+    // Keep the whole region consistent with respect to other SDK users
+    lc = ariesLock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    for (offset = 0; offset < numBytes; offset += chunkBytes)
+    {
+        chunkBytes = numBytes - offset;
+        if (chunkBytes > ARIES_PM_IND_ACCESS_MAX_BYTES)
+        {
+            chunkBytes = ARIES_PM_IND_ACCESS_MAX_BYTES;
+        }
+        rc = ariesReadPathMicroIndirectChunk(i2cDriver, microIndStructOffset,
+            (address + offset), chunkBytes, &values[offset]);
+        if (rc != ARIES_SUCCESS)
+        {
+            lc = ariesUnlock(i2cDriver);
+            if (lc != 0)
+            {
+                ASTERA_ERROR("Aries lock not released!");
+                return lc;
+            }
+            return rc;
+        }
+    }
+
+    lc = ariesUnlock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    return ARIES_SUCCESS;
+}
+
+
 /*
  * Write multiple (up to eight) data bytes to Path micro over I2C
  */
@@ -1782,144 +2308,145 @@ AriesErrorType ariesReadWordPmaMainMicroIndirect(
         int quadSlice,
         uint16_t pmaAddr,
         uint8_t* data)
+{
+    AriesErrorType rc;
+    AriesPmaReadType read;
+
+    read.side = side;
+    read.quadSlice = quadSlice;
+    read.pmaAddr = pmaAddr;
+    rc = ariesReadWordsPmaMainMicroIndirect(i2cDriver, &read, 1);
+    CHECK_SUCCESS(rc);
+
+    data[0] = read.data[0];
+    data[1] = read.data[1];
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Read a list of PMA regs via Main Micro
+ */
+AriesErrorType ariesReadWordsPmaMainMicroIndirect(
+        AriesI2CDriverType* i2cDriver,
+        AriesPmaReadType* reads,
+        int numReads)
+{
+    AriesErrorType rc;
+    AriesErrorType lc;
+    AriesI2COpType ops[3];
+    int readIndex;
+
+    lc = ariesLock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    for (readIndex = 0; readIndex < numReads; readIndex++)
+    {
+        // Write address (3 bytes) and command in one burst (data0 sits in
+        // between and is not used by a read)
+        uint8_t addrCmd[5];
+        uint32_t address = ((uint32_t) (reads[readIndex].quadSlice*4) << 20) |
+            (uint32_t) reads[readIndex].pmaAddr;
+        addrCmd[0] = address & 0xff;
+        addrCmd[1] = (address >> 8) & 0xff;
+        addrCmd[2] = (address >> 16) & 0xff;
+        addrCmd[3] = 0;
+        if (reads[readIndex].side == 0)
+        {
+            addrCmd[4] = ARIES_RD_PID_IND_PMA0;
+        }
+        else
+        {
+            addrCmd[4] = ARIES_RD_PID_IND_PMA1;
+        }
+
+        // Read command status and data1, then data0, right behind the
+        // command. Data is only used if status shows the access completed,
+        // so both data bytes are read after the status byte
+        uint8_t statusData1[2];
+        uint8_t data0[1];
+        ops[0].isRead = false;
+        ops[0].address = ARIES_PMA_MM_ASSIST_REG_ADDR_OFFSET;
+        ops[0].numBytes = 5;
+        ops[0].values = addrCmd;
+        ops[1].isRead = true;
+        ops[1].address = ARIES_PMA_MM_ASSIST_CMD_OFFSET;
+        ops[1].numBytes = 2;
+        ops[1].values = statusData1;
+        ops[2].isRead = true;
+        ops[2].address = ARIES_PMA_MM_ASSIST_DATA0_OFFSET;
+        ops[2].numBytes = 1;
+        ops[2].values = data0;
+        rc = ariesI2CSubmit(i2cDriver, ops, 3);
+        if (rc != ARIES_SUCCESS)
+        {
+            lc = ariesUnlock(i2cDriver);
+            if (lc != 0)
+            {
+                ASTERA_ERROR("Aries lock not released!");
+                return lc;
+            }
+            return rc;
+        }
+        ariesI2CStatsRecordPoll(i2cDriver);
+
+        // Check access status
+        int count = 1;
+        while ((statusData1[0] != 0) && (count < 100))
+        {
+            usleep(ARIES_MM_STATUS_TIME);
+            rc = ariesI2CSubmit(i2cDriver, &ops[1], 2);
+            if (rc != ARIES_SUCCESS)
+            {
+                lc = ariesUnlock(i2cDriver);
+                if (lc != 0)
+                {
+                    ASTERA_ERROR("Aries lock not released!");
+                    return lc;
+                }
+                return rc;
+            }
+            count += 1;
+            ariesI2CStatsRecordPoll(i2cDriver);
+        }
+
+        if (statusData1[0] != 0)
+        {
+            lc = ariesUnlock(i2cDriver);
+            if (lc != 0)
+            {
+                ASTERA_ERROR("Aries lock not released!");
+                return lc;
+            }
+            return ARIES_PMA_MM_ACCESS_FAILURE;
+        }
+
+        reads[readIndex].data[0] = data0[0];
+        reads[readIndex].data[1] = statusData1[1];
+    }
+
+    lc = ariesUnlock(i2cDriver);
+    CHECK_SUCCESS(lc);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Write data to PMA reg via Main Micro
+ */
+AriesErrorType ariesWriteWordPmaMainMicroIndirect(
+        AriesI2CDriverType* i2cDriver,
+        int side,
+        int quadSlice,
+        uint16_t pmaAddr,
+        uint8_t* data)
 {
     AriesErrorType rc;
     AriesErrorType lc;
-
-    lc = ariesLock(i2cDriver);
-    CHECK_SUCCESS(lc);
-
-    // Write address (3 bytes)
-    uint8_t addr[3];
-    uint32_t address = ((uint32_t) (quadSlice*4) << 20) | (uint32_t) pmaAddr;
-    addr[0] = address & 0xff;
-    addr[1] = (address >> 8) & 0xff;
-    addr[2] = (address >> 16) & 0xff;
-    rc = ariesWriteBlockData(i2cDriver, ARIES_PMA_MM_ASSIST_REG_ADDR_OFFSET, 3,
-            addr);
-    // CHECK_SUCCESS(rc);
-    if (rc != ARIES_SUCCESS)
-    {
-        lc = ariesUnlock(i2cDriver);
-        if (lc != 0)
-        {
-            ASTERA_ERROR("Aries lock not released!");
-            return lc;
-        }
-        return rc;
-    }
-
-    // Set command
-    uint8_t dataByte[1];
-    if (side == 0)
-    {
-        dataByte[0] = ARIES_RD_PID_IND_PMA0;
-    }
-    else
-    {
-        dataByte[0] = ARIES_RD_PID_IND_PMA1;
-    }
-
-    rc = ariesWriteBlockData(i2cDriver, ARIES_PMA_MM_ASSIST_CMD_OFFSET, 1,
-        dataByte);
-    // CHECK_SUCCESS(rc);
-    if (rc != ARIES_SUCCESS)
-    {
-        lc = ariesUnlock(i2cDriver);
-        if (lc != 0)
-        {
-            ASTERA_ERROR("Aries lock not released!");
-            return lc;
-        }
-        return rc;
-    }
-
-    // Check access status
-    int count = 0;
-    int status = 1;
-    while ((status != 0) && (count < 100))
-    {
-        rc = ariesReadBlockData(i2cDriver, ARIES_PMA_MM_ASSIST_CMD_OFFSET, 1,
-            dataByte);
-        // CHECK_SUCCESS(rc);
-        if (rc != ARIES_SUCCESS)
-        {
-            lc = ariesUnlock(i2cDriver);
-            if (lc != 0)
-            {
-                ASTERA_ERROR("Aries lock not released!");
-                return lc;
-            }
-            return rc;
-        }
-        status = dataByte[0];
-
-        usleep(ARIES_MM_STATUS_TIME);
-        count += 1;
-    }
-
-    if (status != 0)
-    {
-        lc = ariesUnlock(i2cDriver);
-        if (lc != 0)
-        {
-            ASTERA_ERROR("Aries lock not released!");
-            return lc;
-        }
-        return ARIES_PMA_MM_ACCESS_FAILURE;
-    }
-
-    // Read 2 bytes of data
-    rc = ariesReadBlockData(i2cDriver, ARIES_PMA_MM_ASSIST_DATA0_OFFSET, 1,
-        dataByte);
-    // CHECK_SUCCESS(rc);
-    if (rc != ARIES_SUCCESS)
-    {
-        lc = ariesUnlock(i2cDriver);
-        if (lc != 0)
-        {
-            ASTERA_ERROR("Aries lock not released!");
-            return lc;
-        }
-        return rc;
-    }
-    data[0] = dataByte[0];
-    rc = ariesReadBlockData(i2cDriver, ARIES_PMA_MM_ASSIST_DATA1_OFFSET, 1,
-        dataByte);
-    // CHECK_SUCCESS(rc);
-    if (rc != ARIES_SUCCESS)
-    {
-        lc = ariesUnlock(i2cDriver);
-        if (lc != 0)
-        {
-            ASTERA_ERROR("Aries lock not released!");
-            return lc;
-        }
-        return rc;
-    }
-    data[1] = dataByte[0];
-
-    lc = ariesUnlock(i2cDriver);
-    CHECK_SUCCESS(lc);
-
-    return ARIES_SUCCESS;
-}
-
-
-/*
- * Write data to PMA reg via Main Micro
- */
-AriesErrorType ariesWriteWordPmaMainMicroIndirect(
-        AriesI2CDriverType* i2cDriver,
-        int side,
-        int quadSlice,
-        uint16_t pmaAddr,
-        uint8_t* data)
-{
-    AriesErrorType rc;
-    AriesErrorType lc;
-
-    uint8_t dataByte[1];
+
+    uint8_t dataByte[1];
 
     lc = ariesLock(i2cDriver);
     CHECK_SUCCESS(lc);
@@ -2014,6 +2541,7 @@ AriesErrorType ariesWriteWordPmaMainMicroIndirect(
 
         usleep(ARIES_MM_STATUS_TIME);
         count += 1;
+        ariesI2CStatsRecordPoll(i2cDriver);
     }
 
     if (status != 0)
@@ -2208,6 +2736,59 @@ AriesErrorType ariesWriteRetimerRegister(
     return ARIES_SUCCESS;
 }
 
+// Defined with the I2C transaction stats below
+static uint64_t ariesI2CStatsTimeUs(void);
+
+// Serializes lock initialization of drivers first used by several threads
+static pthread_mutex_t ariesLockInitMutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+/*
+ * Initialize I2C driver lock (no-op if already initialized)
+ */
+AriesErrorType ariesLockInit(
+        AriesI2CDriverType* i2cDriver)
+{
+    pthread_mutexattr_t attr;
+    int rc;
+
+    pthread_mutex_lock(&ariesLockInitMutex);
+    if (i2cDriver->lockInit)
+    {
+        pthread_mutex_unlock(&ariesLockInitMutex);
+        return ARIES_SUCCESS;
+    }
+
+    // Recursive, since SDK functions holding the lock call each other
+    rc = pthread_mutexattr_init(&attr);
+    if (rc == 0)
+    {
+        rc = pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+        if (rc == 0)
+        {
+            rc = pthread_mutex_init(&i2cDriver->lockMutex, &attr);
+        }
+        pthread_mutexattr_destroy(&attr);
+    }
+    if (rc != 0)
+    {
+        pthread_mutex_unlock(&ariesLockInitMutex);
+        ASTERA_ERROR("Could not initialize I2C driver lock (%d)", rc);
+        return ARIES_I2C_LOCK_INIT_FAILURE;
+    }
+
+    i2cDriver->lock = 0;
+    i2cDriver->lockStartUs = 0;
+    memset(&i2cDriver->lockStats, 0, sizeof(AriesI2CLockStatsType));
+    // Publish only after the mutex is ready, for the unlocked check in
+    // ariesLock()
+    __atomic_store_n(&i2cDriver->lockInit, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&ariesLockInitMutex);
+
+    return ARIES_SUCCESS;
+}
+
+
 /*
  * Lock I2C driver
  */
@@ -2215,18 +2796,52 @@ AriesErrorType ariesLock(
         AriesI2CDriverType* i2cDriver)
 {
     AriesErrorType rc;
-    rc = 0;
+    uint64_t startUs;
+    uint64_t waitUs;
+    bool contended = false;
+
+    if (!__atomic_load_n(&i2cDriver->lockInit, __ATOMIC_ACQUIRE))
+    {
+        rc = ariesLockInit(i2cDriver);
+        CHECK_SUCCESS(rc);
+    }
+
+    startUs = ariesI2CStatsTimeUs();
+    if (pthread_mutex_trylock(&i2cDriver->lockMutex) != 0)
+    {
+        contended = true;
+        pthread_mutex_lock(&i2cDriver->lockMutex);
+    }
+
+    // Mutex is held by this thread from here on
     if (i2cDriver->lock >= 1)
     {
         i2cDriver->lock++;
+        return ARIES_SUCCESS;
     }
-    else
+
+    rc = asteraI2CBlock(i2cDriver->handle);
+    if (rc != 0)
     {
-        rc = asteraI2CBlock(i2cDriver->handle);
-        i2cDriver->lock = 1;
+        pthread_mutex_unlock(&i2cDriver->lockMutex);
+        return rc;
     }
+    i2cDriver->lock = 1;
 
-    return rc;
+    i2cDriver->lockStartUs = ariesI2CStatsTimeUs();
+    waitUs = i2cDriver->lockStartUs - startUs;
+    i2cDriver->lockStats.acquisitions++;
+    if (contended)
+    {
+        i2cDriver->lockStats.contendedAcquisitions++;
+    }
+    i2cDriver->lockStats.totalWaitUs += waitUs;
+    if (waitUs > i2cDriver->lockStats.maxWaitUs)
+    {
+        i2cDriver->lockStats.maxWaitUs = waitUs;
+    }
+
+    return ARIES_SUCCESS;
 }
 
 
@@ -2237,6 +2852,7 @@ AriesErrorType ariesUnlock(
         AriesI2CDriverType* i2cDriver)
 {
     AriesErrorType rc;
+    uint64_t holdUs;
     rc = 0;
     if (i2cDriver->lock > 1)
     {
@@ -2246,12 +2862,472 @@ AriesErrorType ariesUnlock(
     {
         rc = asteraI2CUnblock(i2cDriver->handle);
         i2cDriver->lock = 0;
+
+        holdUs = ariesI2CStatsTimeUs() - i2cDriver->lockStartUs;
+        i2cDriver->lockStats.totalHoldUs += holdUs;
+        if (holdUs > i2cDriver->lockStats.maxHoldUs)
+        {
+            i2cDriver->lockStats.maxHoldUs = holdUs;
+        }
     }
+    pthread_mutex_unlock(&i2cDriver->lockMutex);
 
     return rc;
 }
 
 
+/*
+ * Get bus lock contention statistics
+ */
+AriesErrorType ariesLockStatsGet(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CLockStatsType* stats)
+{
+    if (!__atomic_load_n(&i2cDriver->lockInit, __ATOMIC_ACQUIRE))
+    {
+        memset(stats, 0, sizeof(AriesI2CLockStatsType));
+        return ARIES_SUCCESS;
+    }
+
+    pthread_mutex_lock(&i2cDriver->lockMutex);
+    *stats = i2cDriver->lockStats;
+    pthread_mutex_unlock(&i2cDriver->lockMutex);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Clear bus lock contention statistics
+ */
+AriesErrorType ariesLockStatsClear(
+        AriesI2CDriverType* i2cDriver)
+{
+    if (!__atomic_load_n(&i2cDriver->lockInit, __ATOMIC_ACQUIRE))
+    {
+        return ARIES_SUCCESS;
+    }
+
+    pthread_mutex_lock(&i2cDriver->lockMutex);
+    memset(&i2cDriver->lockStats, 0, sizeof(AriesI2CLockStatsType));
+    pthread_mutex_unlock(&i2cDriver->lockMutex);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * I2C transaction stats. One entry per I2C driver with stats enabled.
+ */
+typedef struct AriesI2CStatsEntry {
+    AriesI2CDriverType* i2cDriver;
+    AriesI2CStatsType stats;
+} AriesI2CStatsEntryType;
+
+/*
+ * Tracked API running in the current thread on an I2C driver. Kept per
+ * thread, since threads sharing a driver each run their own API.
+ */
+typedef struct AriesI2CStatsApiSlot {
+    AriesI2CDriverType* i2cDriver;
+    AriesI2CStatsApiType currentApi;
+    uint64_t apiStartUs;
+} AriesI2CStatsApiSlotType;
+
+// Table and entry stats are guarded by ariesI2CStatsMutex. The enabled count
+// is also read atomically without it so that drivers without stats skip the
+// mutex on every transaction
+static AriesI2CStatsEntryType ariesI2CStatsTable[ARIES_I2C_STATS_MAX_DRIVERS];
+static int ariesI2CStatsNumEnabled = 0;
+static pthread_mutex_t ariesI2CStatsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Only touched by the owning thread, so not guarded by ariesI2CStatsMutex
+static __thread AriesI2CStatsApiSlotType
+    ariesI2CStatsApiSlots[ARIES_I2C_STATS_MAX_DRIVERS];
+
+static const char* ariesI2CStatsApiNames[ARIES_I2C_STATS_NUM_APIS] = {
+    "other",
+    "ariesInitDevice",
+    "ariesCheckDeviceHealth",
+    "ariesCheckLinkHealth",
+    "ariesGetLinkState",
+    "ariesGetLinkStateDetailed",
+    "ariesGetCurrentTemp",
+    "ariesGetMaxTemp",
+    "ariesLTSSMLoggerReadEntry",
+    "ariesLTSSMLoggerReadBuffer",
+    "ariesUpdateFirmware",
+    "ariesWriteEEPROMImage",
+    "ariesVerifyEEPROMImage",
+    "ariesVerifyEEPROMImageViaChecksum",
+    "ariesHealthSchedPoll",
+    "ariesUpdateFirmwareDelta",
+    "ariesWriteEEPROMImagePageDelta",
+    "ariesEEPROMGetRangeChecksums",
+};
+
+
+/*
+ * Find stats entry for an I2C driver (NULL if stats not enabled).
+ * Must be called with ariesI2CStatsMutex held
+ */
+static AriesI2CStatsEntryType* ariesI2CStatsFind(
+        AriesI2CDriverType* i2cDriver)
+{
+    int i;
+
+    for (i = 0; i < ARIES_I2C_STATS_MAX_DRIVERS; i++)
+    {
+        if (ariesI2CStatsTable[i].i2cDriver == i2cDriver)
+        {
+            return &ariesI2CStatsTable[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*
+ * Lock the stats table and find the entry for an I2C driver. Returns with
+ * ariesI2CStatsMutex held if an entry was found, and unlocked if NULL
+ */
+static AriesI2CStatsEntryType* ariesI2CStatsLockEntry(
+        AriesI2CDriverType* i2cDriver)
+{
+    AriesI2CStatsEntryType* entry;
+
+    if (__atomic_load_n(&ariesI2CStatsNumEnabled, __ATOMIC_ACQUIRE) == 0)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&ariesI2CStatsMutex);
+    entry = ariesI2CStatsFind(i2cDriver);
+    if (entry == NULL)
+    {
+        pthread_mutex_unlock(&ariesI2CStatsMutex);
+    }
+    return entry;
+}
+
+
+/*
+ * Find the API slot of the current thread for an I2C driver (pass NULL to
+ * find a free slot)
+ */
+static AriesI2CStatsApiSlotType* ariesI2CStatsFindApiSlot(
+        AriesI2CDriverType* i2cDriver)
+{
+    int i;
+
+    for (i = 0; i < ARIES_I2C_STATS_MAX_DRIVERS; i++)
+    {
+        if (ariesI2CStatsApiSlots[i].i2cDriver == i2cDriver)
+        {
+            return &ariesI2CStatsApiSlots[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*
+ * Get the tracked API the current thread is running on an I2C driver
+ */
+static AriesI2CStatsApiType ariesI2CStatsCurrentApi(
+        AriesI2CDriverType* i2cDriver)
+{
+    AriesI2CStatsApiSlotType* slot = ariesI2CStatsFindApiSlot(i2cDriver);
+
+    if (slot == NULL)
+    {
+        return ARIES_I2C_STATS_API_OTHER;
+    }
+    return slot->currentApi;
+}
+
+
+/*
+ * Get monotonic timestamp in us
+ */
+static uint64_t ariesI2CStatsTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+
+/*
+ * Enable or disable I2C transaction stats for an I2C driver
+ */
+AriesErrorType ariesI2CStatsEnable(
+        AriesI2CDriverType* i2cDriver,
+        bool enable)
+{
+    AriesI2CStatsEntryType* entry;
+    int i;
+
+    pthread_mutex_lock(&ariesI2CStatsMutex);
+    entry = ariesI2CStatsFind(i2cDriver);
+    if (!enable)
+    {
+        if (entry != NULL)
+        {
+            entry->i2cDriver = NULL;
+            __atomic_store_n(&ariesI2CStatsNumEnabled,
+                ariesI2CStatsNumEnabled - 1, __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&ariesI2CStatsMutex);
+        return ARIES_SUCCESS;
+    }
+
+    if (entry == NULL)
+    {
+        for (i = 0; i < ARIES_I2C_STATS_MAX_DRIVERS; i++)
+        {
+            if (ariesI2CStatsTable[i].i2cDriver == NULL)
+            {
+                entry = &ariesI2CStatsTable[i];
+                break;
+            }
+        }
+        if (entry == NULL)
+        {
+            pthread_mutex_unlock(&ariesI2CStatsMutex);
+            ASTERA_ERROR("Max number of I2C drivers with stats reached");
+            return ARIES_I2C_STATS_TABLE_FULL;
+        }
+        entry->i2cDriver = i2cDriver;
+        __atomic_store_n(&ariesI2CStatsNumEnabled,
+            ariesI2CStatsNumEnabled + 1, __ATOMIC_RELEASE);
+    }
+
+    memset(&entry->stats, 0, sizeof(AriesI2CStatsType));
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get a snapshot of the I2C transaction stats for an I2C driver
+ */
+AriesErrorType ariesI2CStatsGet(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CStatsType* stats)
+{
+    AriesI2CStatsEntryType* entry = ariesI2CStatsLockEntry(i2cDriver);
+    if (entry == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+    *stats = entry->stats;
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Clear the I2C transaction stats for an I2C driver
+ */
+AriesErrorType ariesI2CStatsClear(
+        AriesI2CDriverType* i2cDriver)
+{
+    AriesI2CStatsEntryType* entry = ariesI2CStatsLockEntry(i2cDriver);
+    if (entry == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+    memset(&entry->stats, 0, sizeof(AriesI2CStatsType));
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the name of a tracked API
+ */
+const char* ariesI2CStatsApiName(
+        AriesI2CStatsApiType api)
+{
+    if ((api < 0) || (api >= ARIES_I2C_STATS_NUM_APIS))
+    {
+        return "unknown";
+    }
+    return ariesI2CStatsApiNames[api];
+}
+
+
+/*
+ * Mark the start of a tracked API
+ */
+AriesI2CStatsApiType ariesI2CStatsApiEnter(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CStatsApiType api)
+{
+    AriesI2CStatsEntryType* entry = ariesI2CStatsLockEntry(i2cDriver);
+    AriesI2CStatsApiSlotType* slot;
+
+    if (entry == NULL)
+    {
+        return ARIES_I2C_STATS_API_OTHER;
+    }
+
+    // Only the outermost API of this thread gets the attribution
+    slot = ariesI2CStatsFindApiSlot(i2cDriver);
+    if (slot != NULL)
+    {
+        pthread_mutex_unlock(&ariesI2CStatsMutex);
+        return slot->currentApi;
+    }
+
+    slot = ariesI2CStatsFindApiSlot(NULL);
+    if (slot != NULL)
+    {
+        slot->i2cDriver = i2cDriver;
+        slot->currentApi = api;
+        slot->apiStartUs = ariesI2CStatsTimeUs();
+        entry->stats.api[api].calls++;
+    }
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+    return ARIES_I2C_STATS_API_OTHER;
+}
+
+
+/*
+ * Mark the end of a tracked API
+ */
+void ariesI2CStatsApiExit(
+        AriesI2CDriverType* i2cDriver,
+        AriesI2CStatsApiType prevApi)
+{
+    AriesI2CStatsEntryType* entry;
+    AriesI2CStatsApiSlotType* slot;
+    AriesI2CStatsApiType api;
+    uint64_t apiStartUs;
+
+    if (prevApi != ARIES_I2C_STATS_API_OTHER)
+    {
+        return;
+    }
+    slot = ariesI2CStatsFindApiSlot(i2cDriver);
+    if (slot == NULL)
+    {
+        return;
+    }
+
+    // Free the slot even if stats were disabled while the API ran
+    api = slot->currentApi;
+    apiStartUs = slot->apiStartUs;
+    slot->i2cDriver = NULL;
+
+    entry = ariesI2CStatsLockEntry(i2cDriver);
+    if (entry == NULL)
+    {
+        return;
+    }
+    entry->stats.api[api].totalTimeUs += ariesI2CStatsTimeUs() - apiStartUs;
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+}
+
+
+/*
+ * Get start timestamp of an SMBus transaction
+ */
+uint64_t ariesI2CStatsStart(
+        AriesI2CDriverType* i2cDriver)
+{
+    if (ariesI2CStatsLockEntry(i2cDriver) == NULL)
+    {
+        return 0;
+    }
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+    return ariesI2CStatsTimeUs();
+}
+
+
+/*
+ * Record a completed SMBus transaction
+ */
+void ariesI2CStatsRecordTransaction(
+        AriesI2CDriverType* i2cDriver,
+        bool isRead,
+        int numBytes,
+        bool failed,
+        uint64_t startUs)
+{
+    AriesI2CStatsEntryType* entry = ariesI2CStatsLockEntry(i2cDriver);
+    AriesI2CApiStatsType* apiStats;
+    uint64_t latencyUs;
+    uint64_t bucketLimitUs = ARIES_I2C_STATS_LATENCY_BUCKET_BASE_US;
+    int bucket = 0;
+
+    if (entry == NULL)
+    {
+        return;
+    }
+    apiStats = &entry->stats.api[ariesI2CStatsCurrentApi(i2cDriver)];
+
+    // Bus bytes include slave address and command code. Reads include the
+    // repeated slave address as well
+    if (isRead)
+    {
+        apiStats->readTransactions++;
+        apiStats->bytesRead += numBytes + 3;
+    }
+    else
+    {
+        apiStats->writeTransactions++;
+        apiStats->bytesWritten += numBytes + 2;
+    }
+    if (failed)
+    {
+        apiStats->failedTransactions++;
+    }
+
+    latencyUs = ariesI2CStatsTimeUs() - startUs;
+    while ((bucket < (ARIES_I2C_STATS_NUM_LATENCY_BUCKETS-1)) &&
+        (latencyUs >= bucketLimitUs))
+    {
+        bucket++;
+        bucketLimitUs <<= 1;
+    }
+    apiStats->latencyBuckets[bucket]++;
+    pthread_mutex_unlock(&ariesI2CStatsMutex);
+}
+
+
+/*
+ * Record a block read retry
+ */
+void ariesI2CStatsRecordReadRetry(
+        AriesI2CDriverType* i2cDriver)
+{
+    AriesI2CStatsEntryType* entry = ariesI2CStatsLockEntry(i2cDriver);
+    if (entry != NULL)
+    {
+        entry->stats.api[ariesI2CStatsCurrentApi(i2cDriver)].readRetries++;
+        pthread_mutex_unlock(&ariesI2CStatsMutex);
+    }
+}
+
+
+/*
+ * Record an indirect access status poll
+ */
+void ariesI2CStatsRecordPoll(
+        AriesI2CDriverType* i2cDriver)
+{
+    AriesI2CStatsEntryType* entry = ariesI2CStatsLockEntry(i2cDriver);
+    if (entry != NULL)
+    {
+        entry->stats.api[ariesI2CStatsCurrentApi(i2cDriver)].pollIterations++;
+        pthread_mutex_unlock(&ariesI2CStatsMutex);
+    }
+}
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,12 @@
 
 #include "../include/aries_link.h"
 
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -436,23 +442,585 @@ AriesErrorType ariesLinkPrintDetailedState(
 }
 
 
-// Print the micro logger entries
-AriesErrorType ariesPrintLog(
+/*
+ * Field of a snapshot record, as described in the schema section
+ */
+typedef struct AriesSnapshotFieldDef
+{
+    AriesSnapshotSectionKindType sectionKind;
+    AriesSnapshotFieldKindType kind;
+    size_t offset;
+    int count;
+    const char* name;
+} AriesSnapshotFieldDefType;
+
+#define ARIES_SNAPSHOT_DEVICE_FIELD(kind, member, count, name) \
+    {ARIES_SNAPSHOT_SECTION_DEVICE, kind, \
+        offsetof(AriesSnapshotDeviceType, member), count, name}
+
+#define ARIES_SNAPSHOT_LINK_FIELD(kind, member, count, name) \
+    {ARIES_SNAPSHOT_SECTION_LINK, kind, \
+        offsetof(AriesSnapshotLinkType, member), count, name}
+
+#define ARIES_SNAPSHOT_LANE_FIELD(kind, member, count, name) \
+    {ARIES_SNAPSHOT_SECTION_LANE, kind, \
+        offsetof(AriesSnapshotLaneType, member), count, name}
+
+#define ARIES_SNAPSHOT_TX_FIELDS(port, prefix) \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.logicalLane, 1, prefix "_logical_lane"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_STRING, \
+        port.physicalPin, ARIES_SNAPSHOT_PIN_NAME_LEN, \
+        prefix "_physical_pin"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.de, 1, prefix "_de"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.pre, 1, prefix "_pre"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.cur, 1, prefix "_cur"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT, \
+        port.pst, 1, prefix "_pst"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastEqRate, 1, prefix "_last_eq_rate"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastPresetReq, 1, prefix "_last_preset_req"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastPreReq, 1, prefix "_last_pre_req"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastCurReq, 1, prefix "_last_cur_req"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastPstReq, 1, prefix "_last_pst_req")
+
+#define ARIES_SNAPSHOT_RX_FIELDS(port, prefix) \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.logicalLane, 1, prefix "_logical_lane"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_STRING, \
+        port.physicalPin, ARIES_SNAPSHOT_PIN_NAME_LEN, \
+        prefix "_physical_pin"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.termination, 1, prefix "_termination"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.polarity, 1, prefix "_polarity"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT, \
+        port.attdB, 1, prefix "_att_db"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT, \
+        port.ctleBoostdB, 1, prefix "_ctle_boost_db"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.ctlePole, 1, prefix "_ctle_pole"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT, \
+        port.vgadB, 1, prefix "_vga_db"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT, \
+        port.dfe, 8, prefix "_dfe"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastEqRate, 1, prefix "_last_eq_rate"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastPresetReq, 4, prefix "_last_preset_req"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        port.lastPresetReqFom, 4, prefix "_last_preset_req_fom")
+
+#define ARIES_SNAPSHOT_CORE_FIELDS(path, prefix) \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT, \
+        path.tempC, 1, prefix "_tj_c"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        path.deskewNs, 1, prefix "_skew_ns"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        path.tempAlert, 1, prefix "_tj_c_alert"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        path.pathFWState, 1, prefix "_pth_fw_state"), \
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT, \
+        path.pathHWState, 1, prefix "_pth_hw_state")
+
+static const AriesSnapshotFieldDefType ariesSnapshotFields[] =
+{
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        fwVersionMajor, 1, "fw_version_major"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        fwVersionMinor, 1, "fw_version_minor"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        fwVersionBuild, 1, "fw_version_build"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        partNumber, 1, "part_number"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        revNumber, 1, "rev_number"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        i2cBus, 1, "i2c_bus"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        slaveAddr, 1, "slave_addr"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        deviceOkay, 1, "device_okay"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        overtempAlert, 1, "overtemp_alert"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT,
+        maxTempC, 1, "all_time_max_temp_c"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT,
+        currentTempC, 1, "current_temp_c"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT,
+        tempAlertThreshC, 1, "temp_alert_thresh_c"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_UINT8,
+        chipID, 12, "chip_id"),
+    ARIES_SNAPSHOT_DEVICE_FIELD(ARIES_SNAPSHOT_FIELD_UINT8,
+        lotNumber, 6, "lot_number"),
+
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        linkId, 1, "link_id"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        startLane, 1, "start_lane"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        width, 1, "width"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        curWidth, 1, "cur_width"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        state, 1, "state"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        rate, 1, "rate"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        linkOkay, 1, "link_okay"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        linkMinFoM, 1, "link_min_fom"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        recoveryCount, 1, "recovery_count"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT,
+        usppSpeed, 1, "uspp_speed"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_FLOAT,
+        dsppSpeed, 1, "dspp_speed"),
+    ARIES_SNAPSHOT_LINK_FIELD(ARIES_SNAPSHOT_FIELD_STRING,
+        linkMinFoMRx, ARIES_SNAPSHOT_PIN_NAME_LEN, "link_min_fom_rx"),
+
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        laneIndex, 1, "lane"),
+    ARIES_SNAPSHOT_LANE_FIELD(ARIES_SNAPSHOT_FIELD_INT,
+        physicalLane, 1, "physical_lane"),
+    ARIES_SNAPSHOT_TX_FIELDS(usppTx, "uspp_tx"),
+    ARIES_SNAPSHOT_RX_FIELDS(usppRx, "uspp_rx"),
+    ARIES_SNAPSHOT_CORE_FIELDS(usCore, "rt_core_us"),
+    ARIES_SNAPSHOT_CORE_FIELDS(dsCore, "rt_core_ds"),
+    ARIES_SNAPSHOT_TX_FIELDS(dsppTx, "dspp_tx"),
+    ARIES_SNAPSHOT_RX_FIELDS(dsppRx, "dspp_rx"),
+};
+
+#define ARIES_SNAPSHOT_NUM_FIELDS \
+    ((int) (sizeof(ariesSnapshotFields) / sizeof(ariesSnapshotFields[0])))
+
+
+/*
+ * Round a snapshot offset up to the section alignment
+ */
+static uint32_t ariesSnapshotAlign(
+        uint32_t offset)
+{
+    return (offset + ARIES_SNAPSHOT_ALIGN - 1) &
+        ~((uint32_t) ARIES_SNAPSHOT_ALIGN - 1);
+}
+
+
+/*
+ * Append a section to a snapshot being built and return its data
+ */
+static uint8_t* ariesSnapshotAddSection(
+        uint8_t* buffer,
+        AriesSnapshotSectionKindType kind,
+        int id,
+        uint32_t recordSize,
+        uint32_t numRecords,
+        uint32_t param)
+{
+    AriesSnapshotHeaderType* header = (AriesSnapshotHeaderType*) buffer;
+    AriesSnapshotSectionType* section;
+
+    section = (AriesSnapshotSectionType*) (buffer +
+        sizeof(AriesSnapshotHeaderType)) + header->numSections;
+    header->numSections++;
+
+    section->kind = kind;
+    section->id = id;
+    section->offset = header->fileSize;
+    section->size = recordSize * numRecords;
+    section->recordSize = recordSize;
+    section->numRecords = numRecords;
+    section->param = param;
+
+    header->fileSize = ariesSnapshotAlign(section->offset + section->size);
+
+    return buffer + section->offset;
+}
+
+
+/*
+ * Copy a pin name into a snapshot record
+ */
+static void ariesSnapshotCopyName(
+        char* dest,
+        const char* src)
+{
+    if (src != NULL)
+    {
+        strncpy(dest, src, ARIES_SNAPSHOT_PIN_NAME_LEN - 1);
+    }
+}
+
+
+/*
+ * Fill the Tx record of a lane from the link state
+ */
+static void ariesSnapshotFillTx(
+        AriesSnapshotTxType* tx,
+        AriesTxStateType* state)
+{
+    tx->logicalLane = state->logicalLaneNum;
+    ariesSnapshotCopyName(tx->physicalPin, state->physicalPinName);
+    tx->de = state->de;
+    tx->pre = state->pre;
+    tx->cur = state->cur;
+    tx->pst = state->pst;
+    tx->lastEqRate = state->lastEqRate;
+    tx->lastPresetReq = state->lastPresetReq;
+    tx->lastPreReq = state->lastPreReq;
+    tx->lastCurReq = state->lastCurReq;
+    tx->lastPstReq = state->lastPstReq;
+}
+
+
+/*
+ * Fill the Rx record of a lane from the link state
+ */
+static void ariesSnapshotFillRx(
+        AriesSnapshotRxType* rx,
+        AriesRxStateType* state)
+{
+    rx->logicalLane = state->logicalLaneNum;
+    ariesSnapshotCopyName(rx->physicalPin, state->physicalPinName);
+    rx->termination = state->termination;
+    rx->polarity = state->polarity;
+    rx->attdB = state->attdB;
+    rx->ctleBoostdB = state->ctleBoostdB;
+    rx->ctlePole = state->ctlePole;
+    rx->vgadB = state->vgadB;
+    rx->dfe[0] = state->dfe1;
+    rx->dfe[1] = state->dfe2;
+    rx->dfe[2] = state->dfe3;
+    rx->dfe[3] = state->dfe4;
+    rx->dfe[4] = state->dfe5;
+    rx->dfe[5] = state->dfe6;
+    rx->dfe[6] = state->dfe7;
+    rx->dfe[7] = state->dfe8;
+    rx->lastEqRate = state->lastEqRate;
+    rx->lastPresetReq[0] = state->lastPresetReq;
+    rx->lastPresetReq[1] = state->lastPresetReqM1;
+    rx->lastPresetReq[2] = state->lastPresetReqM2;
+    rx->lastPresetReq[3] = state->lastPresetReqM3;
+    rx->lastPresetReqFom[0] = state->lastPresetReqFom;
+    rx->lastPresetReqFom[1] = state->lastPresetReqFomM1;
+    rx->lastPresetReqFom[2] = state->lastPresetReqFomM2;
+    rx->lastPresetReqFom[3] = state->lastPresetReqFomM3;
+}
+
+
+/*
+ * Write a snapshot buffer to a file with a single write. The file is
+ * written under a temporary name and renamed, so that a previous snapshot
+ * is only replaced by a complete one
+ */
+static AriesErrorType ariesSnapshotWriteFile(
+        const char* filepath,
+        const uint8_t* buffer,
+        size_t size)
+{
+    char tmppath[ARIES_PATH_MAX];
+    ssize_t numWritten;
+    size_t offset = 0;
+    int numChars;
+    int fd;
+
+    numChars = snprintf(tmppath, ARIES_PATH_MAX, "%s.tmp", filepath);
+    if ((numChars < 0) || (numChars >= ARIES_PATH_MAX))
+    {
+        ASTERA_ERROR("Snapshot path %s is too long", filepath);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+    fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        ASTERA_ERROR("Could not open the specified filepath");
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    while (offset < size)
+    {
+        numWritten = write(fd, (buffer + offset), (size - offset));
+        if (numWritten <= 0)
+        {
+            ASTERA_ERROR("Could not write snapshot %s", tmppath);
+            close(fd);
+            unlink(tmppath);
+            return ARIES_SNAPSHOT_FAILURE;
+        }
+        offset += numWritten;
+    }
+
+    if ((close(fd) != 0) || (rename(tmppath, filepath) != 0))
+    {
+        ASTERA_ERROR("Could not write snapshot %s", filepath);
+        unlink(tmppath);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+// Capture the detailed link state and micro logs into a binary snapshot
+AriesErrorType ariesLinkWriteSnapshot(
+        AriesLinkType* link,
+        const char* basepath,
+        const char* filename)
+{
+    AriesLTSSMEntryType entries[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    AriesSnapshotHeaderType* header;
+    AriesSnapshotFieldType* fields;
+    AriesSnapshotDeviceType* device;
+    AriesSnapshotLinkType* snapLink;
+    AriesSnapshotLaneType* lanes;
+    AriesRetimerCoreStateType* core;
+    AriesErrorType rc;
+    char filepath[ARIES_PATH_MAX];
+    uint8_t* buffer;
+    uint8_t* data;
+    uint32_t maxSize;
+    int numSections;
+    int numEntries;
+    int entryIndex;
+    int fieldIndex;
+    int laneIndex;
+    int logIndex;
+    int log;
+    int numChars;
+    bool complete;
+    bool atBoundary;
+
+    if (!link || !basepath || !filename)
+    {
+        ASTERA_ERROR("Invalid link or basepath or filename passed");
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    if (strlen(basepath) == 0 || strlen(filename) == 0)
+    {
+        ASTERA_ERROR("Can't load a file without the basepath or filename");
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Check overall device health
+    rc = ariesCheckDeviceHealth(link->device);
+    CHECK_SUCCESS(rc);
+
+    // Get Link state
+    rc = ariesGetLinkStateDetailed(link);
+    CHECK_SUCCESS(rc);
+
+    // Initialise logger and enable Macros to print
+    rc = ariesLTSSMLoggerInit(link, 0, ARIES_LTSSM_VERBOSITY_HIGH);
+    CHECK_SUCCESS(rc);
+    rc = ariesLTSSMLoggerPrintEn(link, 1);
+    CHECK_SUCCESS(rc);
+
+    int startLane = ariesGetStartLane(link);
+    int width = link->state.width;
+    if ((width < 0) || (width > 16))
+    {
+        return ARIES_LINK_CONFIG_INVALID;
+    }
+
+    // Schema, device, link and lane sections, a Main Micro log and a Path
+    // Micro log per lane. The whole file is built in memory
+    numSections = 4 + 1 + width;
+    maxSize = ariesSnapshotAlign(sizeof(AriesSnapshotHeaderType) +
+        (numSections * sizeof(AriesSnapshotSectionType))) +
+        ariesSnapshotAlign(ARIES_SNAPSHOT_NUM_FIELDS *
+            sizeof(AriesSnapshotFieldType)) +
+        ariesSnapshotAlign(sizeof(AriesSnapshotDeviceType)) +
+        ariesSnapshotAlign(sizeof(AriesSnapshotLinkType)) +
+        ariesSnapshotAlign(width * sizeof(AriesSnapshotLaneType)) +
+        ariesSnapshotAlign(ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE) +
+        (width * ariesSnapshotAlign(ARIES_PM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE));
+
+    buffer = (uint8_t*) calloc(1, maxSize);
+    if (buffer == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+
+    header = (AriesSnapshotHeaderType*) buffer;
+    header->magic = ARIES_SNAPSHOT_MAGIC;
+    header->versionMajor = ARIES_SNAPSHOT_VERSION_MAJOR;
+    header->versionMinor = ARIES_SNAPSHOT_VERSION_MINOR;
+    header->headerSize = sizeof(AriesSnapshotHeaderType) +
+        (numSections * sizeof(AriesSnapshotSectionType));
+    header->fileSize = ariesSnapshotAlign(header->headerSize);
+    header->timestamp = (int64_t) time(NULL);
+    strncpy(header->sdkVersion, (const char*) ariesGetSDKVersion(),
+        sizeof(header->sdkVersion) - 1);
+
+    // Schema
+    fields = (AriesSnapshotFieldType*) ariesSnapshotAddSection(buffer,
+        ARIES_SNAPSHOT_SECTION_SCHEMA, 0, sizeof(AriesSnapshotFieldType),
+        ARIES_SNAPSHOT_NUM_FIELDS, 0);
+    for (fieldIndex = 0; fieldIndex < ARIES_SNAPSHOT_NUM_FIELDS; fieldIndex++)
+    {
+        fields[fieldIndex].sectionKind =
+            ariesSnapshotFields[fieldIndex].sectionKind;
+        fields[fieldIndex].kind = ariesSnapshotFields[fieldIndex].kind;
+        fields[fieldIndex].offset = ariesSnapshotFields[fieldIndex].offset;
+        fields[fieldIndex].count = ariesSnapshotFields[fieldIndex].count;
+        strncpy(fields[fieldIndex].name, ariesSnapshotFields[fieldIndex].name,
+            ARIES_SNAPSHOT_FIELD_NAME_LEN - 1);
+    }
+
+    // Aries device struct parameters
+    device = (AriesSnapshotDeviceType*) ariesSnapshotAddSection(buffer,
+        ARIES_SNAPSHOT_SECTION_DEVICE, 0, sizeof(AriesSnapshotDeviceType),
+        1, 0);
+    device->fwVersionMajor = link->device->fwVersion.major;
+    device->fwVersionMinor = link->device->fwVersion.minor;
+    device->fwVersionBuild = link->device->fwVersion.build;
+    device->partNumber = link->device->partNumber;
+    device->revNumber = link->device->revNumber;
+    device->i2cBus = link->device->i2cBus;
+    device->slaveAddr = link->device->i2cDriver->slaveAddr;
+    device->deviceOkay = link->device->deviceOkay;
+    device->overtempAlert = link->device->overtempAlert;
+    device->maxTempC = link->device->maxTempC;
+    device->currentTempC = link->device->currentTempC;
+    device->tempAlertThreshC = link->device->tempAlertThreshC;
+    memcpy(device->chipID, link->device->chipID, sizeof(device->chipID));
+    memcpy(device->lotNumber, link->device->lotNumber,
+        sizeof(device->lotNumber));
+
+    // Aries link struct parameters
+    snapLink = (AriesSnapshotLinkType*) ariesSnapshotAddSection(buffer,
+        ARIES_SNAPSHOT_SECTION_LINK, 0, sizeof(AriesSnapshotLinkType), 1, 0);
+    snapLink->linkId = link->config.linkId;
+    snapLink->startLane = startLane;
+    snapLink->width = link->state.width;
+    snapLink->curWidth = link->state.curWidth;
+    snapLink->state = link->state.state;
+    snapLink->rate = link->state.rate;
+    snapLink->linkOkay = link->state.linkOkay;
+    snapLink->linkMinFoM = link->state.linkMinFoM;
+    snapLink->recoveryCount = link->state.recoveryCount;
+    snapLink->usppSpeed = link->state.usppSpeed;
+    snapLink->dsppSpeed = link->state.dsppSpeed;
+    ariesSnapshotCopyName(snapLink->linkMinFoMRx, link->state.linkMinFoMRx);
+
+    // Per lane stats
+    lanes = (AriesSnapshotLaneType*) ariesSnapshotAddSection(buffer,
+        ARIES_SNAPSHOT_SECTION_LANE, 0, sizeof(AriesSnapshotLaneType), width,
+        0);
+    core = &link->state.coreState;
+    for (laneIndex = 0; laneIndex < width; laneIndex++)
+    {
+        lanes[laneIndex].laneIndex = laneIndex;
+        lanes[laneIndex].physicalLane = laneIndex + startLane;
+        ariesSnapshotFillTx(&lanes[laneIndex].usppTx,
+            &link->state.usppState.txState[laneIndex]);
+        ariesSnapshotFillRx(&lanes[laneIndex].usppRx,
+            &link->state.usppState.rxState[laneIndex]);
+        lanes[laneIndex].usCore.tempC = core->usppTempC[laneIndex];
+        lanes[laneIndex].usCore.deskewNs = core->usDeskewNs[laneIndex];
+        lanes[laneIndex].usCore.tempAlert = core->usppTempAlert[laneIndex];
+        lanes[laneIndex].usCore.pathFWState = core->usppPathFWState[laneIndex];
+        lanes[laneIndex].usCore.pathHWState = core->usppPathHWState[laneIndex];
+        lanes[laneIndex].dsCore.tempC = core->dsppTempC[laneIndex];
+        lanes[laneIndex].dsCore.deskewNs = core->dsDeskewNs[laneIndex];
+        lanes[laneIndex].dsCore.tempAlert = core->dsppTempAlert[laneIndex];
+        lanes[laneIndex].dsCore.pathFWState = core->dsppPathFWState[laneIndex];
+        lanes[laneIndex].dsCore.pathHWState = core->dsppPathHWState[laneIndex];
+        ariesSnapshotFillTx(&lanes[laneIndex].dsppTx,
+            &link->state.dsppState.txState[laneIndex]);
+        ariesSnapshotFillRx(&lanes[laneIndex].dsppRx,
+            &link->state.dsppState.rxState[laneIndex]);
+    }
+
+    // Main Micro log, then the Path Micro log of each lane, as raw bytes
+    for (logIndex = 0; logIndex <= width; logIndex++)
+    {
+        log = (logIndex == 0) ? ARIES_LTSSM_LINK_LOGGER :
+            (startLane + logIndex - 1);
+        rc = ariesReadLog(link, log, entries, &numEntries, &complete,
+            &atBoundary);
+        if (rc != ARIES_SUCCESS)
+        {
+            free(buffer);
+            return rc;
+        }
+
+        data = ariesSnapshotAddSection(buffer, ARIES_SNAPSHOT_SECTION_LOG,
+            log, 1, numEntries, (numEntries > 0) ? entries[0].offset : 0);
+        for (entryIndex = 0; entryIndex < numEntries; entryIndex++)
+        {
+            data[entryIndex] = entries[entryIndex].data;
+        }
+    }
+
+    numChars = snprintf(filepath, ARIES_PATH_MAX, "%s/%s_%d.snap", basepath,
+        filename, link->config.linkId);
+    if ((numChars < 0) || (numChars >= ARIES_PATH_MAX))
+    {
+        ASTERA_ERROR("Snapshot path %s/%s is too long", basepath, filename);
+        free(buffer);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+    rc = ariesSnapshotWriteFile(filepath, buffer, header->fileSize);
+    free(buffer);
+
+    return rc;
+}
+
+
+// Check if print buffer bytes were never written
+bool ariesLogUnused(
+        const uint8_t* values,
+        int numValues)
+{
+    int index;
+
+    // Format IDs are not zero, so a written buffer holds at most the zero
+    // link/path byte and variables of a message in a row
+    if (numValues < ARIES_LTSSM_MSG_MAX_BYTES)
+    {
+        return false;
+    }
+    for (index = 0; index < numValues; index++)
+    {
+        if (values[index] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// Read the micro logger entries in log order
+AriesErrorType ariesReadLog(
         AriesLinkType* link,
         AriesLTSSMLoggerEnumType log,
-        FILE* fp)
+        AriesLTSSMEntryType* entries,
+        int* numEntries,
+        bool* complete,
+        bool* atBoundary)
 {
-    AriesLTSSMEntryType ltssmEntry;
-    int offset = 0;
+    uint8_t buffer[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
     int oneBatchModeEn;
     int oneBatchWrEn;
-    int batchComplete;
-    int currFmtID;
     int currWriteOffset;
+    int numBytes;
+    int index;
+    int offset;
     AriesErrorType rc;
-    int full = 0;
 
-    ltssmEntry.logType = log;
+    *numEntries = 0;
+    *complete = false;
+    *atBoundary = true;
 
     // Buffer size different for main and path micros
     int bufferSize;
@@ -479,98 +1047,119 @@ AriesErrorType ariesPrintLog(
         rc = ariesLTSSMLoggerPrintEn(link, 0);
         CHECK_SUCCESS(rc);
 
-        // In this mode we print the logger from current write offset
-        // and reset the offset to zero once we reach the end of the buffer
-        // Capture current write offset
+        // In this mode the buffer wraps around at the current write offset.
+        // Capture the (paused) write offset and the whole buffer, and unroll
+        // the wrap-around in host memory
         rc = ariesGetLoggerWriteOffset(link, log, &currWriteOffset);
         CHECK_SUCCESS(rc);
-        // Start offset from the current (paused) offset
-        offset = currWriteOffset;
-
-        // Print logger from current offset
-        while (offset < bufferSize)
+        if ((currWriteOffset < 0) || (currWriteOffset >= bufferSize))
         {
-            rc = ariesLTSSMLoggerReadEntry(link, log, &offset, &ltssmEntry);
-            CHECK_SUCCESS(rc);
-            fprintf(fp, "            {\n");
-            fprintf(fp, "                'data': %d,\n", ltssmEntry.data);
-            fprintf(fp, "                'offset': %d\n", ltssmEntry.offset);
-            fprintf(fp, "            },\n");
+            currWriteOffset = 0;
         }
 
-        // Wrap around and continue reading the log entries
-        if (currWriteOffset != 0)
-        {
-            // Reset offset to start from beginning
-            offset = 0;
-
-            // Print logger from start of print buffer
-            while(offset < currWriteOffset)
-            {
-                // Read logger entry
-                rc = ariesLTSSMLoggerReadEntry(link, log, &offset, &ltssmEntry);
-                CHECK_SUCCESS(rc);
-                fprintf(fp, "            {\n");
-                fprintf(fp, "                'data': %d,\n", ltssmEntry.data);
-                fprintf(fp, "                'offset': %d\n", ltssmEntry.offset);
-                fprintf(fp, "            },\n");
-            }
-        }
+        rc = ariesLTSSMLoggerReadBuffer(link, log, 0, bufferSize, buffer);
+        CHECK_SUCCESS(rc);
 
         // Enable Macros to print
         rc = ariesLTSSMLoggerPrintEn(link, 1);
         CHECK_SUCCESS(rc);
+
+        // Oldest entry is at the current write offset, unless the buffer has
+        // not wrapped yet. The log then starts at offset 0
+        numBytes = bufferSize;
+        if (ariesLogUnused(&buffer[currWriteOffset],
+            (bufferSize - currWriteOffset)))
+        {
+            numBytes = currWriteOffset;
+            currWriteOffset = 0;
+        }
+        else
+        {
+            *atBoundary = false;
+        }
+        for (index = 0; index < numBytes; index++)
+        {
+            offset = (currWriteOffset + index) % bufferSize;
+            entries[index].logType = log;
+            entries[index].data = buffer[offset];
+            entries[index].offset = offset;
+        }
+        *numEntries = numBytes;
     }
     else
     {
-        // Check if batch is complete
-        batchComplete = (oneBatchModeEn == 1) && (oneBatchWrEn == 0);
-
-        // Read format ID at current offset
-        rc = ariesGetLoggerFmtID(link, log, offset, &currFmtID);
-        CHECK_SUCCESS(rc);
-
-        if (batchComplete == 1)
+        // A complete batch fills the buffer from its start. A batch in
+        // progress is valid up to the current write offset
+        numBytes = bufferSize;
+        if (oneBatchWrEn != 0)
         {
-            full = 1;
-            while ((currFmtID != 0) && (offset < bufferSize))
+            rc = ariesGetLoggerWriteOffset(link, log, &currWriteOffset);
+            CHECK_SUCCESS(rc);
+            if ((currWriteOffset >= 0) && (currWriteOffset < bufferSize))
             {
-                // Get logger entry
-                rc = ariesLTSSMLoggerReadEntry(link, log, &offset, &ltssmEntry);
-                CHECK_SUCCESS(rc);
-                fprintf(fp, "            {\n");
-                fprintf(fp, "                'data': %d,\n", ltssmEntry.data);
-                fprintf(fp, "                'offset': %d\n", ltssmEntry.offset);
-                fprintf(fp, "            },\n");
-                // Read Fmt ID
-                rc = ariesGetLoggerFmtID(link, log, offset, &currFmtID);
-                CHECK_SUCCESS(rc);
+                numBytes = currWriteOffset;
             }
         }
         else
         {
-            // Print from start of the buffer until the end
-            while ((currFmtID != 0) && (offset < bufferSize) &&
-                (offset < currWriteOffset))
-            {
-                // Get logger entry
-                rc = ariesLTSSMLoggerReadEntry(link, log, &offset, &ltssmEntry);
-                CHECK_SUCCESS(rc);
-                fprintf(fp, "            {\n");
-                fprintf(fp, "                'data': %d,\n", ltssmEntry.data);
-                fprintf(fp, "                'offset': %d\n", ltssmEntry.offset);
-                fprintf(fp, "            },\n");
-                // Read Fmt ID
-                rc = ariesGetLoggerFmtID(link, log, offset, &currFmtID);
-                CHECK_SUCCESS(rc);
-                // Read current write offset
-                rc = ariesGetLoggerWriteOffset(link, log, &currWriteOffset);
-                CHECK_SUCCESS(rc);
-            }
+            *complete = true;
+        }
+
+        rc = ariesLTSSMLoggerReadBuffer(link, log, 0, numBytes, buffer);
+        CHECK_SUCCESS(rc);
+
+        // Log ends at the first zero format ID. Variables may be zero too,
+        // so it ends where the rest of the batch was never written. The
+        // zeros there may include the last variables of the last message,
+        // so keep up to a message of them (zero format IDs are skipped)
+        offset = 0;
+        while ((offset < numBytes) && ((buffer[offset] != 0) ||
+            !ariesLogUnused(&buffer[offset], (numBytes - offset))))
+        {
+            offset++;
+        }
+        if ((offset + ARIES_LTSSM_MSG_MAX_BYTES - 1) < numBytes)
+        {
+            numBytes = offset + ARIES_LTSSM_MSG_MAX_BYTES - 1;
         }
+        for (offset = 0; offset < numBytes; offset++)
+        {
+            entries[offset].logType = log;
+            entries[offset].data = buffer[offset];
+            entries[offset].offset = offset;
+        }
+        *numEntries = numBytes;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+// Print the micro logger entries
+AriesErrorType ariesPrintLog(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType log,
+        FILE* fp)
+{
+    AriesLTSSMEntryType entries[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    int numEntries;
+    int index;
+    bool full;
+    bool atBoundary;
+    AriesErrorType rc;
+
+    rc = ariesReadLog(link, log, entries, &numEntries, &full, &atBoundary);
+    CHECK_SUCCESS(rc);
+
+    for (index = 0; index < numEntries; index++)
+    {
+        fprintf(fp, "            {\n");
+        fprintf(fp, "                'data': %d,\n", entries[index].data);
+        fprintf(fp, "                'offset': %d\n", entries[index].offset);
+        fprintf(fp, "            },\n");
     }
 
-    if (full == 0)
+    if (!full)
     {
         ASTERA_INFO("There is more to print ...");
     }
@@ -583,23 +1172,45 @@ AriesErrorType ariesLinkGetCurrentWidth(
         int* currentWidth)
 {
     AriesErrorType rc;
-    uint8_t dataByte[1];
+    AriesI2COpType ops[ARIES_I2C_SUBMIT_MAX_OPS];
+    uint8_t pathState[ARIES_I2C_SUBMIT_MAX_OPS];
     uint32_t addressOffset;
+    int numOps;
+    int opIndex;
     // Check state of each path micro in the link. If it is in FWD we add to current width
     *currentWidth = 0;
 
     int i;
     int startLane = ariesGetStartLane(link);
-    for (i = startLane; i < link->config.maxWidth + startLane; i++)
+    // Submit the per-path state reads as transaction lists, so that they can
+    // go out back to back
+    for (i = startLane; i < link->config.maxWidth + startLane; i += numOps)
     {
-        addressOffset = ARIES_QS_0_CSR_OFFSET + (ARIES_PATH_WRAPPER_1_CSR_OFFSET * i);
+        numOps = link->config.maxWidth + startLane - i;
+        if (numOps > ARIES_I2C_SUBMIT_MAX_OPS)
+        {
+            numOps = ARIES_I2C_SUBMIT_MAX_OPS;
+        }
+
+        for (opIndex = 0; opIndex < numOps; opIndex++)
+        {
+            addressOffset = ARIES_QS_0_CSR_OFFSET +
+                (ARIES_PATH_WRAPPER_1_CSR_OFFSET * (i + opIndex));
+            ops[opIndex].isRead = true;
+            ops[opIndex].address = addressOffset + 0xb7;
+            ops[opIndex].numBytes = 1;
+            ops[opIndex].values = &pathState[opIndex];
+        }
 
-        rc = ariesReadByteData(link->device->i2cDriver, addressOffset + 0xb7, dataByte);
+        rc = ariesI2CSubmit(link->device->i2cDriver, ops, numOps);
         CHECK_SUCCESS(rc);
 
-        if (dataByte[0] == 0x13) // FWD state
+        for (opIndex = 0; opIndex < numOps; opIndex++)
         {
-            (*currentWidth)++;
+            if (pathState[opIndex] == 0x13) // FWD state
+            {
+                (*currentWidth)++;
+            }
         }
     }
 
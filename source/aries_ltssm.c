@@ -0,0 +1,1400 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_ltssm.c
+ * @brief Implementation of the LTSSM log decoder.
+ *
+ * The message framing follows scripts/print_link_logs.py: a format ID byte,
+ * a link/path byte for Main Micro messages, and a 2-byte variable (MSB
+ * first) per % of the format text. The format IDs and texts are defined by
+ * the FW build, so the decoder is driven by the Main Micro and Path Micro
+ * format tables of the FW (scripts/link_micro_logs/ALMainFmtIdDict.py and
+ * ALPathFmtIdDict.py), loaded at run time.
+ */
+
+#include "../include/aries_ltssm.h"
+
+#include <string.h>
+#include <ctype.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Get the num variables of a format. As in print_link_logs.py, each % of the
+ * text is a variable
+ */
+static int ariesLTSSMFmtNumVars(
+        const AriesLTSSMFmtType* fmt)
+{
+    const char* text;
+    int numVars = 0;
+
+    for (text = fmt->text; *text != '\0'; text++)
+    {
+        if (*text == '%')
+        {
+            numVars++;
+        }
+    }
+
+    return numVars;
+}
+
+
+/*
+ * Check if the first variable of a format is a time stamp
+ */
+static bool ariesLTSSMFmtHasTime(
+        const AriesLTSSMFmtType* fmt)
+{
+    return (strstr(fmt->text, "%x ms") != NULL);
+}
+
+
+/*
+ * Index the formats of one micro by format ID
+ */
+static AriesErrorType ariesLTSSMDecoderSetFmts(
+        const AriesLTSSMFmtType** fmtByID,
+        const AriesLTSSMFmtType* fmts,
+        int numFmts)
+{
+    int fmtIndex;
+
+    if (((fmts == NULL) && (numFmts != 0)) || (numFmts < 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    for (fmtIndex = 0; fmtIndex < numFmts; fmtIndex++)
+    {
+        if ((fmts[fmtIndex].fmtID == 0) ||
+            (ariesLTSSMFmtNumVars(&fmts[fmtIndex]) >
+                ARIES_LTSSM_FMT_MAX_VARS) ||
+            (fmts[fmtIndex].kind == ARIES_LTSSM_EVENT_UNKNOWN))
+        {
+            ASTERA_ERROR("Invalid logger format %d", fmtIndex);
+            return ARIES_INVALID_ARGUMENT;
+        }
+        if (fmtByID[fmts[fmtIndex].fmtID] != NULL)
+        {
+            ASTERA_ERROR("Duplicate logger format ID 0x%02x",
+                fmts[fmtIndex].fmtID);
+            return ARIES_INVALID_ARGUMENT;
+        }
+        fmtByID[fmts[fmtIndex].fmtID] = &fmts[fmtIndex];
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Initialize a decoder with the Main Micro and Path Micro format tables
+ */
+AriesErrorType ariesLTSSMDecoderInit(
+        AriesLTSSMDecoderType* decoder,
+        const AriesLTSSMFmtType* mmFmts,
+        int numMmFmts,
+        const AriesLTSSMFmtType* pmFmts,
+        int numPmFmts)
+{
+    AriesErrorType rc;
+
+    if (decoder == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(decoder, 0, sizeof(AriesLTSSMDecoderType));
+    rc = ariesLTSSMDecoderSetFmts(decoder->mmFmts, mmFmts, numMmFmts);
+    CHECK_SUCCESS(rc);
+    rc = ariesLTSSMDecoderSetFmts(decoder->pmFmts, pmFmts, numPmFmts);
+    CHECK_SUCCESS(rc);
+    decoder->numPendingBytes = -1;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Deliver decoded events to a callback
+ */
+AriesErrorType ariesLTSSMDecoderSetCallback(
+        AriesLTSSMDecoderType* decoder,
+        AriesLTSSMEventCallbackType callback,
+        void* userData)
+{
+    if (decoder == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    decoder->callback = callback;
+    decoder->userData = userData;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Store decoded events in an array
+ */
+AriesErrorType ariesLTSSMDecoderSetEvents(
+        AriesLTSSMDecoderType* decoder,
+        AriesLTSSMEventType* events,
+        int maxEvents)
+{
+    if ((decoder == NULL) || ((events == NULL) && (maxEvents != 0)) ||
+        (maxEvents < 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    decoder->events = events;
+    decoder->maxEvents = maxEvents;
+    decoder->numEvents = 0;
+    decoder->numDropped = 0;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Reset the framing of a decoder
+ */
+AriesErrorType ariesLTSSMDecoderReset(
+        AriesLTSSMDecoderType* decoder)
+{
+    if (decoder == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    decoder->numPendingBytes = -1;
+    decoder->stalled = false;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Deliver a decoded event
+ */
+static void ariesLTSSMDecoderEmit(
+        AriesLTSSMDecoderType* decoder,
+        AriesLTSSMEventType* event)
+{
+    int varIndex;
+
+    if ((event->kind == ARIES_LTSSM_EVENT_STATE) ||
+        (event->kind == ARIES_LTSSM_EVENT_EQ_PHASE) ||
+        (event->kind == ARIES_LTSSM_EVENT_RATE))
+    {
+        varIndex = event->hasTime ? 1 : 0;
+        event->value = (event->numVars > varIndex) ? event->vars[varIndex] :
+            event->fmtID;
+    }
+    else
+    {
+        event->value = 0;
+    }
+
+    if (decoder->events != NULL)
+    {
+        if (decoder->numEvents < decoder->maxEvents)
+        {
+            decoder->events[decoder->numEvents++] = *event;
+        }
+        else
+        {
+            decoder->numDropped++;
+        }
+    }
+    if (decoder->callback != NULL)
+    {
+        decoder->callback(event, decoder->userData);
+    }
+}
+
+
+/*
+ * Decode the bytes following the format ID of the pending message, and
+ * deliver it
+ */
+static void ariesLTSSMDecoderComplete(
+        AriesLTSSMDecoderType* decoder)
+{
+    AriesLTSSMEventType* event = &decoder->pending;
+    const uint8_t* bytes = decoder->pendingBytes;
+    uint8_t linkPath;
+    int varIndex;
+
+    event->linkId = -1;
+    event->pathId = -1;
+    if (event->logType == ARIES_LTSSM_LINK_LOGGER)
+    {
+        linkPath = *bytes++;
+        if (linkPath != ARIES_LTSSM_NO_LINK_PATH)
+        {
+            event->linkId = (linkPath >> 4) & 0x0f;
+            if ((linkPath & 0x0f) != 0x0f)
+            {
+                event->pathId = linkPath & 0x0f;
+            }
+        }
+    }
+
+    for (varIndex = 0; varIndex < event->numVars; varIndex++)
+    {
+        event->vars[varIndex] = (bytes[0] << 8) | bytes[1];
+        bytes += 2;
+    }
+
+    event->hasTime = ariesLTSSMFmtHasTime(event->fmt) &&
+        (event->numVars > 0);
+    if (event->hasTime)
+    {
+        event->timeMs = event->vars[0] * ARIES_LTSSM_TIME_UNIT_MS;
+    }
+
+    ariesLTSSMDecoderEmit(decoder, event);
+}
+
+
+/*
+ * Feed log entries to a decoder
+ */
+AriesErrorType ariesLTSSMDecoderFeed(
+        AriesLTSSMDecoderType* decoder,
+        const AriesLTSSMEntryType* entries,
+        int numEntries)
+{
+    AriesLTSSMEventType* event;
+    const AriesLTSSMFmtType* fmt;
+    int entryIndex;
+    bool mainMicro;
+
+    if ((decoder == NULL) || ((entries == NULL) && (numEntries != 0)) ||
+        (numEntries < 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    event = &decoder->pending;
+    for (entryIndex = 0; entryIndex < numEntries; entryIndex++)
+    {
+        if (decoder->stalled)
+        {
+            break;
+        }
+
+        // Link/path byte or variable byte of the pending message
+        if (decoder->numPendingBytes >= 0)
+        {
+            decoder->pendingBytes[decoder->numPendingBytes++] =
+                entries[entryIndex].data;
+            if (decoder->numPendingBytes == decoder->numMessageBytes)
+            {
+                decoder->numPendingBytes = -1;
+                ariesLTSSMDecoderComplete(decoder);
+            }
+            continue;
+        }
+
+        // Format ID of the next message. Zero is an unused byte
+        if (entries[entryIndex].data == 0)
+        {
+            continue;
+        }
+
+        memset(event, 0, sizeof(AriesLTSSMEventType));
+        event->logType = entries[entryIndex].logType;
+        event->offset = entries[entryIndex].offset;
+        event->fmtID = entries[entryIndex].data;
+        event->linkId = -1;
+        event->pathId = -1;
+
+        mainMicro = (event->logType == ARIES_LTSSM_LINK_LOGGER);
+        fmt = mainMicro ? decoder->mmFmts[event->fmtID] :
+            decoder->pmFmts[event->fmtID];
+        if (fmt == NULL)
+        {
+            event->kind = ARIES_LTSSM_EVENT_UNKNOWN;
+            decoder->numUnknown++;
+            decoder->stalled = true;
+            ariesLTSSMDecoderEmit(decoder, event);
+            continue;
+        }
+
+        event->kind = fmt->kind;
+        event->numVars = ariesLTSSMFmtNumVars(fmt);
+        event->fmt = fmt;
+        decoder->numMessageBytes = (2 * event->numVars) + (mainMicro ? 1 : 0);
+        if (decoder->numMessageBytes == 0)
+        {
+            ariesLTSSMDecoderComplete(decoder);
+        }
+        else
+        {
+            decoder->numPendingBytes = 0;
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Frame log entries from start as messages of known formats, without
+ * decoding them. Return the index of the first entry not framed, and count
+ * the format ID positions in marks (if not NULL)
+ */
+static int ariesLTSSMDecoderFrame(
+        AriesLTSSMDecoderType* decoder,
+        const AriesLTSSMEntryType* entries,
+        int numEntries,
+        int start,
+        uint8_t* marks)
+{
+    const AriesLTSSMFmtType* fmt;
+    int entryIndex = start;
+    bool mainMicro;
+
+    while (entryIndex < numEntries)
+    {
+        if (entries[entryIndex].data == 0)
+        {
+            entryIndex++;
+            continue;
+        }
+
+        mainMicro = (entries[entryIndex].logType == ARIES_LTSSM_LINK_LOGGER);
+        fmt = mainMicro ? decoder->mmFmts[entries[entryIndex].data] :
+            decoder->pmFmts[entries[entryIndex].data];
+        if (fmt == NULL)
+        {
+            break;
+        }
+        if (marks != NULL)
+        {
+            marks[entryIndex]++;
+        }
+        entryIndex += 1 + (2 * ariesLTSSMFmtNumVars(fmt)) +
+            (mainMicro ? 1 : 0);
+    }
+
+    if (entryIndex > numEntries)
+    {
+        entryIndex = numEntries;
+    }
+
+    return entryIndex;
+}
+
+
+/*
+ * Find the first message boundary of log entries which start at an unknown
+ * position, e.g. the oldest byte of a wrapped print buffer. The true
+ * boundary is within the length of the longest message from the start, and
+ * of the starts there, those framing the most entries as messages of known
+ * formats are candidates. Bytes of a partly overwritten message may frame
+ * as a message by chance, so the first boundary all candidates agree on is
+ * taken, not the first candidate. The framing of the decoder is reset
+ */
+static int ariesLTSSMDecoderSync(
+        AriesLTSSMDecoderType* decoder,
+        const AriesLTSSMEntryType* entries,
+        int numEntries)
+{
+    uint8_t marks[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    int reach[ARIES_LTSSM_MSG_MAX_BYTES];
+    int numStarts;
+    int start;
+    int firstStart = -1;
+    int maxReach = -1;
+    int numCandidates = 0;
+    int entryIndex;
+
+    ariesLTSSMDecoderReset(decoder);
+
+    numStarts = (numEntries < ARIES_LTSSM_MSG_MAX_BYTES) ? numEntries :
+        ARIES_LTSSM_MSG_MAX_BYTES;
+    for (start = 0; start < numStarts; start++)
+    {
+        reach[start] = ariesLTSSMDecoderFrame(decoder, entries, numEntries,
+            start, NULL);
+        if (reach[start] > maxReach)
+        {
+            maxReach = reach[start];
+            firstStart = start;
+        }
+    }
+    if ((firstStart < 0) ||
+        (numEntries > ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE))
+    {
+        return (firstStart < 0) ? 0 : firstStart;
+    }
+
+    memset(marks, 0, numEntries);
+    for (start = 0; start < numStarts; start++)
+    {
+        if (reach[start] == maxReach)
+        {
+            ariesLTSSMDecoderFrame(decoder, entries, numEntries, start,
+                marks);
+            numCandidates++;
+        }
+    }
+    for (entryIndex = 0; entryIndex < numEntries; entryIndex++)
+    {
+        if (marks[entryIndex] == numCandidates)
+        {
+            return entryIndex;
+        }
+    }
+
+    return firstStart;
+}
+
+
+/*
+ * Read a log of a link and decode it
+ */
+AriesErrorType ariesLTSSMDecodeLog(
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType log,
+        AriesLTSSMDecoderType* decoder)
+{
+    AriesLTSSMEntryType entries[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    AriesErrorType rc;
+    int numEntries;
+    int start = 0;
+    bool complete;
+    bool atBoundary;
+
+    rc = ariesLTSSMDecoderReset(decoder);
+    CHECK_SUCCESS(rc);
+
+    rc = ariesReadLog(link, log, entries, &numEntries, &complete,
+        &atBoundary);
+    CHECK_SUCCESS(rc);
+
+    // A wrapped log starts at its oldest byte, usually within a message
+    if (!atBoundary)
+    {
+        start = ariesLTSSMDecoderSync(decoder, entries, numEntries);
+    }
+    rc = ariesLTSSMDecoderFeed(decoder, &entries[start],
+        (numEntries - start));
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Format the message of an event
+ */
+AriesErrorType ariesLTSSMEventFormat(
+        const AriesLTSSMEventType* event,
+        char* buf,
+        size_t size)
+{
+    const char* text;
+    size_t len = 0;
+    int varIndex = 0;
+    int n;
+    char conv;
+
+    if ((event == NULL) || (buf == NULL) || (size == 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    if (event->kind == ARIES_LTSSM_EVENT_OVERRUN)
+    {
+        snprintf(buf, size, "Log overrun, bytes lost");
+        return ARIES_SUCCESS;
+    }
+
+    if (event->fmt == NULL)
+    {
+        snprintf(buf, size, "Unknown format ID 0x%02x", event->fmtID);
+        return ARIES_SUCCESS;
+    }
+
+    text = event->fmt->text;
+    while ((*text != '\0') && (len < (size - 1)))
+    {
+        if (text[0] != '%')
+        {
+            buf[len++] = *text++;
+            continue;
+        }
+
+        // Every % is a variable, as in the framing
+        conv = text[1];
+        text += (conv != '\0') ? 2 : 1;
+        if (varIndex >= event->numVars)
+        {
+            buf[len++] = '?';
+            continue;
+        }
+
+        if ((varIndex == 0) && event->hasTime && (conv == 'x') &&
+            (strncmp(text, " ms", 3) == 0))
+        {
+            n = snprintf(&buf[len], (size - len), "%6.1f", event->timeMs);
+        }
+        else if ((conv == 'd') || (conv == 'u'))
+        {
+            n = snprintf(&buf[len], (size - len), "%u",
+                event->vars[varIndex]);
+        }
+        else
+        {
+            n = snprintf(&buf[len], (size - len), "%04x",
+                event->vars[varIndex]);
+        }
+        varIndex++;
+        if (n < 0)
+        {
+            break;
+        }
+        len += n;
+        if (len >= size)
+        {
+            len = size - 1;
+        }
+    }
+    buf[len] = '\0';
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Parse the kind of a format table line
+ */
+static AriesErrorType ariesLTSSMFmtParseKind(
+        const char* name,
+        AriesLTSSMEventKindType* kind)
+{
+    if (strcmp(name, "msg") == 0)
+    {
+        *kind = ARIES_LTSSM_EVENT_MESSAGE;
+    }
+    else if (strcmp(name, "state") == 0)
+    {
+        *kind = ARIES_LTSSM_EVENT_STATE;
+    }
+    else if (strcmp(name, "eq") == 0)
+    {
+        *kind = ARIES_LTSSM_EVENT_EQ_PHASE;
+    }
+    else if (strcmp(name, "rate") == 0)
+    {
+        *kind = ARIES_LTSSM_EVENT_RATE;
+    }
+    else
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Strip leading and trailing whitespace of a line in place
+ */
+static char* ariesLTSSMFmtStrip(
+        char* line)
+{
+    char* end;
+
+    end = line + strlen(line);
+    while ((end > line) && isspace((unsigned char) end[-1]))
+    {
+        *--end = '\0';
+    }
+    while (isspace((unsigned char) *line))
+    {
+        line++;
+    }
+
+    return line;
+}
+
+
+/*
+ * Add a format to a format table being loaded
+ */
+static AriesErrorType ariesLTSSMFmtTableAdd(
+        const char* filename,
+        int lineNum,
+        unsigned int fmtID,
+        AriesLTSSMEventKindType kind,
+        const char* text,
+        size_t textLen,
+        bool* seen,
+        AriesLTSSMFmtType* fmts,
+        int maxFmts,
+        int* numFmts)
+{
+    AriesLTSSMFmtType* fmt;
+
+    if ((fmtID == 0) || (fmtID >= ARIES_LTSSM_NUM_FMT_IDS) || seen[fmtID] ||
+        (textLen >= ARIES_LTSSM_FMT_TEXT_LEN))
+    {
+        ASTERA_ERROR("%s:%d: invalid logger format", filename, lineNum);
+        return ARIES_INVALID_ARGUMENT;
+    }
+    if (*numFmts >= maxFmts)
+    {
+        ASTERA_ERROR("%s: more than %d logger formats", filename, maxFmts);
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    fmt = &fmts[*numFmts];
+    fmt->fmtID = fmtID;
+    fmt->kind = kind;
+    memcpy(fmt->text, text, textLen);
+    fmt->text[textLen] = '\0';
+    if (ariesLTSSMFmtNumVars(fmt) > ARIES_LTSSM_FMT_MAX_VARS)
+    {
+        ASTERA_ERROR("%s:%d: more than %d logger format variables", filename,
+            lineNum, ARIES_LTSSM_FMT_MAX_VARS);
+        return ARIES_INVALID_ARGUMENT;
+    }
+    seen[fmtID] = true;
+    (*numFmts)++;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Load a format table from a text file
+ */
+AriesErrorType ariesLTSSMFmtTableLoad(
+        const char* filename,
+        AriesLTSSMFmtType* fmts,
+        int maxFmts,
+        int* numFmts)
+{
+    char line[256];
+    char kindName[16];
+    unsigned int fmtID;
+    AriesLTSSMEventKindType kind;
+    bool seen[ARIES_LTSSM_NUM_FMT_IDS] = {false};
+    AriesErrorType rc;
+    FILE* fp;
+    char* text;
+    int lineNum = 0;
+    int pos;
+
+    if ((filename == NULL) || (fmts == NULL) || (numFmts == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+    *numFmts = 0;
+
+    fp = fopen(filename, "r");
+    if (fp == NULL)
+    {
+        ASTERA_ERROR("Could not open logger format table %s", filename);
+        return ARIES_FAILURE;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        lineNum++;
+
+        // Skip empty lines and comments
+        text = ariesLTSSMFmtStrip(line);
+        if ((*text == '\0') || (*text == '#'))
+        {
+            continue;
+        }
+
+        pos = 0;
+        if ((sscanf(text, "%i %15s %n", &fmtID, kindName, &pos) < 2) ||
+            (ariesLTSSMFmtParseKind(kindName, &kind) != ARIES_SUCCESS))
+        {
+            ASTERA_ERROR("%s:%d: invalid logger format", filename, lineNum);
+            fclose(fp);
+            return ARIES_INVALID_ARGUMENT;
+        }
+        text += pos;
+
+        rc = ariesLTSSMFmtTableAdd(filename, lineNum, fmtID, kind, text,
+            strlen(text), seen, fmts, maxFmts, numFmts);
+        if (rc != ARIES_SUCCESS)
+        {
+            fclose(fp);
+            return rc;
+        }
+    }
+
+    fclose(fp);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the kind of a format of the FW format dictionaries from its text.
+ * State machine transitions are logged as "%x ms: <state name>"
+ */
+static AriesLTSSMEventKindType ariesLTSSMFmtClassify(
+        const char* text)
+{
+    const char* name;
+
+    if (strncmp(text, "%x ms: ", 7) == 0)
+    {
+        name = text + 7;
+        if ((strncmp(name, "LSM_LNK_STATE_", 14) == 0) ||
+            (strncmp(name, "LSM_LNK_PTH_STATE_", 18) == 0) ||
+            (strncmp(name, "PSM_", 4) == 0))
+        {
+            if (strstr(name, "_EQ_P") != NULL)
+            {
+                return ARIES_LTSSM_EVENT_EQ_PHASE;
+            }
+            if ((strstr(name, "RATE_CH") != NULL))
+            {
+                return ARIES_LTSSM_EVENT_RATE;
+            }
+            return ARIES_LTSSM_EVENT_STATE;
+        }
+    }
+    if (strncmp(text, "Next data rate", 14) == 0)
+    {
+        return ARIES_LTSSM_EVENT_RATE;
+    }
+
+    return ARIES_LTSSM_EVENT_MESSAGE;
+}
+
+
+/*
+ * Load a format table from a FW format dictionary
+ */
+AriesErrorType ariesLTSSMFmtTableLoadDict(
+        const char* filename,
+        AriesLTSSMFmtType* fmts,
+        int maxFmts,
+        int* numFmts,
+        AriesFWVersionType* fwVersion)
+{
+    char line[256];
+    char textBuf[ARIES_LTSSM_FMT_TEXT_LEN];
+    unsigned int fmtID;
+    unsigned int value;
+    bool seen[ARIES_LTSSM_NUM_FMT_IDS] = {false};
+    AriesErrorType rc;
+    FILE* fp;
+    char* text;
+    char* entry;
+    char* textEnd;
+    size_t textLen;
+    int lineNum = 0;
+    int pos;
+
+    if ((filename == NULL) || (fmts == NULL) || (numFmts == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+    *numFmts = 0;
+    if (fwVersion != NULL)
+    {
+        memset(fwVersion, 0, sizeof(AriesFWVersionType));
+    }
+
+    fp = fopen(filename, "r");
+    if (fp == NULL)
+    {
+        ASTERA_ERROR("Could not open logger format dictionary %s", filename);
+        return ARIES_FAILURE;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        lineNum++;
+
+        // Only "<micro>_fmt_id_dict[fmtID] = "text"" and FW version lines
+        // matter; comments and other Python statements are ignored
+        text = ariesLTSSMFmtStrip(line);
+        if ((*text == '\0') || (*text == '#'))
+        {
+            continue;
+        }
+
+        if ((fwVersion != NULL) &&
+            (sscanf(text, "%*[a-z]_fmt_id_dict_fw_version_major = %u",
+                &value) == 1))
+        {
+            fwVersion->major = value;
+            continue;
+        }
+        if ((fwVersion != NULL) &&
+            (sscanf(text, "%*[a-z]_fmt_id_dict_fw_version_minor = %u",
+                &value) == 1))
+        {
+            fwVersion->minor = value;
+            continue;
+        }
+        if ((fwVersion != NULL) &&
+            (sscanf(text, "%*[a-z]_fmt_id_dict_fw_build_number = %u",
+                &value) == 1))
+        {
+            fwVersion->build = value;
+            continue;
+        }
+
+        entry = strstr(text, "_fmt_id_dict[");
+        if (entry == NULL)
+        {
+            continue;
+        }
+        pos = 0;
+        if ((sscanf(entry, "_fmt_id_dict[%u] = \"%n", &fmtID, &pos) < 1) ||
+            (pos == 0))
+        {
+            continue;
+        }
+        text = entry + pos;
+        textEnd = strrchr(text, '"');
+        if (textEnd == NULL)
+        {
+            ASTERA_ERROR("%s:%d: invalid logger format", filename, lineNum);
+            fclose(fp);
+            return ARIES_INVALID_ARGUMENT;
+        }
+        textLen = textEnd - text;
+        if (textLen >= sizeof(textBuf))
+        {
+            ASTERA_ERROR("%s:%d: logger format text too long", filename,
+                lineNum);
+            fclose(fp);
+            return ARIES_INVALID_ARGUMENT;
+        }
+        memcpy(textBuf, text, textLen);
+        textBuf[textLen] = '\0';
+
+        rc = ariesLTSSMFmtTableAdd(filename, lineNum, fmtID,
+            ariesLTSSMFmtClassify(textBuf), textBuf, textLen, seen, fmts,
+            maxFmts, numFmts);
+        if (rc != ARIES_SUCCESS)
+        {
+            fclose(fp);
+            return rc;
+        }
+    }
+
+    fclose(fp);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Initialize a tail of an LTSSM log
+ */
+AriesErrorType ariesLTSSMTailInit(
+        AriesLTSSMTailType* tail,
+        AriesLinkType* link,
+        AriesLTSSMLoggerEnumType log)
+{
+    if ((tail == NULL) || (link == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(tail, 0, sizeof(AriesLTSSMTailType));
+    tail->link = link;
+    tail->log = log;
+
+    // Buffer size different for main and path micros
+    if (log == ARIES_LTSSM_LINK_LOGGER)
+    {
+        tail->bufferSize = ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE;
+    }
+    else
+    {
+        tail->bufferSize = ARIES_PM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Read the write offset of a log until two consecutive reads agree. The
+ * offset is read a byte at a time, so while the micro is printing a single
+ * read can combine the bytes of two different offsets
+ */
+static AriesErrorType ariesLTSSMTailReadWriteOffset(
+        AriesLTSSMTailType* tail,
+        int* writeOffset)
+{
+    int prevWriteOffset;
+    int tryIndex;
+    AriesErrorType rc;
+
+    rc = ariesGetLoggerWriteOffset(tail->link, tail->log, &prevWriteOffset);
+    CHECK_SUCCESS(rc);
+
+    for (tryIndex = 0; tryIndex < ARIES_LTSSM_TAIL_OFFSET_READ_TRIES;
+        tryIndex++)
+    {
+        rc = ariesGetLoggerWriteOffset(tail->link, tail->log, writeOffset);
+        CHECK_SUCCESS(rc);
+        if (*writeOffset == prevWriteOffset)
+        {
+            return ARIES_SUCCESS;
+        }
+        prevWriteOffset = *writeOffset;
+    }
+
+    ASTERA_ERROR("Logger %d write offset not stable", tail->log);
+    return ARIES_FUNCTION_UNSUCCESSFUL;
+}
+
+
+/*
+ * Read numBytes bytes of a log starting at offset, wrapping around at the
+ * end of the print buffer
+ */
+static AriesErrorType ariesLTSSMTailReadRange(
+        AriesLTSSMTailType* tail,
+        int offset,
+        int numBytes,
+        uint8_t* values)
+{
+    int numFirst;
+    AriesErrorType rc;
+
+    numFirst = tail->bufferSize - offset;
+    if (numFirst > numBytes)
+    {
+        numFirst = numBytes;
+    }
+
+    if (numFirst > 0)
+    {
+        rc = ariesLTSSMLoggerReadBuffer(tail->link, tail->log, offset,
+            numFirst, values);
+        CHECK_SUCCESS(rc);
+    }
+    if (numBytes > numFirst)
+    {
+        rc = ariesLTSSMLoggerReadBuffer(tail->link, tail->log, 0,
+            (numBytes - numFirst), (values + numFirst));
+        CHECK_SUCCESS(rc);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Return the bytes read by a poll and advance the tail. values holds
+ * numGuard bytes already consumed followed by numNew new bytes, starting at
+ * startOffset. The first numClobbered bytes were overwritten during the read
+ */
+static void ariesLTSSMTailConsume(
+        AriesLTSSMTailType* tail,
+        const uint8_t* values,
+        int startOffset,
+        int numGuard,
+        int numNew,
+        int numClobbered,
+        int writeOffset,
+        AriesLTSSMEntryType* entries,
+        int* numEntries)
+{
+    int numValid;
+    int index;
+
+    *numEntries = 0;
+    for (index = numClobbered - numGuard; index < numNew; index++)
+    {
+        if (index < 0)
+        {
+            continue;
+        }
+        entries[*numEntries].logType = tail->log;
+        entries[*numEntries].data = values[numGuard + index];
+        entries[*numEntries].offset =
+            (startOffset + numGuard + index) % tail->bufferSize;
+        (*numEntries)++;
+    }
+
+    // Keep the last bytes consumed, to be checked by the next poll
+    numValid = numGuard + numNew - ((numClobbered > 0) ? numClobbered : 0);
+    if (numValid > ARIES_LTSSM_TAIL_GUARD_BYTES)
+    {
+        numValid = ARIES_LTSSM_TAIL_GUARD_BYTES;
+    }
+    if (numValid < 0)
+    {
+        numValid = 0;
+    }
+    memcpy(tail->guard, (values + numGuard + numNew - numValid), numValid);
+    tail->numGuard = numValid;
+
+    tail->writeOffset = writeOffset;
+    tail->numBytes += *numEntries;
+    tail->synced = true;
+}
+
+
+/*
+ * Poll a wrap-around log. The bytes between the consumed and the current
+ * write offsets are new. If the writer lapped the tail, the bytes before
+ * the consumed write offset changed and the whole buffer is read again
+ */
+static AriesErrorType ariesLTSSMTailPollWrap(
+        AriesLTSSMTailType* tail,
+        bool resync,
+        AriesLTSSMEntryType* entries,
+        int* numEntries,
+        bool* overrun)
+{
+    uint8_t values[ARIES_LTSSM_TAIL_GUARD_BYTES +
+        ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    int startOffset = 0;
+    int writeOffset;
+    int afterOffset;
+    int numGuard = 0;
+    int numNew = 0;
+    int numClobbered;
+    AriesErrorType rc;
+
+    rc = ariesLTSSMTailReadWriteOffset(tail, &writeOffset);
+    CHECK_SUCCESS(rc);
+    if ((writeOffset < 0) || (writeOffset >= tail->bufferSize))
+    {
+        ASTERA_ERROR("Invalid logger %d write offset %d", tail->log,
+            writeOffset);
+        return ARIES_LTSSM_INVALID_ENTRY;
+    }
+
+    if (!resync)
+    {
+        numNew = (writeOffset - tail->writeOffset + tail->bufferSize) %
+            tail->bufferSize;
+        numGuard = tail->numGuard;
+        if (numGuard > (tail->bufferSize - numNew))
+        {
+            numGuard = tail->bufferSize - numNew;
+        }
+        startOffset = (tail->writeOffset - numGuard + tail->bufferSize) %
+            tail->bufferSize;
+
+        rc = ariesLTSSMTailReadRange(tail, startOffset, (numGuard + numNew),
+            values);
+        CHECK_SUCCESS(rc);
+
+        if (memcmp(values, &tail->guard[tail->numGuard - numGuard],
+            numGuard) != 0)
+        {
+            *overrun = true;
+            resync = true;
+        }
+    }
+
+    if (resync)
+    {
+        // Whole buffer, oldest byte at the write offset
+        startOffset = writeOffset;
+        numGuard = 0;
+        numNew = tail->bufferSize;
+        rc = ariesLTSSMTailReadRange(tail, startOffset, numNew, values);
+        CHECK_SUCCESS(rc);
+
+        // A buffer which has not wrapped yet starts at offset 0, at a
+        // message boundary
+        if (ariesLogUnused(values, (tail->bufferSize - writeOffset)))
+        {
+            memmove(values, &values[tail->bufferSize - writeOffset],
+                writeOffset);
+            startOffset = 0;
+            numNew = writeOffset;
+            tail->atBoundary = true;
+        }
+    }
+
+    // Bytes printed during the read first overwrite the free part of the
+    // buffer, then the oldest bytes read
+    rc = ariesLTSSMTailReadWriteOffset(tail, &afterOffset);
+    CHECK_SUCCESS(rc);
+    if ((afterOffset < 0) || (afterOffset >= tail->bufferSize))
+    {
+        ASTERA_ERROR("Invalid logger %d write offset %d", tail->log,
+            afterOffset);
+        return ARIES_LTSSM_INVALID_ENTRY;
+    }
+    numClobbered = ((afterOffset - writeOffset + tail->bufferSize) %
+        tail->bufferSize) - (tail->bufferSize - numGuard - numNew);
+    if ((numClobbered > numGuard) && tail->synced)
+    {
+        *overrun = true;
+    }
+    if (numClobbered > 0)
+    {
+        tail->atBoundary = false;
+    }
+
+    ariesLTSSMTailConsume(tail, values, startOffset, numGuard, numNew,
+        numClobbered, writeOffset, entries, numEntries);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Poll a one batch mode log. The batch fills the buffer from its start, so
+ * the bytes between the consumed and the current write offsets are new. A
+ * write offset behind the consumed one means the batch was re-armed
+ */
+static AriesErrorType ariesLTSSMTailPollBatch(
+        AriesLTSSMTailType* tail,
+        bool resync,
+        AriesLTSSMEntryType* entries,
+        int* numEntries,
+        bool* overrun)
+{
+    uint8_t values[ARIES_LTSSM_TAIL_GUARD_BYTES +
+        ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    int oneBatchWrEn;
+    int startOffset = 0;
+    int writeOffset;
+    int afterOffset;
+    int numGuard = 0;
+    int numNew = 0;
+    int numClobbered = 0;
+    AriesErrorType rc;
+
+    rc = ariesGetLoggerOneBatchWrEn(tail->link, tail->log, &oneBatchWrEn);
+    CHECK_SUCCESS(rc);
+
+    // A complete batch fills the buffer. A batch in progress is valid up to
+    // the current write offset
+    writeOffset = tail->bufferSize;
+    if (oneBatchWrEn != 0)
+    {
+        rc = ariesLTSSMTailReadWriteOffset(tail, &writeOffset);
+        CHECK_SUCCESS(rc);
+        if ((writeOffset < 0) || (writeOffset > tail->bufferSize))
+        {
+            writeOffset = tail->bufferSize;
+        }
+    }
+
+    if (!resync && (writeOffset < tail->writeOffset))
+    {
+        *overrun = true;
+        resync = true;
+    }
+
+    if (!resync)
+    {
+        numNew = writeOffset - tail->writeOffset;
+        numGuard = tail->numGuard;
+        if (numGuard > tail->writeOffset)
+        {
+            numGuard = tail->writeOffset;
+        }
+        startOffset = tail->writeOffset - numGuard;
+
+        rc = ariesLTSSMTailReadRange(tail, startOffset, (numGuard + numNew),
+            values);
+        CHECK_SUCCESS(rc);
+
+        if (memcmp(values, &tail->guard[tail->numGuard - numGuard],
+            numGuard) != 0)
+        {
+            *overrun = true;
+            resync = true;
+        }
+    }
+
+    if (resync)
+    {
+        startOffset = 0;
+        numGuard = 0;
+        numNew = writeOffset;
+        rc = ariesLTSSMTailReadRange(tail, startOffset, numNew, values);
+        CHECK_SUCCESS(rc);
+        tail->atBoundary = true;
+    }
+
+    // A batch re-armed during the read may have overwritten any byte read.
+    // Drop them all and start over with the new batch
+    if (oneBatchWrEn != 0)
+    {
+        rc = ariesLTSSMTailReadWriteOffset(tail, &afterOffset);
+        CHECK_SUCCESS(rc);
+        if ((afterOffset >= 0) && (afterOffset < writeOffset))
+        {
+            numClobbered = numGuard + numNew;
+            writeOffset = 0;
+            tail->atBoundary = false;
+            if (tail->synced)
+            {
+                *overrun = true;
+            }
+        }
+    }
+
+    ariesLTSSMTailConsume(tail, values, startOffset, numGuard, numNew,
+        numClobbered, writeOffset, entries, numEntries);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Read the log bytes appended since the last poll
+ */
+AriesErrorType ariesLTSSMTailPoll(
+        AriesLTSSMTailType* tail,
+        AriesLTSSMEntryType* entries,
+        int* numEntries,
+        bool* overrun)
+{
+    int oneBatchModeEn;
+    bool resync;
+    AriesErrorType rc;
+
+    if ((tail == NULL) || (tail->link == NULL) || (entries == NULL) ||
+        (numEntries == NULL) || (overrun == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    *numEntries = 0;
+    *overrun = false;
+    tail->atBoundary = false;
+
+    rc = ariesGetLoggerOneBatchModeEn(tail->link, tail->log,
+        &oneBatchModeEn);
+    CHECK_SUCCESS(rc);
+
+    // A change of logger mode restarts the log
+    resync = !tail->synced;
+    if (tail->synced && ((oneBatchModeEn != 0) != tail->oneBatchMode))
+    {
+        *overrun = true;
+        resync = true;
+    }
+    tail->oneBatchMode = (oneBatchModeEn != 0);
+
+    if (tail->oneBatchMode)
+    {
+        rc = ariesLTSSMTailPollBatch(tail, resync, entries, numEntries,
+            overrun);
+    }
+    else
+    {
+        rc = ariesLTSSMTailPollWrap(tail, resync, entries, numEntries,
+            overrun);
+    }
+    CHECK_SUCCESS(rc);
+
+    if (*overrun)
+    {
+        tail->numOverruns++;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Poll a log tail and feed the new bytes to a decoder
+ */
+AriesErrorType ariesLTSSMTailDecode(
+        AriesLTSSMTailType* tail,
+        AriesLTSSMDecoderType* decoder)
+{
+    AriesLTSSMEntryType entries[ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE];
+    AriesLTSSMEventType event;
+    AriesErrorType rc;
+    int numEntries;
+    int start = 0;
+    bool overrun;
+    bool resync;
+
+    if ((decoder == NULL) || (tail == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // The first poll returns the whole log. A stalled decoder lost the
+    // framing, so it restarts with the new bytes
+    resync = !tail->synced || decoder->stalled;
+
+    rc = ariesLTSSMTailPoll(tail, entries, &numEntries, &overrun);
+    CHECK_SUCCESS(rc);
+
+    // Bytes lost: a partly read message cannot be completed
+    if (overrun)
+    {
+        rc = ariesLTSSMDecoderReset(decoder);
+        CHECK_SUCCESS(rc);
+        resync = true;
+
+        memset(&event, 0, sizeof(AriesLTSSMEventType));
+        event.logType = tail->log;
+        event.offset = (numEntries > 0) ? entries[0].offset :
+            tail->writeOffset;
+        event.kind = ARIES_LTSSM_EVENT_OVERRUN;
+        event.linkId = -1;
+        event.pathId = -1;
+        ariesLTSSMDecoderEmit(decoder, &event);
+    }
+
+    // The bytes returned after a resync start at the start of the log, or
+    // at an unknown position, usually within a message. Skip to the first
+    // message boundary in the latter case
+    if (tail->atBoundary)
+    {
+        rc = ariesLTSSMDecoderReset(decoder);
+        CHECK_SUCCESS(rc);
+    }
+    else if (resync && (numEntries > 0))
+    {
+        start = ariesLTSSMDecoderSync(decoder, entries, numEntries);
+    }
+
+    rc = ariesLTSSMDecoderFeed(decoder, &entries[start],
+        (numEntries - start));
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
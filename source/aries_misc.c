@@ -20,10 +20,50 @@
 
 #include "../include/aries_misc.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// SMBus PEC (CRC-8, polynomial x^8 + x^2 + x + 1) of each byte value
+static const uint8_t ariesCrc8Table[256] = {
+    0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+    0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+    0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65,
+    0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
+    0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5,
+    0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
+    0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85,
+    0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
+    0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2,
+    0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
+    0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2,
+    0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
+    0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32,
+    0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
+    0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42,
+    0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
+    0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c,
+    0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
+    0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec,
+    0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
+    0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c,
+    0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
+    0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c,
+    0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
+    0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b,
+    0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
+    0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b,
+    0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
+    0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb,
+    0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
+    0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb,
+    0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3,
+};
+
 AriesBifurcationParamsType bifurcationModes[36] = {
     /** Links in bifurcation string read right to left */
     /** Bifurcation properties for x16 */
@@ -512,6 +552,61 @@ AriesErrorType ariesI2CMasterRewriteAndVerifyByte(
 }
 
 
+/*
+ * Read back an EEPROM byte to check if a write has completed. The EEPROM does
+ * not acknowledge its address during a write cycle, so the I2C Master data
+ * register keeps a sentinel value (the complement of the expected byte)
+ * until the EEPROM is ready again. A NACK aborts the transfer, and the I2C
+ * Master flushes its TX FIFO until the abort is cleared. The CSR interface
+ * can only write the I2C Master registers, so the abort is cleared by
+ * disabling the I2C Master, as ariesI2CMasterSetPage() does.
+ */
+AriesErrorType ariesI2CMasterPollByte(
+        AriesI2CDriverType* i2cDriver,
+        int address,
+        uint8_t expected,
+        bool* match)
+{
+    AriesErrorType rc;
+    uint8_t dataByte[1];
+
+    rc = ariesI2CMasterSendAddress(i2cDriver, address);
+    CHECK_SUCCESS(rc);
+
+    // Read byte over the sentinel value
+    dataByte[0] = ~expected;
+    rc = ariesWriteByteData(i2cDriver, ARIES_I2C_MST_DATA0_ADDR, dataByte);
+    CHECK_SUCCESS(rc);
+    dataByte[0] = 0x3;
+    rc = ariesWriteByteData(i2cDriver, ARIES_I2C_MST_DATA1_ADDR, dataByte);
+    CHECK_SUCCESS(rc);
+    dataByte[0] = 0x1;
+    rc = ariesWriteByteData(i2cDriver, ARIES_I2C_MST_CMD_ADDR, dataByte);
+    CHECK_SUCCESS(rc);
+    usleep(ARIES_EEPROM_PAGE_PROGRAM_POLL_USEC);
+    dataByte[0] = 0x0;
+    rc = ariesWriteByteData(i2cDriver, ARIES_I2C_MST_CMD_ADDR, dataByte);
+    CHECK_SUCCESS(rc);
+    rc = ariesReadByteData(i2cDriver, ARIES_I2C_MST_DATA0_ADDR, dataByte);
+    CHECK_SUCCESS(rc);
+
+    *match = (dataByte[0] == expected);
+
+    // Clear the TX abort of a NACKed poll before the next transfer
+    if (!*match)
+    {
+        dataByte[0] = 0;
+        rc = ariesI2CMasterWriteCtrlReg(i2cDriver, 0x6c, 1, dataByte);
+        CHECK_SUCCESS(rc);
+        dataByte[0] = 1;
+        rc = ariesI2CMasterWriteCtrlReg(i2cDriver, 0x6c, 1, dataByte);
+        CHECK_SUCCESS(rc);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
 /*
  * Send eeprom address to the I2C Bus
  */
@@ -706,11 +801,14 @@ AriesErrorType ariesI2CMasterReceiveByteBlock(
 
 
 /*
- * Get checksum of current page (all bytes)
+ * Get checksum of current page, waiting waitSec seconds before polling the
+ * Main Micro for completion up to numTries times
  */
-AriesErrorType ariesI2CMasterGetChecksum(
+static AriesErrorType ariesI2CMasterGetChecksumWait(
         AriesDeviceType* device,
         uint16_t blockEnd,
+        int waitSec,
+        int numTries,
         uint32_t* checksum)
 {
     AriesErrorType rc;
@@ -719,7 +817,6 @@ AriesErrorType ariesI2CMasterGetChecksum(
     int try;
     uint8_t byteIdx;
     uint8_t dataByteIdx;
-    int numTries = 500;
     uint8_t commandCode;
 
     if (blockEnd != 0)
@@ -746,7 +843,10 @@ AriesErrorType ariesI2CMasterGetChecksum(
             dataByte);
     CHECK_SUCCESS(rc);
 
-    sleep(ARIES_MM_CALC_CHECKSUM_WAIT);
+    if (waitSec > 0)
+    {
+        sleep(waitSec);
+    }
 
     for (try = 0; try < numTries; try++)
     {
@@ -784,6 +884,32 @@ AriesErrorType ariesI2CMasterGetChecksum(
     return ARIES_SUCCESS;
 }
 
+
+/*
+ * Get checksum of current page (all bytes)
+ */
+AriesErrorType ariesI2CMasterGetChecksum(
+        AriesDeviceType* device,
+        uint16_t blockEnd,
+        uint32_t* checksum)
+{
+    return ariesI2CMasterGetChecksumWait(device, blockEnd,
+        ARIES_MM_CALC_CHECKSUM_WAIT, 500, checksum);
+}
+
+
+/*
+ * Get checksum of current page, polling for completion from the start
+ */
+AriesErrorType ariesI2CMasterGetChecksumPolled(
+        AriesDeviceType* device,
+        uint16_t blockEnd,
+        uint32_t* checksum)
+{
+    return ariesI2CMasterGetChecksumWait(device, blockEnd, 0,
+        ARIES_MM_CALC_CHECKSUM_POLL_TRIES, checksum);
+}
+
 /*
  * Receive a single byte from the I2C bus
  */
@@ -1256,6 +1382,8 @@ AriesErrorType ariesGetPortOrientation(
 
     // Oriention Val is bit 8
     *orientation = dataBytes[1] & (0x01);
+    device->cache.orientation = *orientation;
+    device->cache.orientationValid = true;
 
     return ARIES_SUCCESS;
 }
@@ -1279,6 +1407,8 @@ AriesErrorType ariesSetPortOrientation(
 
     rc = ariesWriteBlockData(device->i2cDriver, 0x10, 4, dataBytes);
     CHECK_SUCCESS(rc);
+    device->cache.orientation = orientation & 0x1;
+    device->cache.orientationValid = true;
 
     return ARIES_SUCCESS;
 }
@@ -1639,6 +1769,50 @@ AriesErrorType ariesGetTxPst(
     return ARIES_SUCCESS;
 }
 
+/*
+ * Get link TX pre, current and post cursor values
+ */
+AriesErrorType ariesGetTxCoeffs(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        int* txPre,
+        int* txCur,
+        int* txPst)
+{
+    uint8_t dataBytes[3];
+    AriesErrorType rc;
+    int tmpVal;
+
+    // Based on the lane info, determine QS and Path info
+    int qs;
+    int qsPath;
+    int qsPathLane;
+    ariesGetQSPathInfo(lane, direction, &qs, &qsPath, &qsPathLane);
+
+    // Compute reg address
+    // Calculate QS, Path, Path lane relative offsets first,
+    // and then compute actual address
+    int qsOff = ARIES_QS_0_CSR_OFFSET + (qs*ARIES_QS_STRIDE);
+    int pathOff = ARIES_PATH_WRAPPER_0_CSR_OFFSET +
+        (qsPath*ARIES_PATH_WRP_STRIDE);
+    int pathLaneOff = ARIES_PATH_LANE_0_CSR_OFFSET + (qsPathLane*ARIES_PATH_LANE_STRIDE);
+
+    // Compute Reg Offset
+    uint32_t address = qsOff + pathOff + pathLaneOff +
+        ARIES_MAC_PHY_TXDEEMPH_OB;
+
+    // Pre, current and post cursors are fields of the same register
+    rc = ariesReadBlockData(link->device->i2cDriver, address, 3, dataBytes);
+    CHECK_SUCCESS(rc);
+    tmpVal = (dataBytes[0] + (dataBytes[1] << 8) + (dataBytes[2] << 16));
+    *txPre = tmpVal & 0x3f;
+    *txCur = (tmpVal & 0xfc0) >> 6;
+    *txPst = (tmpVal & 0x3f000) >> 12;
+
+    return ARIES_SUCCESS;
+}
+
 /*
  * Get RX polarity code
  */
@@ -1853,226 +2027,446 @@ AriesErrorType ariesGetRxCtlePoleCode(
     return ARIES_SUCCESS;
 }
 
+// PMA DFE tap status regs, indexed by tap number - 1
+static const uint16_t ariesRxDfeTapStatusRegs[8] = {
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP1_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP2_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP3_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP4_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP5_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP6_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP7_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP8_STATUS,
+};
+
 /*
- * Get the current RX DFE code
+ * Decode the DFE code of a tap from its PMA status reg
  */
-AriesErrorType ariesGetRxDfeCode(
-        AriesLinkType* link,
-        int side,
-        int absLane,
+static int ariesDecodeRxDfeCode(
         int tapNum,
-        int* dfeCode)
+        uint8_t* dataWord)
 {
-    AriesErrorType rc;
-    int pmaNum = ariesGetPmaNumber(absLane);
-    int pmaLane = ariesGetPmaLane(absLane);
-    uint8_t dataWord[2];
-    int address;
     int tapVal;
 
     switch(tapNum)
     {
         case 1:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP1_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
             // Get Bits 13:0
             tapVal = (((dataWord[1] & 0x3f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal;
             if (tapVal >= 256)
             {
                 // dfe_tap1_code is stored in two's complement format
-                *dfeCode = tapVal - 512;
+                return tapVal - 512;
             }
-            break;
+            return tapVal;
 
         case 2:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP2_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
             // Get bits 12:0
             tapVal = (((dataWord[1] & 0x1f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 128;
-            break;
-
-        case 3:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP3_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
-            // Get bits 11:0
-            tapVal = (((dataWord[1] & 0x0f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 64;
-            break;
-
-        case 4:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP4_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
-            // Get bits 11:0
-            tapVal = (((dataWord[1] & 0x0f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 64;
-            break;
-
-        case 5:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP5_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
-            // Get bits 11:0
-            tapVal = (((dataWord[1] & 0x0f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 64;
-            break;
-
-        case 6:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP6_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
-            // Get bits 11:0
-            tapVal = (((dataWord[1] & 0x0f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 64;
-            break;
-
-        case 7:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP7_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
-            // Get bits 11:0
-            tapVal = (((dataWord[1] & 0x0f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 64;
-            break;
+            return tapVal - 128;
 
-        case 8:
-            // Get PMA Tap address from a util function
-            address = ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP8_STATUS;
-            rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
-                    pmaNum, pmaLane, address, dataWord);
-            CHECK_SUCCESS(rc);
+        default:
             // Get bits 11:0
             tapVal = (((dataWord[1] & 0x0f) << 8) + dataWord[0]) >> 5;
-            *dfeCode = tapVal - 64;
-            break;
-
-        default:
-            ASTERA_ERROR("Invalid DFE Tag");
-            return ARIES_INVALID_ARGUMENT;
-            break;
+            return tapVal - 64;
     }
-    return ARIES_SUCCESS;
 }
 
 /*
- * Get the last speed at which EQ was run (e.g. 3 for Gen-3)
+ * Get the current RX DFE code
  */
-AriesErrorType ariesGetLastEqSpeed(
+AriesErrorType ariesGetRxDfeCode(
         AriesLinkType* link,
-        int lane,
-        int direction,
-        int* speed)
+        int side,
+        int absLane,
+        int tapNum,
+        int* dfeCode)
 {
     AriesErrorType rc;
-    int pathID = ((lane/2)*2) + direction;
-    uint8_t dataByte[1];
+    int pmaNum = ariesGetPmaNumber(absLane);
+    int pmaLane = ariesGetPmaLane(absLane);
+    uint8_t dataWord[2];
 
-    // Reading gp_ctrl_sts_struct.last_eq_pcie_gen
-    int address = link->device->pm_gp_ctrl_sts_struct_addr +
-        ARIES_CTRL_STS_STRUCT_LAST_EQ_PCIE_GEN;
+    if ((tapNum < 1) || (tapNum > 8))
+    {
+        ASTERA_ERROR("Invalid DFE Tag");
+        return ARIES_INVALID_ARGUMENT;
+    }
 
-    rc = ariesReadByteDataPathMicroIndirect(link->device->i2cDriver, pathID,
-            address, dataByte);
+    rc = ariesReadWordPmaLaneMainMicroIndirect(link->device->i2cDriver, side,
+            pmaNum, pmaLane, ariesRxDfeTapStatusRegs[tapNum-1], dataWord);
     CHECK_SUCCESS(rc);
+    *dfeCode = ariesDecodeRxDfeCode(tapNum, dataWord);
 
-    *speed = dataByte[0];
     return ARIES_SUCCESS;
 }
 
+// Num PMA regs of ariesRxCaptureRegs, followed in the capture by
+// ARIES_NUM_DPLL_FREQ_READINGS reads of the DPLL code
+#define ARIES_RX_CAPTURE_NUM_REGS 14
+
+// PMA regs read per lane and side by the link RX capture, in schedule order
+static const uint16_t ariesRxCaptureRegs[ARIES_RX_CAPTURE_NUM_REGS] = {
+    ARIES_PMA_LANE_DIG_ASIC_RX_OVRD_IN_3,
+    ARIES_PMA_LANE_DIG_ASIC_RX_ASIC_IN_1,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_ATT_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_VGA_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_CTLE_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP1_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP2_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP3_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP4_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP5_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP6_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP7_STATUS,
+    ARIES_PMA_LANE_DIG_RX_ADPTCTL_DFE_TAP8_STATUS,
+    ARIES_PMA_RAWLANE_DIG_PCS_XF_RX_ADAPT_FOM,
+};
+
+// Index of first DFE tap status reg in ariesRxCaptureRegs
+#define ARIES_RX_CAPTURE_DFE_TAP1_IDX 5
+
+// Index of the FoM reg in ariesRxCaptureRegs
+#define ARIES_RX_CAPTURE_FOM_IDX 13
+
+// DFE tap code to mV, indexed by tap number - 1
+static const float ariesRxDfeTapMv[8] = {
+    1.85, 0.35, 0.7, 0.35, 0.35, 0.35, 0.35, 0.35
+};
+
 /*
- * Get the deskew status string for the given lane
+ * Decode captured PMA regs of one lane into its RX state
  */
-AriesErrorType ariesGetDeskewStatus(
-        AriesLinkType* link,
-        int lane,
-        int direction,
-        int* status)
+static void ariesDecodeRxCapture(
+        AriesPmaReadType* reads,
+        AriesRxStateType* rxState)
 {
-    uint8_t dataByte[1];
-    AriesErrorType rc;
+    uint8_t* dataWord;
+    int attCode;
+    int vgaCode;
+    int boostCode;
+    float dfe[8];
+    int tap;
 
-    // Based on the lane info, determine QS and Path info
-    int qs;
-    int qsPath;
-    int qsPathLane;
-    ariesGetQSPathInfo(lane, direction, &qs, &qsPath, &qsPathLane);
+    // TERM_EN_OVRD_EN is bit 7 and TERM_EN is bit 6 of OVRD_IN_3, else
+    // RX_TERM_EN is bit 2 of ASIC_IN_1
+    dataWord = reads[0].data;
+    if (dataWord[0] & 0x80)
+    {
+        rxState->termination = (dataWord[0] & 0x40) >> 6;
+    }
+    else
+    {
+        rxState->termination = (reads[1].data[0] & 0x04) >> 2;
+    }
 
-    // Compute reg address
-    // Calculate QS, Path, Path lane relative offsets first,
-    // and then compute actual address
-    int qsOff = ARIES_QS_0_CSR_OFFSET + (qs*ARIES_QS_STRIDE);
-    int pathOff = ARIES_PATH_WRAPPER_0_CSR_OFFSET +
-        (qsPath*ARIES_PATH_WRP_STRIDE);
-    int pathLaneOff = ARIES_PATH_LANE_0_CSR_OFFSET +
-        (qsPathLane*ARIES_PATH_LANE_STRIDE);
+    // ATT is bits 7:5
+    attCode = reads[2].data[0] >> 5;
+    rxState->attdB = attCode * -1.5;
 
-    uint32_t address = qsOff + pathOff + pathLaneOff +
-        ARIES_DESKEW_STATUS;
+    // VGA is bits 9:5
+    dataWord = reads[3].data;
+    vgaCode = (((dataWord[1] & 0x03) << 8) + dataWord[0]) >> 5;
+    rxState->vgadB = vgaCode * 0.9;
 
-    rc = ariesReadByteData(link->device->i2cDriver, address, dataByte);
-    CHECK_SUCCESS(rc);
-    *status = dataByte[0];
-    return ARIES_SUCCESS;
+    // CTLE boost is bits 9:5 and pole is bits 11:10
+    dataWord = reads[4].data;
+    boostCode = (((dataWord[1] & 0x03) << 8) + dataWord[0]) >> 5;
+    rxState->ctleBoostdB = ariesGetRxBoostValueDb(boostCode, rxState->attdB,
+        vgaCode);
+    rxState->ctlePole = (dataWord[1] & 0x0c) >> 2;
+
+    for (tap = 1; tap <= 8; tap++)
+    {
+        dfe[tap-1] = ariesDecodeRxDfeCode(tap,
+            reads[ARIES_RX_CAPTURE_DFE_TAP1_IDX + tap - 1].data) *
+            ariesRxDfeTapMv[tap-1];
+    }
+    rxState->dfe1 = dfe[0];
+    rxState->dfe2 = dfe[1];
+    rxState->dfe3 = dfe[2];
+    rxState->dfe4 = dfe[3];
+    rxState->dfe5 = dfe[4];
+    rxState->dfe6 = dfe[5];
+    rxState->dfe7 = dfe[6];
+    rxState->dfe8 = dfe[7];
+
+    // FoM value is 7:0 of word
+    rxState->FoM = reads[ARIES_RX_CAPTURE_FOM_IDX].data[0];
 }
 
 /*
- * Get the number of clocks of deskew applied for the given lane
+ * Median of the DPLL code readings of one lane in a capture
  */
-AriesErrorType ariesGetDeskewClks(
-        AriesLinkType* link,
-        int lane,
-        int direction,
-        int* val)
+static uint16_t ariesDecodeRxDpllCapture(
+        AriesPmaReadType* reads)
 {
-    uint8_t dataByte[1];
-    AriesErrorType rc;
-
-    // Based on the lane info, determine QS and Path info
-    int qs;
-    int qsPath;
-    int qsPathLane;
-    ariesGetQSPathInfo(lane, direction, &qs, &qsPath, &qsPathLane);
-
-    // Compute reg address
-    // Calculate QS, Path, Path lane relative offsets first,
-    // and then compute actual address
-    int qsOff = ARIES_QS_0_CSR_OFFSET + (qs*ARIES_QS_STRIDE);
-    int pathOff = ARIES_PATH_WRAPPER_0_CSR_OFFSET +
-        (qsPath*ARIES_PATH_WRP_STRIDE);
-    int pathLaneOff = ARIES_PATH_LANE_0_CSR_OFFSET +
-        (qsPathLane*ARIES_PATH_LANE_STRIDE);
+    uint16_t DPLLfreqs[ARIES_NUM_DPLL_FREQ_READINGS];
+    int dpll_i;
 
-    uint32_t address = qsOff + pathOff + pathLaneOff +
-        ARIES_DSK_CC_DELTA;
+    for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
+    {
+        DPLLfreqs[dpll_i] = reads[dpll_i].data[0] +
+            (reads[dpll_i].data[1] << 8);
+    }
 
-    rc = ariesReadByteData(link->device->i2cDriver, address, dataByte);
-    CHECK_SUCCESS(rc);
-    *val = dataByte[0];
-    return ARIES_SUCCESS;
+    return ariesGetMedian(DPLLfreqs, ARIES_NUM_DPLL_FREQ_READINGS);
 }
 
 /*
- * For the last round of Equalization, get the final pre-cursor request the
- * link partner made. If the last request was a Perest request, this value
+ * Check if a DPLL code is a plausible lock frequency
+ */
+static bool ariesRxDpllCodeValid(
+        uint16_t DPLLFreq)
+{
+    return ((DPLLFreq >= 4098) && (DPLLFreq <= 12288));
+}
+
+/*
+ * Capture RX PMA state of all lanes of a link on both pseudo ports
+ */
+AriesErrorType ariesLinkCaptureRxPmaState(
+        AriesLinkType* link,
+        int upstreamSide,
+        int downstreamSide)
+{
+    AriesErrorType rc;
+    AriesPmaReadType reads[2 * 16 * ARIES_LINK_RX_CAPTURE_REGS_PER_LANE];
+    AriesRxStateType* rxStates[2 * 16];
+    int width = link->state.width;
+    int startLane = ariesGetStartLane(link);
+    int sides[2 * 16];
+    int absLanes[2 * 16];
+    int retryLanes[2 * 16];
+    int numRetryLanes;
+    int numTriedLanes;
+    int sideIndex;
+    int laneIndex;
+    int regIndex;
+    int numReads = 0;
+    int try_i;
+
+    if ((width < 0) || (width > 16))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Schedule reads by side, then PMA and lane (absolute lanes increase
+    // with PMA number), then reg. The DPLL code is read
+    // ARIES_NUM_DPLL_FREQ_READINGS times after the regs of a lane
+    for (sideIndex = 0; sideIndex < 2; sideIndex++)
+    {
+        for (laneIndex = 0; laneIndex < width; laneIndex++)
+        {
+            int captureIndex = (sideIndex * width) + laneIndex;
+            int absLane = startLane + laneIndex;
+
+            sides[captureIndex] = (sideIndex == 0) ? upstreamSide :
+                downstreamSide;
+            absLanes[captureIndex] = absLane;
+            if (sideIndex == 0)
+            {
+                rxStates[captureIndex] =
+                    &link->state.usppState.rxState[laneIndex];
+            }
+            else
+            {
+                rxStates[captureIndex] =
+                    &link->state.dsppState.rxState[laneIndex];
+            }
+
+            for (regIndex = 0; regIndex < ARIES_LINK_RX_CAPTURE_REGS_PER_LANE;
+                regIndex++)
+            {
+                reads[numReads].side = sides[captureIndex];
+                reads[numReads].quadSlice = ariesGetPmaNumber(absLane);
+                reads[numReads].pmaAddr = (ariesGetPmaLane(absLane) *
+                    ARIES_PMA_LANE_STRIDE);
+                if (regIndex < ARIES_RX_CAPTURE_NUM_REGS)
+                {
+                    reads[numReads].pmaAddr += ariesRxCaptureRegs[regIndex];
+                }
+                else
+                {
+                    reads[numReads].pmaAddr += ARIES_PMA_LANE_DIG_RX_DPLL_FREQ;
+                }
+                numReads++;
+            }
+        }
+    }
+
+    rc = ariesReadWordsPmaMainMicroIndirect(link->device->i2cDriver, reads,
+        numReads);
+    CHECK_SUCCESS(rc);
+
+    numRetryLanes = 0;
+    for (laneIndex = 0; laneIndex < (2 * width); laneIndex++)
+    {
+        AriesPmaReadType* laneReads = &reads[laneIndex *
+            ARIES_LINK_RX_CAPTURE_REGS_PER_LANE];
+
+        ariesDecodeRxCapture(laneReads, rxStates[laneIndex]);
+        rxStates[laneIndex]->DPLLCode = ariesDecodeRxDpllCapture(
+            &laneReads[ARIES_RX_CAPTURE_NUM_REGS]);
+        if (!ariesRxDpllCodeValid(rxStates[laneIndex]->DPLLCode))
+        {
+            retryLanes[numRetryLanes++] = laneIndex;
+        }
+    }
+
+    // Take the DPLL code readings again, as one list, for lanes whose
+    // median was not a lock frequency
+    for (try_i = 1; (try_i < ARIES_NUM_DPLL_FREQ_READING_TRIES) &&
+        (numRetryLanes > 0); try_i++)
+    {
+        int retryIndex;
+        int dpll_i;
+
+        numReads = 0;
+        for (retryIndex = 0; retryIndex < numRetryLanes; retryIndex++)
+        {
+            int absLane = absLanes[retryLanes[retryIndex]];
+            for (dpll_i = 0; dpll_i < ARIES_NUM_DPLL_FREQ_READINGS; dpll_i++)
+            {
+                reads[numReads].side = sides[retryLanes[retryIndex]];
+                reads[numReads].quadSlice = ariesGetPmaNumber(absLane);
+                reads[numReads].pmaAddr = ARIES_PMA_LANE_DIG_RX_DPLL_FREQ +
+                    (ariesGetPmaLane(absLane) * ARIES_PMA_LANE_STRIDE);
+                numReads++;
+            }
+        }
+
+        rc = ariesReadWordsPmaMainMicroIndirect(link->device->i2cDriver,
+            reads, numReads);
+        CHECK_SUCCESS(rc);
+
+        numTriedLanes = numRetryLanes;
+        numRetryLanes = 0;
+        for (retryIndex = 0; retryIndex < numTriedLanes; retryIndex++)
+        {
+            laneIndex = retryLanes[retryIndex];
+            rxStates[laneIndex]->DPLLCode = ariesDecodeRxDpllCapture(
+                &reads[retryIndex * ARIES_NUM_DPLL_FREQ_READINGS]);
+            if (!ariesRxDpllCodeValid(rxStates[laneIndex]->DPLLCode))
+            {
+                retryLanes[numRetryLanes++] = laneIndex;
+            }
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Get the bus transaction budget of the link RX PMA capture
+ */
+int ariesLinkCaptureRxPmaBudget(
+        AriesLinkType* link)
+{
+    return 2 * link->state.width * ARIES_LINK_RX_CAPTURE_REGS_PER_LANE *
+        ARIES_PMA_READ_NUM_TRANSACTIONS;
+}
+
+/*
+ * Get the last speed at which EQ was run (e.g. 3 for Gen-3)
+ */
+AriesErrorType ariesGetLastEqSpeed(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        int* speed)
+{
+    AriesErrorType rc;
+    int pathID = ((lane/2)*2) + direction;
+    uint8_t dataByte[1];
+
+    // Reading gp_ctrl_sts_struct.last_eq_pcie_gen
+    int address = link->device->pm_gp_ctrl_sts_struct_addr +
+        ARIES_CTRL_STS_STRUCT_LAST_EQ_PCIE_GEN;
+
+    rc = ariesReadByteDataPathMicroIndirect(link->device->i2cDriver, pathID,
+            address, dataByte);
+    CHECK_SUCCESS(rc);
+
+    *speed = dataByte[0];
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Get the deskew status string for the given lane
+ */
+AriesErrorType ariesGetDeskewStatus(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        int* status)
+{
+    uint8_t dataByte[1];
+    AriesErrorType rc;
+
+    // Based on the lane info, determine QS and Path info
+    int qs;
+    int qsPath;
+    int qsPathLane;
+    ariesGetQSPathInfo(lane, direction, &qs, &qsPath, &qsPathLane);
+
+    // Compute reg address
+    // Calculate QS, Path, Path lane relative offsets first,
+    // and then compute actual address
+    int qsOff = ARIES_QS_0_CSR_OFFSET + (qs*ARIES_QS_STRIDE);
+    int pathOff = ARIES_PATH_WRAPPER_0_CSR_OFFSET +
+        (qsPath*ARIES_PATH_WRP_STRIDE);
+    int pathLaneOff = ARIES_PATH_LANE_0_CSR_OFFSET +
+        (qsPathLane*ARIES_PATH_LANE_STRIDE);
+
+    uint32_t address = qsOff + pathOff + pathLaneOff +
+        ARIES_DESKEW_STATUS;
+
+    rc = ariesReadByteData(link->device->i2cDriver, address, dataByte);
+    CHECK_SUCCESS(rc);
+    *status = dataByte[0];
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Get the number of clocks of deskew applied for the given lane
+ */
+AriesErrorType ariesGetDeskewClks(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        int* val)
+{
+    uint8_t dataByte[1];
+    AriesErrorType rc;
+
+    // Based on the lane info, determine QS and Path info
+    int qs;
+    int qsPath;
+    int qsPathLane;
+    ariesGetQSPathInfo(lane, direction, &qs, &qsPath, &qsPathLane);
+
+    // Compute reg address
+    // Calculate QS, Path, Path lane relative offsets first,
+    // and then compute actual address
+    int qsOff = ARIES_QS_0_CSR_OFFSET + (qs*ARIES_QS_STRIDE);
+    int pathOff = ARIES_PATH_WRAPPER_0_CSR_OFFSET +
+        (qsPath*ARIES_PATH_WRP_STRIDE);
+    int pathLaneOff = ARIES_PATH_LANE_0_CSR_OFFSET +
+        (qsPathLane*ARIES_PATH_LANE_STRIDE);
+
+    uint32_t address = qsOff + pathOff + pathLaneOff +
+        ARIES_DSK_CC_DELTA;
+
+    rc = ariesReadByteData(link->device->i2cDriver, address, dataByte);
+    CHECK_SUCCESS(rc);
+    *val = dataByte[0];
+    return ARIES_SUCCESS;
+}
+
+/*
+ * For the last round of Equalization, get the final pre-cursor request the
+ * link partner made. If the last request was a Perest request, this value
  * will be 0.
  */
 AriesErrorType ariesGetLastEqReqPre(
@@ -2309,6 +2703,29 @@ AriesErrorType ariesGetLastEqPresetReqFOM(
     return ARIES_SUCCESS;
 }
 
+/*
+ * Read FW state and last EQ results of a path from gp_ctrl_sts_struct
+ */
+AriesErrorType ariesGetPathCtrlSts(
+        AriesLinkType* link,
+        int lane,
+        int direction,
+        uint8_t* ctrlSts)
+{
+    AriesErrorType rc;
+    int pathID = ((lane/2)*2) + direction;
+
+    // Reading gp_ctrl_sts_struct.fw_state through
+    // gp_ctrl_sts_struct.last_eq_final_req_pst_ln1
+    int address = link->device->pm_gp_ctrl_sts_struct_addr +
+        ARIES_CTRL_STS_STRUCT_FW_STATE;
+    rc = ariesReadBlockDataPathMicroIndirectBulk(link->device->i2cDriver,
+            pathID, address, ARIES_CTRL_STS_STRUCT_CAPTURE_NUM_BYTES, ctrlSts);
+    CHECK_SUCCESS(rc);
+
+    return ARIES_SUCCESS;
+}
+
 /*
  * Get format ID from current location
  */
@@ -2471,41 +2888,80 @@ uint8_t ariesGetPecByte(
         uint8_t* polynomial,
         uint8_t length)
 {
-    uint8_t crc;
-    int byteIndex;
-    int bitIndex;
+    // Remainder of the whole stream: CRC-8 of all but the last byte, with
+    // the last byte folded in (0x0 to generate, received PEC to check)
+    return ariesPecUpdate(0, polynomial, (length-1)) ^ polynomial[(length-1)];
+}
+
 
-    // Shift polynomial by 1 so that it is 8 bit
-    // Take this extra bit into account later
-    uint8_t poly = ARIES_CRC8_POLYNOMIAL >> 1;
-    crc = polynomial[0];
+/*
+ * Fold data bytes into a running SMBus PEC (CRC-8)
+ */
+uint8_t ariesPecUpdate(
+        uint8_t crc,
+        uint8_t* data,
+        int length)
+{
+    int byteIndex;
 
-    for (byteIndex = 1; byteIndex < length; byteIndex++)
+    for (byteIndex = 0; byteIndex < length; byteIndex++)
     {
-        uint8_t nextByte = polynomial[byteIndex];
-        for (bitIndex = 7; bitIndex >= 0; bitIndex--)
-        {
-            // Check if MSB in CRC is 1
-            if (crc & 0x80)
-            {
-                // Perform subtraction of first 8 bits
-                crc = (crc ^ poly) << 1;
-                // Add final bit of mod2 subtraction and place in pos 0 of CRC
-                crc = crc + (((nextByte >> bitIndex) & 1) ^ 1);
-            }
-            else
-            {
-                // Shift out 0
-                crc = crc << 1;
-                // Shift in next bit
-                crc = crc + ((nextByte >> bitIndex) & 1);
-            }
-        }
+        crc = ariesCrc8Table[(crc ^ data[byteIndex])];
     }
     return crc;
 }
 
 
+/*
+ * Fold one byte into a running SMBus PEC (CRC-8)
+ */
+uint8_t ariesPecUpdateByte(
+        uint8_t crc,
+        uint8_t data)
+{
+    return ariesCrc8Table[(crc ^ data)];
+}
+
+
+/*
+ * Calculate PEC byte of an SMBus block write
+ */
+uint8_t ariesGetWritePecByte(
+        uint8_t slaveAddr,
+        uint8_t cmdCode,
+        uint8_t* buf,
+        int length)
+{
+    uint8_t crc;
+
+    // Slave address and write bit, command code, then data
+    crc = ariesPecUpdateByte(0, (slaveAddr << 1) + 0);
+    crc = ariesPecUpdateByte(crc, cmdCode);
+    return ariesPecUpdate(crc, buf, length);
+}
+
+
+/*
+ * Check PEC byte of an SMBus block read
+ */
+bool ariesCheckReadPecByte(
+        uint8_t slaveAddr,
+        uint8_t cmdCode,
+        uint8_t* buf,
+        int length)
+{
+    uint8_t crc;
+
+    // Write portion (slave address and write bit, command code), read
+    // portion (slave address and read bit), then data and PEC byte. A
+    // correct PEC leaves a zero remainder
+    crc = ariesPecUpdateByte(0, (slaveAddr << 1) + 0);
+    crc = ariesPecUpdateByte(crc, cmdCode);
+    crc = ariesPecUpdateByte(crc, (slaveAddr << 1) + 1);
+    return (ariesPecUpdate(crc, buf, length) == 0);
+}
+
+
 AriesErrorType ariesGetMinFoMVal(
         AriesDeviceType* device,
         int side,
@@ -2935,11 +3391,17 @@ AriesErrorType ariesEepromReadBlockData(
             rc = ariesI2CMasterSendByte(device->i2cDriver, dataByte, 1);
             CHECK_SUCCESS(rc);
             firstRead = false;
-        }
 
-        // Perform byte read and store in values array
-        rc = ariesI2CMasterReceiveByte(device->i2cDriver, dataByte);
-        CHECK_SUCCESS(rc);
+            rc = ariesI2CMasterReceiveByte(device->i2cDriver, dataByte);
+            CHECK_SUCCESS(rc);
+        }
+        else
+        {
+            // Receive continuous stream of bytes to speed up process
+            rc = ariesI2CMasterReceiveContinuousByte(device->i2cDriver,
+                dataByte);
+            CHECK_SUCCESS(rc);
+        }
 
         values[valIndex] = dataByte[0];
         valIndex++;
@@ -2956,8 +3418,10 @@ AriesErrorType ariesEepromCalcChecksum(
         uint8_t* checksum)
 {
     AriesErrorType rc;
-    uint8_t dataByte[1];
+    uint8_t dataBytes[255];
     uint8_t runningChecksum = 0;
+    int chunkBytes;
+    int byteIdx;
 
     if ((numBytes <= 0) || (startAddr < 0) || (startAddr >= 262144) ||
         ((startAddr+numBytes-1) >= 262144))
@@ -2965,13 +3429,22 @@ AriesErrorType ariesEepromCalcChecksum(
         return ARIES_INVALID_ARGUMENT;
     }
 
-    // Calculate expected checksum
+    // Calculate expected checksum, reading the EEPROM in blocks so the
+    // address is only sent once per block
     int addr;
-    for (addr = startAddr; addr < (startAddr+numBytes); addr++)
+    for (addr = startAddr; addr < (startAddr+numBytes); addr += chunkBytes)
     {
-        rc = ariesEepromReadBlockData(device, dataByte, addr, 1);
+        chunkBytes = (startAddr+numBytes) - addr;
+        if (chunkBytes > 255)
+        {
+            chunkBytes = 255;
+        }
+        rc = ariesEepromReadBlockData(device, dataBytes, addr, chunkBytes);
         CHECK_SUCCESS(rc);
-        runningChecksum = (runningChecksum + dataByte[0]) & 0xff;
+        for (byteIdx = 0; byteIdx < chunkBytes; byteIdx++)
+        {
+            runningChecksum = (runningChecksum + dataBytes[byteIdx]) & 0xff;
+        }
     }
     *checksum = runningChecksum;
     return ARIES_SUCCESS;
@@ -3076,25 +3549,141 @@ AriesErrorType ariesLoadBinFile(
 }
 
 
-/* loads an intel hex file into the global memory[] array */
+/*
+ * Hex digit values of the ASCII characters, -1 for non hex characters
+ */
+static const int8_t ariesIhxHexValue[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+
+/*
+ * Decode the two hex digits at text into a byte. Returns -1 if either is not
+ * a hex digit
+ */
+static int ariesIhxHexByte(
+        const char* text)
+{
+    int hi = ariesIhxHexValue[(uint8_t) text[0]];
+    int lo = ariesIhxHexValue[(uint8_t) text[1]];
+
+    if ((hi < 0) || (lo < 0))
+    {
+        return -1;
+    }
+    return (hi << 4) | lo;
+}
+
+
+/*
+ * Decode one intel hex record of len characters (without line terminator)
+ * into its data bytes, 16-bit address and record type
+ */
+static AriesErrorType ariesIhxDecodeRecord(
+        const char* record,
+        int len,
+        uint8_t* bytes,
+        int* addr,
+        int* num,
+        int* type)
+{
+    int count;
+    int sum;
+    int val;
+    int index;
+
+    *num = 0;
+    if ((len < 11) || (record[0] != ':'))
+    {
+        return ARIES_FAILURE;
+    }
+
+    count = ariesIhxHexByte(record + 1);
+    if ((count < 0) || (len < (11 + (count * 2))))
+    {
+        return ARIES_FAILURE;
+    }
+
+    // Length, address, type and data bytes, then the checksum byte. The sum
+    // of all of them is 0 modulo 256
+    sum = count;
+    for (index = 0; index < 3; index++)
+    {
+        val = ariesIhxHexByte(record + 3 + (index * 2));
+        if (val < 0)
+        {
+            return ARIES_FAILURE;
+        }
+        bytes[index] = val;
+        sum += val;
+    }
+    *addr = (bytes[0] << 8) | bytes[1];
+    *type = bytes[2];
+
+    for (index = 0; index <= count; index++)
+    {
+        val = ariesIhxHexByte(record + 9 + (index * 2));
+        if (val < 0)
+        {
+            return ARIES_FAILURE;
+        }
+        bytes[index] = val;
+        sum += val;
+    }
+    if (sum & 0xff)
+    {
+        return ARIES_FAILURE; /* checksum error */
+    }
+
+    *num = count;
+    return ARIES_SUCCESS;
+}
+
+
+/* loads an intel hex file into the mem[] array */
 /* filename is a string of the file to be opened */
+/* The file is read in blocks and decoded record by record. Data records */
+/* are placed at their address, including extended segment (02) and */
+/* extended linear (04) address records. Files without extended address */
+/* records continue in the next 64 KB bank when the record address wraps */
 AriesErrorType ariesLoadIhxFile(
         const char* filename,
         uint8_t* mem)
 {
     AriesErrorType rc;
-    char line[1000];
     FILE *fin;
+    char* buffer;
+    char* line;
+    char* lineEnd;
+    uint8_t bytes[256];
+    size_t numBuffered = 0;
+    size_t numRead;
+    int lineLen;
+    int lineno = 0;
     int addr;
+    int prevAddr = -1;
     int n;
-    int status;
-    uint8_t bytes[256];
-    int byte;
-    int indx = 0;
-    int total = 0;
-    int lineno = 1;
-    int minAddr = 0xffff;
-    int maxAddr = 0;
+    int type;
+    int baseAddr = 0;
+    int wrapAddr = 0;
+    bool extAddr = false;
+    bool eof = false;
+    bool done = false;
 
     // Check if file is valid
     if (strlen(filename) == 0)
@@ -3108,130 +3697,535 @@ AriesErrorType ariesLoadIhxFile(
         ASTERA_ERROR("Can't open file '%s' for reading", filename);
         return ARIES_FAILURE;
     }
+    buffer = (char*) malloc(ARIES_IHX_READ_BUFFER_SIZE);
+    if (buffer == NULL)
+    {
+        fclose(fin);
+        return ARIES_FAILURE;
+    }
 
-    while (!feof(fin) && !ferror(fin))
+    rc = ARIES_SUCCESS;
+    while (!done && (rc == ARIES_SUCCESS))
     {
-        line[0] = '\0';
-        fgets(line, 1000, fin);
-        if (line[strlen(line)-1] == '\n')
+        numRead = fread(buffer + numBuffered, 1,
+            ARIES_IHX_READ_BUFFER_SIZE - numBuffered, fin);
+        numBuffered += numRead;
+        if (numRead == 0)
         {
-            line[strlen(line)-1] = '\0';
-        }
-        if (line[strlen(line)-1] == '\r')
-        {
-            line[strlen(line)-1] = '\0';
+            if (ferror(fin))
+            {
+                ASTERA_ERROR("There was some error in reading from file '%s'",
+                    filename);
+                rc = ARIES_FAILURE;
+                break;
+            }
+            eof = true;
         }
 
-        rc = ariesParseIhxLine(line, bytes, &addr, &n, &status);
-        if (rc != ARIES_SUCCESS)
-        {
-            ASTERA_ERROR("Error: '%s', line: %d", filename, lineno);
-        }
-        else
+        // Decode every complete line in the buffer (and the last line at end
+        // of file), then keep the partial line for the next read
+        line = buffer;
+        while (!done && (rc == ARIES_SUCCESS))
         {
-            if (status == 0)
-            {  /* data */
-                for (byte = 0; byte <= (n-1); byte++)
+            lineEnd = (char*) memchr(line, '\n',
+                numBuffered - (line - buffer));
+            if (lineEnd == NULL)
+            {
+                if (!eof || (line == buffer + numBuffered))
                 {
-                    mem[indx] = bytes[byte] & 0xff;
-                    total++;
-                    if (addr < minAddr) minAddr = addr;
-                    if (addr > maxAddr) maxAddr = addr;
-                    addr++;
-                    indx++;
+                    break;
                 }
+                lineEnd = buffer + numBuffered;
             }
-            if (status == 1)
-            {  /* end of file */
-                fclose(fin);
-                break;
+            lineno++;
+            lineLen = lineEnd - line;
+            if ((lineLen > 0) && (line[lineLen - 1] == '\r'))
+            {
+                lineLen--;
             }
+
+            if (lineLen > 0)
+            {
+                rc = ariesIhxDecodeRecord(line, lineLen, bytes, &addr, &n,
+                    &type);
+                if (rc != ARIES_SUCCESS)
+                {
+                    ASTERA_ERROR("Error: '%s', line: %d", filename, lineno);
+                }
+                else if (type == 0)
+                {  /* data */
+                    if (!extAddr && (addr < prevAddr))
+                    {
+                        wrapAddr += 0x10000;
+                    }
+                    prevAddr = addr;
+                    addr += baseAddr + wrapAddr;
+                    if ((addr + n) > ARIES_EEPROM_NUM_BYTES)
+                    {
+                        ASTERA_ERROR("Error: '%s', line: %d, address 0x%x is outside the EEPROM",
+                            filename, lineno, addr);
+                        rc = ARIES_FAILURE;
+                    }
+                    else
+                    {
+                        memcpy(mem + addr, bytes, n);
+                    }
+                }
+                else if (type == 1)
+                {  /* end of file */
+                    done = true;
+                }
+                else if ((type == 2) || (type == 4))
+                {  /* extended segment or linear address */
+                    if (n != 2)
+                    {
+                        ASTERA_ERROR("Error: '%s', line: %d", filename, lineno);
+                        rc = ARIES_FAILURE;
+                    }
+                    baseAddr = (bytes[0] << 8) | bytes[1];
+                    baseAddr <<= (type == 2) ? 4 : 16;
+                    extAddr = true;
+                }
+            }
+
+            if (lineEnd == buffer + numBuffered)
+            {
+                line = lineEnd;
+            }
+            else
+            {
+                line = lineEnd + 1;
+            }
+        }
+
+        numBuffered -= line - buffer;
+        if (eof)
+        {
+            if (!done && (rc == ARIES_SUCCESS))
+            {
+                ASTERA_WARN("No end of file record in '%s'", filename);
+            }
+            break;
+        }
+        if (numBuffered == ARIES_IHX_READ_BUFFER_SIZE)
+        {
+            ASTERA_ERROR("Error: '%s', line: %d is too long", filename,
+                lineno + 1);
+            rc = ARIES_FAILURE;
         }
-        lineno++;
+        memmove(buffer, line, numBuffered);
     }
-    return ARIES_SUCCESS;
+
+    free(buffer);
+    fclose(fin);
+
+    return rc;
 }
 
-/* parses a line of intel hex code, stores the data in bytes[] */
-/* and the beginning address in addr, and returns a ARIES_SUCCESS if the */
-/* line was valid, or a ARIES_FAILURE if an error occured.  The variable */
-/* num gets the number of bytes that were stored into bytes[] */
-AriesErrorType ariesParseIhxLine(
-        char* line,
-        uint8_t* bytes,
-        int* addr,
-        int* num,
-        int* status)
+/*
+ * Map a FW image cache read-only and check its layout and block checksums
+ */
+static AriesErrorType ariesFWImageMapCache(
+        AriesFWImageType* image,
+        const char* filename,
+        bool quiet)
 {
-    int sum;
-    int cksum;
-    int len;
-    char *ptr;
-    int val;
-
-    *num = 0;
-    // First char
-    if (line[0] != ':')
+    const AriesFWImageCacheHeaderType* header;
+    const uint32_t* blockChecksums;
+    const uint8_t* block;
+    struct stat st;
+    uint32_t blockIndex;
+    uint32_t sum;
+    uint32_t byte;
+    void* base;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        if (!quiet)
+        {
+            ASTERA_ERROR("Can't open file '%s' for reading", filename);
+        }
+        return ARIES_FAILURE;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)
+        (ARIES_FW_IMAGE_CACHE_DATA_OFFSET + ARIES_EEPROM_NUM_BYTES)))
     {
+        ASTERA_ERROR("'%s' is not a FW image cache", filename);
+        close(fd);
         return ARIES_FAILURE;
     }
 
-    if (strlen(line) < 11)
+    base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
     {
+        ASTERA_ERROR("Could not map file '%s'", filename);
         return ARIES_FAILURE;
     }
-    ptr = line+1;
 
-    if (!sscanf(ptr, "%02x", &len))
-    {
+    header = (const AriesFWImageCacheHeaderType*) base;
+    if ((header->magic != ARIES_FW_IMAGE_CACHE_MAGIC)
+        || (header->versionMajor != ARIES_FW_IMAGE_CACHE_VERSION_MAJOR)
+        || (header->imageSize != ARIES_EEPROM_NUM_BYTES)
+        || (header->blockSize != ARIES_FW_IMAGE_CACHE_BLOCK_SIZE)
+        || (header->numBlocks !=
+            (ARIES_EEPROM_NUM_BYTES / ARIES_FW_IMAGE_CACHE_BLOCK_SIZE))
+        || (header->headerSize < (sizeof(AriesFWImageCacheHeaderType) +
+            (header->numBlocks * sizeof(uint32_t))))
+        || (header->dataOffset < header->headerSize)
+        || ((header->dataOffset % ARIES_FW_IMAGE_CACHE_BLOCK_SIZE) != 0)
+        || (((uint64_t) header->dataOffset + header->imageSize) >
+            (uint64_t) st.st_size))
+    {
+        ASTERA_ERROR("'%s' is not a FW image cache of version %d", filename,
+            ARIES_FW_IMAGE_CACHE_VERSION_MAJOR);
+        munmap(base, st.st_size);
         return ARIES_FAILURE;
     }
-    ptr += 2;
 
-    if ( strlen(line) < (11 + (len * 2)) )
+    // A truncated or corrupted cache must not be programmed
+    blockChecksums = (const uint32_t*) ((const uint8_t*) base +
+        sizeof(AriesFWImageCacheHeaderType));
+    block = (const uint8_t*) base + header->dataOffset;
+    for (blockIndex = 0; blockIndex < header->numBlocks; blockIndex++)
+    {
+        sum = 0;
+        for (byte = 0; byte < header->blockSize; byte++)
+        {
+            sum += block[byte];
+        }
+        if (sum != blockChecksums[blockIndex])
+        {
+            ASTERA_ERROR("'%s' block %d: checksum did not match", filename,
+                blockIndex);
+            munmap(base, st.st_size);
+            return ARIES_FAILURE;
+        }
+        block += header->blockSize;
+    }
+
+    image->mapBase = base;
+    image->mapSize = st.st_size;
+    image->data = (uint8_t*) base + header->dataOffset;
+    image->imageEnd = header->imageEnd;
+    image->cache = header;
+    image->blockChecksums = blockChecksums;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Open a firmware image: map a binary file or image cache read-only, or
+ * decode an intel hex file into a heap buffer
+ */
+AriesErrorType ariesFWImageOpen(
+        AriesFWImageType* image,
+        const char* filename,
+        AriesFWImageFormatType fileType)
+{
+    AriesErrorType rc;
+    struct stat st;
+    void* base;
+    int fd;
+
+    if ((image == NULL) || (filename == NULL))
     {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(image, 0, sizeof(AriesFWImageType));
+
+    if (fileType == ARIES_FW_IMAGE_FORMAT_IHX)
+    {
+        image->data = (uint8_t*) calloc(ARIES_EEPROM_NUM_BYTES, 1);
+        if (image->data == NULL)
+        {
+            return ARIES_FAILURE;
+        }
+        rc = ariesLoadIhxFile(filename, image->data);
+        if (rc != ARIES_SUCCESS)
+        {
+            free(image->data);
+            image->data = NULL;
+            return rc;
+        }
+        image->imageEnd = ariesGetEEPROMImageEnd(image->data);
+        return ARIES_SUCCESS;
+    }
+    else if (fileType == ARIES_FW_IMAGE_FORMAT_CACHE)
+    {
+        return ariesFWImageMapCache(image, filename, false);
+    }
+    else if (fileType != ARIES_FW_IMAGE_FORMAT_BIN)
+    {
+        ASTERA_ERROR("Invalid Aries FW image format type");
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Binary image is used in place, so the EEPROM writes and verifies read
+    // straight from the page cache
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        ASTERA_ERROR("Can't open file '%s' for reading", filename);
+        return ARIES_FAILURE;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        ASTERA_ERROR("There was some error in reading from file '%s'", filename);
+        close(fd);
         return ARIES_FAILURE;
     }
-    if (!sscanf(ptr, "%04x", addr))
+    if (st.st_size < ARIES_EEPROM_NUM_BYTES)
     {
+        ASTERA_ERROR("We did not read out the expected ARIES_EEPROM_NUM_BYTES: %d bytes from file '%s' was %ld",
+                ARIES_EEPROM_NUM_BYTES, filename, (long) st.st_size);
+        close(fd);
         return ARIES_FAILURE;
     }
-    ptr += 4;
 
-    if (!sscanf(ptr, "%02x", status))
+    base = mmap(NULL, ARIES_EEPROM_NUM_BYTES, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
     {
+        ASTERA_ERROR("Could not map file '%s'", filename);
         return ARIES_FAILURE;
     }
-    ptr += 2;
-    sum = (len & 255) + ((*addr >> 8) & 255) + (*addr & 255) + (*status & 255);
+    madvise(base, ARIES_EEPROM_NUM_BYTES, MADV_WILLNEED);
 
-    while (*num != len)
+    image->mapBase = base;
+    image->mapSize = ARIES_EEPROM_NUM_BYTES;
+    image->data = (uint8_t*) base;
+    image->imageEnd = ariesGetEEPROMImageEnd(image->data);
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Release a firmware image opened with ariesFWImageOpen()
+ */
+AriesErrorType ariesFWImageClose(
+        AriesFWImageType* image)
+{
+    if (image == NULL)
     {
-        int ret = sscanf(ptr, "%02x", &val);
-        bytes[*num] = (uint8_t) val;
-        if (!ret)
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    if (image->mapBase != NULL)
+    {
+        munmap(image->mapBase, image->mapSize);
+    }
+    else
+    {
+        free(image->data);
+    }
+    memset(image, 0, sizeof(AriesFWImageType));
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Write a firmware image as an image cache: header, block checksums and the
+ * image at a page aligned offset, so the cache is mapped and used without
+ * parsing. The file is written under a temporary name and renamed
+ */
+AriesErrorType ariesFWImageWriteCache(
+        AriesFWImageType* image,
+        const char* sourceFilename,
+        const char* cacheFilename)
+{
+    AriesFWImageCacheHeaderType* header;
+    uint32_t* blockChecksums;
+    char tmppath[ARIES_PATH_MAX];
+    const uint8_t* buffer;
+    struct stat st;
+    ssize_t numWritten;
+    size_t offset;
+    size_t size;
+    uint8_t* headerBuffer;
+    uint32_t blockIndex;
+    int numChars;
+    int byte;
+    int part;
+    int fd;
+
+    if ((image == NULL) || (image->data == NULL) || (cacheFilename == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    headerBuffer = (uint8_t*) calloc(ARIES_FW_IMAGE_CACHE_DATA_OFFSET, 1);
+    if (headerBuffer == NULL)
+    {
+        return ARIES_FAILURE;
+    }
+
+    header = (AriesFWImageCacheHeaderType*) headerBuffer;
+    header->magic = ARIES_FW_IMAGE_CACHE_MAGIC;
+    header->versionMajor = ARIES_FW_IMAGE_CACHE_VERSION_MAJOR;
+    header->versionMinor = ARIES_FW_IMAGE_CACHE_VERSION_MINOR;
+    header->blockSize = ARIES_FW_IMAGE_CACHE_BLOCK_SIZE;
+    header->numBlocks = ARIES_EEPROM_NUM_BYTES /
+        ARIES_FW_IMAGE_CACHE_BLOCK_SIZE;
+    header->headerSize = sizeof(AriesFWImageCacheHeaderType) +
+        (header->numBlocks * sizeof(uint32_t));
+    header->dataOffset = ARIES_FW_IMAGE_CACHE_DATA_OFFSET;
+    header->imageSize = ARIES_EEPROM_NUM_BYTES;
+    header->imageEnd = image->imageEnd;
+    if ((sourceFilename != NULL) && (stat(sourceFilename, &st) == 0))
+    {
+        header->sourceSize = st.st_size;
+        header->sourceMtime = st.st_mtim.tv_sec;
+        header->sourceMtimeNsec = st.st_mtim.tv_nsec;
+        header->sourceCtime = st.st_ctim.tv_sec;
+        header->sourceCtimeNsec = st.st_ctim.tv_nsec;
+        header->sourceDev = st.st_dev;
+        header->sourceIno = st.st_ino;
+    }
+
+    blockChecksums = (uint32_t*) (headerBuffer +
+        sizeof(AriesFWImageCacheHeaderType));
+    for (blockIndex = 0; blockIndex < header->numBlocks; blockIndex++)
+    {
+        for (byte = 0; byte < ARIES_FW_IMAGE_CACHE_BLOCK_SIZE; byte++)
         {
-            return ARIES_FAILURE;
+            blockChecksums[blockIndex] += image->data[(blockIndex *
+                ARIES_FW_IMAGE_CACHE_BLOCK_SIZE) + byte];
         }
-        ptr += 2;
-        sum += bytes[*num] & 255;
-        (*num)++;
-        if (*num >= 256)
+    }
+
+    numChars = snprintf(tmppath, ARIES_PATH_MAX, "%s.tmp", cacheFilename);
+    if ((numChars < 0) || (numChars >= ARIES_PATH_MAX))
+    {
+        ASTERA_ERROR("FW image cache path '%s' is too long", cacheFilename);
+        free(headerBuffer);
+        return ARIES_FAILURE;
+    }
+    fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        ASTERA_ERROR("Can't open file '%s' for writing", tmppath);
+        free(headerBuffer);
+        return ARIES_FAILURE;
+    }
+
+    // Header part, then the image
+    for (part = 0; part < 2; part++)
+    {
+        buffer = (part == 0) ? headerBuffer : image->data;
+        size = (part == 0) ? ARIES_FW_IMAGE_CACHE_DATA_OFFSET :
+            ARIES_EEPROM_NUM_BYTES;
+        offset = 0;
+        while (offset < size)
         {
-            return ARIES_FAILURE;
+            numWritten = write(fd, (buffer + offset), (size - offset));
+            if (numWritten <= 0)
+            {
+                ASTERA_ERROR("Could not write FW image cache '%s'", tmppath);
+                close(fd);
+                unlink(tmppath);
+                free(headerBuffer);
+                return ARIES_FAILURE;
+            }
+            offset += numWritten;
         }
     }
-    if (!sscanf(ptr, "%02x", &cksum))
+    free(headerBuffer);
+
+    if ((close(fd) != 0) || (rename(tmppath, cacheFilename) != 0))
     {
+        ASTERA_ERROR("Could not write FW image cache '%s'", cacheFilename);
+        unlink(tmppath);
         return ARIES_FAILURE;
     }
-    if ( ((sum & 255) + (cksum & 255)) & 255 )
+
+    return ARIES_SUCCESS;
+}
+
+/*
+ * Open a firmware image through an image cache: map the cache if it was
+ * built from the current image file, else load the image file and rebuild
+ * the cache
+ */
+AriesErrorType ariesFWImageOpenCached(
+        AriesFWImageType* image,
+        const char* filename,
+        AriesFWImageFormatType fileType,
+        const char* cacheFilename)
+{
+    AriesErrorType rc;
+    struct stat st;
+
+    if ((image == NULL) || (filename == NULL) || (cacheFilename == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(image, 0, sizeof(AriesFWImageType));
+
+    if (stat(filename, &st) != 0)
     {
-        return ARIES_FAILURE; /* checksum error */
+        ASTERA_ERROR("Can't open file '%s' for reading", filename);
+        return ARIES_FAILURE;
+    }
+
+    rc = ariesFWImageMapCache(image, cacheFilename, true);
+    if (rc == ARIES_SUCCESS)
+    {
+        // A rewrite within the mtime granularity, or a file replaced by
+        // one with a preserved mtime, changes the ctime or inode
+        if ((image->cache->sourceSize == (uint64_t) st.st_size) &&
+            (image->cache->sourceMtime == (int64_t) st.st_mtim.tv_sec) &&
+            (image->cache->sourceMtimeNsec ==
+                (int64_t) st.st_mtim.tv_nsec) &&
+            (image->cache->sourceCtime == (int64_t) st.st_ctim.tv_sec) &&
+            (image->cache->sourceCtimeNsec ==
+                (int64_t) st.st_ctim.tv_nsec) &&
+            (image->cache->sourceDev == (uint64_t) st.st_dev) &&
+            (image->cache->sourceIno == (uint64_t) st.st_ino))
+        {
+            return ARIES_SUCCESS;
+        }
+        ASTERA_INFO("FW image cache '%s' is stale, rebuilding it",
+            cacheFilename);
+        ariesFWImageClose(image);
     }
+
+    rc = ariesFWImageOpen(image, filename, fileType);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    // The image is usable without its cache, so a cache which cannot be
+    // written only costs the parse next time
+    if (ariesFWImageWriteCache(image, filename, cacheFilename) !=
+        ARIES_SUCCESS)
+    {
+        ASTERA_WARN("Could not write FW image cache '%s'", cacheFilename);
+    }
+
     return ARIES_SUCCESS;
 }
 
+/* parses a line of intel hex code, stores the data in bytes[] */
+/* and the beginning address in addr, and returns a ARIES_SUCCESS if the */
+/* line was valid, or a ARIES_FAILURE if an error occured.  The variable */
+/* num gets the number of bytes that were stored into bytes[] */
+AriesErrorType ariesParseIhxLine(
+        char* line,
+        uint8_t* bytes,
+        int* addr,
+        int* num,
+        int* status)
+{
+    return ariesIhxDecodeRecord(line, strlen(line), bytes, addr, num, status);
+}
+
 
 AriesErrorType ariesI2cMasterSoftReset(
         AriesI2CDriverType* i2cDriver)
@@ -4585,29 +5579,10 @@ AriesErrorType ariesReadBlockDataForceError(
 
             if (pecEn)
             {
-                // Include slave addr and write bit (0) in wrStream
-                // Include cmd code in wrStream
-                // PEC bit is already accounted for
-                uint8_t wrStreamLen = 2 + writeBufLen;
-                uint8_t wrStream[wrStreamLen];
-
-                // Fill wrStream
-                wrStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-                wrStream[1] = wrCmdCode;
-                ASTERA_TRACE("        pecBuf[0] = 0x%02x", wrStream[0]);
-                ASTERA_TRACE("        pecBuf[1] = 0x%02x", wrStream[1]);
-                int byteIdx;
-                for (byteIdx = 2; byteIdx < (wrStreamLen-1); byteIdx++)
-                {
-                    wrStream[byteIdx] = writeBuf[(byteIdx-2)];
-                    ASTERA_TRACE("        pecBuf[%d] = 0x%02x", byteIdx,
-                        wrStream[byteIdx]);
-                }
-                // Append 0x0 as CRC Polynomial
-                wrStream[(wrStreamLen-1)] = 0x0;
-                ASTERA_TRACE("        pecBuf[last] = 0x0");
-
-                uint8_t wrPec = ariesGetPecByte(wrStream, wrStreamLen);
+                // Include slave address and write bit, cmd code and data
+                // (PEC byte position excluded)
+                uint8_t wrPec = ariesGetWritePecByte(i2cDriver->slaveAddr,
+                    wrCmdCode, writeBuf, (writeBufLen-1));
                 writeBuf[3] = wrPec;
                 ASTERA_TRACE("    writeBuf[3] = 0x%02x", writeBuf[3]);
             }
@@ -4696,24 +5671,10 @@ AriesErrorType ariesReadBlockDataForceError(
 
             if (pecEn)
             {
-                // In read PEC calculation, include write (2 bytes - addr,
-                // w bit and command) and read portions (addr, r bit, data
-                // returned) of smbus instruction
-                uint8_t readStreamLen = readBufLen + 2 + 1;
-                uint8_t readStream[readStreamLen];
-                uint8_t rdPec;
-
-                readStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-                readStream[1] = rdCmdCode;
-                readStream[2] = (i2cDriver->slaveAddr << 1) + 1;
-
-                uint8_t rdStreamId;
-                for (rdStreamId = 3; rdStreamId < readStreamLen; rdStreamId++)
-                {
-                    readStream[rdStreamId] = readBuf[rdStreamId-3];
-                }
-                rdPec = ariesGetPecByte(readStream, readStreamLen);
-                if (rdPec != 0)
+                // Include write portion of read (addr and wr bit, and cmd
+                // code) and read portion (addr and rd bit, data and PEC)
+                if (!ariesCheckReadPecByte(i2cDriver->slaveAddr, rdCmdCode,
+                    readBuf, readBufLen))
                 {
                     ASTERA_ERROR("PEC value not as expected");
                     return ARIES_I2C_BLOCK_READ_FAILURE;
@@ -4782,25 +5743,10 @@ AriesErrorType ariesReadBlockDataForceError(
 
         if (pecEn)
         {
-            // Add address and w bit, and cmd code to wrStream
-            // PEC byte is already accounted for
-            uint8_t wrStreamLen = wrBufLength + 2;
-            uint8_t wrStream[wrStreamLen];
-            wrStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-            wrStream[1] = wrCmdCode;
-            ASTERA_TRACE("        pecBuf[0] = 0x%02x", wrStream[0]);
-            ASTERA_TRACE("        pecBuf[1] = 0x%02x", wrStream[1]);
-
-            uint8_t wrStreamIdx;
-            for (wrStreamIdx = 2; wrStreamIdx < (wrStreamLen-1); wrStreamIdx++)
-            {
-                wrStream[wrStreamIdx] = writeBuf[(wrStreamIdx-2)];
-                ASTERA_TRACE("        pecBuf[%d] = 0x%02x", wrStreamIdx, wrStream[wrStreamIdx]);
-            }
-            wrStream[(wrStreamLen-1)] = 0x0;  // Addition PEC byte
-            ASTERA_TRACE("        pecBuf[last] = 0x0");
-
-            uint8_t wrPec = ariesGetPecByte(wrStream, wrStreamLen);
+            // Include slave address and write bit, cmd code and data
+            // (PEC byte position excluded)
+            uint8_t wrPec = ariesGetWritePecByte(i2cDriver->slaveAddr,
+                wrCmdCode, writeBuf, (wrBufLength-1));
             writeBuf[4] = wrPec;
             ASTERA_TRACE("    writeBuf[4] = 0x%02x", writeBuf[4]);
         }
@@ -4893,29 +5839,14 @@ AriesErrorType ariesReadBlockDataForceError(
         // Verify PEC checksum
         if (pecEn)
         {
-            // Include write portion of read (addr and wr bit, and cmd Code)
-            // and extra read portion (addr and rd bit)
-            uint8_t rdStreamLen = readBufLen + 2 + 1;
-            uint8_t rdStream[rdStreamLen];
-            uint8_t rdPec;
-
-            rdStream[0] = (i2cDriver->slaveAddr << 1) + 0;
-            rdStream[1] = rdCmdCode;
-            rdStream[2] = (i2cDriver->slaveAddr << 1) + 1;
-
-            uint8_t rdStreamIdx;
-            for (rdStreamIdx = 3; rdStreamIdx < rdStreamLen; rdStreamIdx++)
-            {
-                rdStream[rdStreamIdx] = readBuf[rdStreamIdx-3];
-            }
-
-            rdPec = ariesGetPecByte(rdStream, rdStreamLen);
-            if (rdPec != 0)
+            // Include write portion of read (addr and wr bit, and cmd
+            // code) and read portion (addr and rd bit, data and PEC)
+            if (!ariesCheckReadPecByte(i2cDriver->slaveAddr, rdCmdCode,
+                readBuf, readBufLen))
             {
                 ASTERA_ERROR("PEC value not as expected");
                 return ARIES_I2C_BLOCK_READ_FAILURE;
             }
-
         }
 
         // Print the values
@@ -0,0 +1,455 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_shm.c
+ * @brief Implementation of shared memory state publication.
+ *
+ * Segment layout: a header, followed by numDevices device slots and numLinks
+ * link slots. Each slot has a sequence counter which is odd while the
+ * publisher writes the slot. A reader copies the slot and retries until the
+ * counter was even and unchanged across the copy.
+ */
+
+#include "../include/aries_shm.h"
+
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Segment header. magic is written last by the publisher.
+ */
+typedef struct AriesShmHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t deviceSlotSize;
+    uint32_t linkSlotSize;
+    int32_t numDevices;
+    int32_t numLinks;
+} AriesShmHeaderType;
+
+typedef struct AriesShmDeviceSlot
+{
+    uint64_t seq;
+    AriesShmDeviceEntryType entry;
+} AriesShmDeviceSlotType;
+
+typedef struct AriesShmLinkSlot
+{
+    uint64_t seq;
+    AriesShmLinkEntryType entry;
+} AriesShmLinkSlotType;
+
+/** Device slots start on a cache line after the header */
+#define ARIES_SHM_SLOTS_OFFSET 64
+
+
+/*
+ * Size of a segment with the given num entries
+ */
+static size_t ariesShmSize(
+        int numDevices,
+        int numLinks)
+{
+    return ARIES_SHM_SLOTS_OFFSET +
+        (numDevices * sizeof(AriesShmDeviceSlotType)) +
+        (numLinks * sizeof(AriesShmLinkSlotType));
+}
+
+
+static AriesShmDeviceSlotType* ariesShmDeviceSlot(
+        AriesShmType* shm,
+        int index)
+{
+    return (AriesShmDeviceSlotType*) ((uint8_t*) shm->base +
+        ARIES_SHM_SLOTS_OFFSET) + index;
+}
+
+
+static AriesShmLinkSlotType* ariesShmLinkSlot(
+        AriesShmType* shm,
+        int index)
+{
+    return (AriesShmLinkSlotType*) ((uint8_t*) shm->base +
+        ARIES_SHM_SLOTS_OFFSET + (shm->numDevices *
+        sizeof(AriesShmDeviceSlotType))) + index;
+}
+
+
+/*
+ * Get monotonic timestamp in us
+ */
+static uint64_t ariesShmTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+
+/*
+ * Mark a slot as being written
+ */
+static void ariesShmWriteBegin(
+        uint64_t* seq)
+{
+    __atomic_store_n(seq, *seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+
+/*
+ * Mark a slot as written
+ */
+static void ariesShmWriteEnd(
+        uint64_t* seq)
+{
+    __atomic_store_n(seq, *seq + 1, __ATOMIC_RELEASE);
+}
+
+
+/*
+ * Copy a slot entry until the copy is consistent
+ */
+static AriesErrorType ariesShmReadSlot(
+        uint64_t* seq,
+        void* entry,
+        void* snapshot,
+        size_t size)
+{
+    uint64_t seqBefore;
+    uint64_t seqAfter;
+    int tryIndex;
+
+    for (tryIndex = 0; tryIndex < ARIES_SHM_READ_TRIES; tryIndex++)
+    {
+        seqBefore = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+        if ((seqBefore & 1) == 0)
+        {
+            memcpy(snapshot, entry, size);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            seqAfter = __atomic_load_n(seq, __ATOMIC_RELAXED);
+            if (seqAfter == seqBefore)
+            {
+                return ARIES_SUCCESS;
+            }
+        }
+        sched_yield();
+    }
+
+    return ARIES_SHM_SNAPSHOT_BUSY;
+}
+
+
+/*
+ * Create the shared memory state segment and map it writable
+ */
+AriesErrorType ariesShmPublisherOpen(
+        AriesShmType* shm,
+        const char* name,
+        int numDevices,
+        int numLinks)
+{
+    AriesShmHeaderType* header;
+    size_t size;
+    void* base;
+    int fd;
+
+    if ((shm == NULL) || (name == NULL) || (numDevices < 0) ||
+        (numLinks < 0) || (strlen(name) >= sizeof(shm->name)))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Start from a fresh segment, so a reader never maps a segment whose
+    // layout changes under it
+    shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        ASTERA_ERROR("Could not create shared memory segment %s", name);
+        return ARIES_SHM_FAILURE;
+    }
+
+    size = ariesShmSize(numDevices, numLinks);
+    if (ftruncate(fd, size) != 0)
+    {
+        ASTERA_ERROR("Could not size shared memory segment %s", name);
+        close(fd);
+        shm_unlink(name);
+        return ARIES_SHM_FAILURE;
+    }
+
+    base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        ASTERA_ERROR("Could not map shared memory segment %s", name);
+        shm_unlink(name);
+        return ARIES_SHM_FAILURE;
+    }
+
+    shm->base = base;
+    shm->size = size;
+    shm->numDevices = numDevices;
+    shm->numLinks = numLinks;
+    shm->publisher = true;
+    strcpy(shm->name, name);
+
+    header = (AriesShmHeaderType*) base;
+    header->version = ARIES_SHM_VERSION;
+    header->deviceSlotSize = sizeof(AriesShmDeviceSlotType);
+    header->linkSlotSize = sizeof(AriesShmLinkSlotType);
+    header->numDevices = numDevices;
+    header->numLinks = numLinks;
+    __atomic_store_n(&header->magic, ARIES_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Publish the current state of a device
+ */
+AriesErrorType ariesShmPublishDevice(
+        AriesShmType* shm,
+        int index,
+        AriesDeviceType* device)
+{
+    AriesShmDeviceSlotType* slot;
+
+    if ((shm == NULL) || !shm->publisher || (device == NULL) || (index < 0) ||
+        (index >= shm->numDevices))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    slot = ariesShmDeviceSlot(shm, index);
+
+    ariesShmWriteBegin(&slot->seq);
+    memcpy(&slot->entry.device, device, sizeof(AriesDeviceType));
+    slot->entry.device.i2cDriver = NULL;
+    slot->entry.timestampUs = ariesShmTimeUs();
+    slot->entry.numUpdates++;
+    ariesShmWriteEnd(&slot->seq);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Publish the current state of a link
+ */
+AriesErrorType ariesShmPublishLink(
+        AriesShmType* shm,
+        int index,
+        int deviceIndex,
+        AriesLinkType* link)
+{
+    AriesShmLinkSlotType* slot;
+    int laneIndex;
+
+    if ((shm == NULL) || !shm->publisher || (link == NULL) || (index < 0) ||
+        (index >= shm->numLinks))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    slot = ariesShmLinkSlot(shm, index);
+
+    ariesShmWriteBegin(&slot->seq);
+    slot->entry.deviceIndex = deviceIndex;
+    slot->entry.config = link->config;
+    memcpy(&slot->entry.state, &link->state, sizeof(AriesLinkStateType));
+
+    // Pointers are meaningless in another process: copy the min FoM receiver
+    // name, and clear the pin name pointers (names are in the device pins)
+    memset(slot->entry.linkMinFoMRx, 0, ARIES_SHM_PIN_NAME_LEN);
+    if (link->state.linkMinFoMRx != NULL)
+    {
+        strncpy(slot->entry.linkMinFoMRx, link->state.linkMinFoMRx,
+            ARIES_SHM_PIN_NAME_LEN - 1);
+    }
+    slot->entry.state.linkMinFoMRx = NULL;
+    for (laneIndex = 0; laneIndex < 16; laneIndex++)
+    {
+        slot->entry.state.usppState.txState[laneIndex].physicalPinName = NULL;
+        slot->entry.state.usppState.rxState[laneIndex].physicalPinName = NULL;
+        slot->entry.state.dsppState.txState[laneIndex].physicalPinName = NULL;
+        slot->entry.state.dsppState.rxState[laneIndex].physicalPinName = NULL;
+    }
+    slot->entry.timestampUs = ariesShmTimeUs();
+    slot->entry.numUpdates++;
+    ariesShmWriteEnd(&slot->seq);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Map an existing shared memory state segment read-only
+ */
+AriesErrorType ariesShmReaderOpen(
+        AriesShmType* shm,
+        const char* name)
+{
+    AriesShmHeaderType* header;
+    struct stat st;
+    void* base;
+    int fd;
+
+    if ((shm == NULL) || (name == NULL) ||
+        (strlen(name) >= sizeof(shm->name)))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        ASTERA_ERROR("Could not open shared memory segment %s", name);
+        return ARIES_SHM_FAILURE;
+    }
+    if ((fstat(fd, &st) != 0) ||
+        (st.st_size < (off_t) sizeof(AriesShmHeaderType)))
+    {
+        ASTERA_ERROR("Shared memory segment %s is not initialized", name);
+        close(fd);
+        return ARIES_SHM_FAILURE;
+    }
+
+    base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        ASTERA_ERROR("Could not map shared memory segment %s", name);
+        return ARIES_SHM_FAILURE;
+    }
+
+    // Check the layout matches this build of the SDK
+    header = (AriesShmHeaderType*) base;
+    if ((__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != ARIES_SHM_MAGIC)
+        || (header->version != ARIES_SHM_VERSION)
+        || (header->deviceSlotSize != sizeof(AriesShmDeviceSlotType))
+        || (header->linkSlotSize != sizeof(AriesShmLinkSlotType))
+        || (header->numDevices < 0) || (header->numLinks < 0)
+        || ((size_t) st.st_size < ariesShmSize(header->numDevices,
+            header->numLinks)))
+    {
+        ASTERA_ERROR("Shared memory segment %s has an incompatible layout",
+            name);
+        munmap(base, st.st_size);
+        return ARIES_SHM_FAILURE;
+    }
+
+    shm->base = base;
+    shm->size = st.st_size;
+    shm->numDevices = header->numDevices;
+    shm->numLinks = header->numLinks;
+    shm->publisher = false;
+    strcpy(shm->name, name);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Take a consistent snapshot of a device entry
+ */
+AriesErrorType ariesShmReadDevice(
+        AriesShmType* shm,
+        int index,
+        AriesShmDeviceEntryType* entry)
+{
+    AriesShmDeviceSlotType* slot;
+
+    if ((shm == NULL) || (entry == NULL) || (index < 0) ||
+        (index >= shm->numDevices))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    slot = ariesShmDeviceSlot(shm, index);
+    return ariesShmReadSlot(&slot->seq, &slot->entry, entry,
+        sizeof(AriesShmDeviceEntryType));
+}
+
+
+/*
+ * Take a consistent snapshot of a link entry
+ */
+AriesErrorType ariesShmReadLink(
+        AriesShmType* shm,
+        int index,
+        AriesShmLinkEntryType* entry)
+{
+    AriesShmLinkSlotType* slot;
+    AriesErrorType rc;
+
+    if ((shm == NULL) || (entry == NULL) || (index < 0) ||
+        (index >= shm->numLinks))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    slot = ariesShmLinkSlot(shm, index);
+    rc = ariesShmReadSlot(&slot->seq, &slot->entry, entry,
+        sizeof(AriesShmLinkEntryType));
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    entry->state.linkMinFoMRx = entry->linkMinFoMRx;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Unmap the segment
+ */
+AriesErrorType ariesShmClose(
+        AriesShmType* shm,
+        bool unlink)
+{
+    if ((shm == NULL) || (shm->base == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    munmap(shm->base, shm->size);
+    shm->base = NULL;
+    if (unlink && shm->publisher)
+    {
+        shm_unlink(shm->name);
+    }
+
+    return ARIES_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
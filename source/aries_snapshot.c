@@ -0,0 +1,779 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_snapshot.c
+ * @brief Implementation of the binary snapshot reader and converters.
+ *
+ * Records are read in place from a read-only mapping of the file. Sections
+ * are aligned in the file, so records can be accessed through typed
+ * pointers. The converters only rely on the schema section of the file.
+ */
+
+#include "../include/aries_snapshot.h"
+
+#include <string.h>
+#include <float.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Byte swapped ARIES_SNAPSHOT_MAGIC, from a writer of the other byte order */
+#define ARIES_SNAPSHOT_MAGIC_SWAPPED 0x4152534e
+
+
+/*
+ * Find the n-th section of a kind
+ */
+static const AriesSnapshotSectionType* ariesSnapshotFindSection(
+        AriesSnapshotType* snapshot,
+        AriesSnapshotSectionKindType kind,
+        int n)
+{
+    uint32_t sectionIndex;
+
+    for (sectionIndex = 0; sectionIndex < snapshot->header->numSections;
+        sectionIndex++)
+    {
+        if (snapshot->sections[sectionIndex].kind == (uint32_t) kind)
+        {
+            if (n == 0)
+            {
+                return &snapshot->sections[sectionIndex];
+            }
+            n--;
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+ * Find a record section holding records of at least recordSize bytes
+ */
+static AriesErrorType ariesSnapshotGetRecords(
+        AriesSnapshotType* snapshot,
+        AriesSnapshotSectionKindType kind,
+        size_t recordSize,
+        const AriesSnapshotSectionType** section)
+{
+    if ((snapshot == NULL) || (snapshot->base == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    *section = ariesSnapshotFindSection(snapshot, kind, 0);
+    if (*section == NULL)
+    {
+        ASTERA_ERROR("Snapshot has no section of kind %d", kind);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+    if (((*section)->recordSize < recordSize) ||
+        (((*section)->recordSize % sizeof(int32_t)) != 0))
+    {
+        ASTERA_ERROR("Snapshot section of kind %d has %d byte records",
+            kind, (*section)->recordSize);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Map a snapshot file read-only
+ */
+AriesErrorType ariesSnapshotOpen(
+        AriesSnapshotType* snapshot,
+        const char* filename)
+{
+    const AriesSnapshotHeaderType* header;
+    const AriesSnapshotSectionType* section;
+    struct stat st;
+    uint32_t sectionIndex;
+    void* base;
+    int fd;
+
+    if ((snapshot == NULL) || (filename == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(snapshot, 0, sizeof(AriesSnapshotType));
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        ASTERA_ERROR("Could not open snapshot %s", filename);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+    if ((fstat(fd, &st) != 0) ||
+        (st.st_size < (off_t) sizeof(AriesSnapshotHeaderType)))
+    {
+        ASTERA_ERROR("%s is not a snapshot", filename);
+        close(fd);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        ASTERA_ERROR("Could not map snapshot %s", filename);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    // Check the header and the bounds of every section
+    header = (const AriesSnapshotHeaderType*) base;
+    if (header->magic == ARIES_SNAPSHOT_MAGIC_SWAPPED)
+    {
+        ASTERA_ERROR("Snapshot %s was written with another byte order",
+            filename);
+        munmap(base, st.st_size);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+    if ((header->magic != ARIES_SNAPSHOT_MAGIC)
+        || (header->versionMajor != ARIES_SNAPSHOT_VERSION_MAJOR)
+        || (header->numSections > ARIES_SNAPSHOT_MAX_SECTIONS)
+        || (header->headerSize < (sizeof(AriesSnapshotHeaderType) +
+            (header->numSections * sizeof(AriesSnapshotSectionType))))
+        || (header->fileSize != (uint64_t) st.st_size)
+        || (header->headerSize > header->fileSize))
+    {
+        ASTERA_ERROR("%s is not a snapshot of version %d", filename,
+            ARIES_SNAPSHOT_VERSION_MAJOR);
+        munmap(base, st.st_size);
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    snapshot->base = (const uint8_t*) base;
+    snapshot->size = st.st_size;
+    snapshot->header = header;
+    snapshot->sections = (const AriesSnapshotSectionType*)
+        (snapshot->base + sizeof(AriesSnapshotHeaderType));
+
+    for (sectionIndex = 0; sectionIndex < header->numSections; sectionIndex++)
+    {
+        section = &snapshot->sections[sectionIndex];
+        if (((section->offset % ARIES_SNAPSHOT_ALIGN) != 0)
+            || (section->offset < header->headerSize)
+            || (((uint64_t) section->offset + section->size) >
+                header->fileSize)
+            || (((uint64_t) section->recordSize * section->numRecords) >
+                section->size))
+        {
+            ASTERA_ERROR("Snapshot %s section %d is out of bounds", filename,
+                sectionIndex);
+            munmap(base, st.st_size);
+            memset(snapshot, 0, sizeof(AriesSnapshotType));
+            return ARIES_SNAPSHOT_FAILURE;
+        }
+
+        if (section->kind == ARIES_SNAPSHOT_SECTION_LANE)
+        {
+            snapshot->numLanes = section->numRecords;
+        }
+        else if (section->kind == ARIES_SNAPSHOT_SECTION_LOG)
+        {
+            snapshot->numLogs++;
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Unmap a snapshot file
+ */
+AriesErrorType ariesSnapshotClose(
+        AriesSnapshotType* snapshot)
+{
+    if ((snapshot == NULL) || (snapshot->base == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    munmap((void*) (uintptr_t) snapshot->base, snapshot->size);
+    memset(snapshot, 0, sizeof(AriesSnapshotType));
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the device record of a snapshot
+ */
+AriesErrorType ariesSnapshotGetDevice(
+        AriesSnapshotType* snapshot,
+        const AriesSnapshotDeviceType** device)
+{
+    const AriesSnapshotSectionType* section;
+    AriesErrorType rc;
+
+    if (device == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    rc = ariesSnapshotGetRecords(snapshot, ARIES_SNAPSHOT_SECTION_DEVICE,
+        sizeof(AriesSnapshotDeviceType), &section);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+    if (section->numRecords < 1)
+    {
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    *device = (const AriesSnapshotDeviceType*)
+        (snapshot->base + section->offset);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the link record of a snapshot
+ */
+AriesErrorType ariesSnapshotGetLink(
+        AriesSnapshotType* snapshot,
+        const AriesSnapshotLinkType** link)
+{
+    const AriesSnapshotSectionType* section;
+    AriesErrorType rc;
+
+    if (link == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    rc = ariesSnapshotGetRecords(snapshot, ARIES_SNAPSHOT_SECTION_LINK,
+        sizeof(AriesSnapshotLinkType), &section);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+    if (section->numRecords < 1)
+    {
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+
+    *link = (const AriesSnapshotLinkType*) (snapshot->base + section->offset);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get the record of a lane of a snapshot
+ */
+AriesErrorType ariesSnapshotGetLane(
+        AriesSnapshotType* snapshot,
+        int laneIndex,
+        const AriesSnapshotLaneType** lane)
+{
+    const AriesSnapshotSectionType* section;
+    AriesErrorType rc;
+
+    if (lane == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    rc = ariesSnapshotGetRecords(snapshot, ARIES_SNAPSHOT_SECTION_LANE,
+        sizeof(AriesSnapshotLaneType), &section);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+    if ((laneIndex < 0) || ((uint32_t) laneIndex >= section->numRecords))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    // Records of a later minor version may be larger than the struct
+    *lane = (const AriesSnapshotLaneType*) (snapshot->base + section->offset +
+        ((size_t) laneIndex * section->recordSize));
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Get a raw LTSSM log of a snapshot
+ */
+AriesErrorType ariesSnapshotGetLog(
+        AriesSnapshotType* snapshot,
+        int logIndex,
+        int* logType,
+        int* firstOffset,
+        const uint8_t** data,
+        int* numBytes)
+{
+    const AriesSnapshotSectionType* section;
+
+    if ((snapshot == NULL) || (snapshot->base == NULL) || (logType == NULL) ||
+        (firstOffset == NULL) || (data == NULL) || (numBytes == NULL) ||
+        (logIndex < 0) || (logIndex >= snapshot->numLogs))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_LOG,
+        logIndex);
+    if (section == NULL)
+    {
+        return ARIES_SNAPSHOT_FAILURE;
+    }
+    *logType = section->id;
+    *firstOffset = section->param;
+    *data = snapshot->base + section->offset;
+    *numBytes = section->size;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Size of an element of a field, in bytes
+ */
+static int ariesSnapshotFieldElemSize(
+        const AriesSnapshotFieldType* field)
+{
+    switch (field->kind)
+    {
+        case ARIES_SNAPSHOT_FIELD_INT:
+        case ARIES_SNAPSHOT_FIELD_FLOAT:
+            return 4;
+        case ARIES_SNAPSHOT_FIELD_UINT8:
+        case ARIES_SNAPSHOT_FIELD_STRING:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+
+/*
+ * Check a schema field is known and lies within the records of a section
+ */
+static bool ariesSnapshotFieldValid(
+        const AriesSnapshotFieldType* field,
+        const AriesSnapshotSectionType* section)
+{
+    int elemSize = ariesSnapshotFieldElemSize(field);
+
+    return (field->sectionKind == section->kind) && (elemSize > 0) &&
+        (field->count > 0) && (field->name[ARIES_SNAPSHOT_FIELD_NAME_LEN - 1]
+        == '\0') && (((uint32_t) field->offset + (elemSize * field->count)) <=
+        section->recordSize);
+}
+
+
+/*
+ * Print an element of a numeric field. Values not representable in JSON
+ * are printed as null
+ */
+static void ariesSnapshotPrintValue(
+        FILE* fp,
+        const AriesSnapshotFieldType* field,
+        const uint8_t* record,
+        int elemIndex)
+{
+    int32_t intValue;
+    float floatValue;
+
+    if (field->kind == ARIES_SNAPSHOT_FIELD_INT)
+    {
+        memcpy(&intValue, (record + field->offset + (4 * elemIndex)), 4);
+        fprintf(fp, "%d", intValue);
+    }
+    else if (field->kind == ARIES_SNAPSHOT_FIELD_FLOAT)
+    {
+        memcpy(&floatValue, (record + field->offset + (4 * elemIndex)), 4);
+        if ((floatValue != floatValue) || (floatValue > FLT_MAX) ||
+            (floatValue < -FLT_MAX))
+        {
+            fprintf(fp, "null");
+        }
+        else
+        {
+            fprintf(fp, "%g", floatValue);
+        }
+    }
+    else
+    {
+        fprintf(fp, "%d", record[field->offset + elemIndex]);
+    }
+}
+
+
+/*
+ * Print a string field, quoted and escaped
+ */
+static void ariesSnapshotPrintString(
+        FILE* fp,
+        const AriesSnapshotFieldType* field,
+        const uint8_t* record)
+{
+    const char* text = (const char*) (record + field->offset);
+    int charIndex;
+
+    fputc('"', fp);
+    for (charIndex = 0; (charIndex < field->count) &&
+        (text[charIndex] != '\0'); charIndex++)
+    {
+        if ((text[charIndex] == '"') || (text[charIndex] == '\\'))
+        {
+            fputc('\\', fp);
+            fputc(text[charIndex], fp);
+        }
+        else if ((unsigned char) text[charIndex] < 0x20)
+        {
+            fprintf(fp, "\\u%04x", (unsigned char) text[charIndex]);
+        }
+        else
+        {
+            fputc(text[charIndex], fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+
+/*
+ * Print a record as a JSON object
+ */
+static void ariesSnapshotJsonRecord(
+        FILE* fp,
+        const AriesSnapshotSectionType* schema,
+        const AriesSnapshotFieldType* fields,
+        const AriesSnapshotSectionType* section,
+        const uint8_t* record,
+        const char* indent)
+{
+    const AriesSnapshotFieldType* field;
+    uint32_t fieldIndex;
+    int elemIndex;
+    bool first = true;
+
+    fprintf(fp, "{");
+    for (fieldIndex = 0; fieldIndex < schema->numRecords; fieldIndex++)
+    {
+        field = (const AriesSnapshotFieldType*) ((const uint8_t*) fields +
+            (fieldIndex * schema->recordSize));
+        if (!ariesSnapshotFieldValid(field, section))
+        {
+            continue;
+        }
+
+        fprintf(fp, "%s\n%s    \"%s\": ", first ? "" : ",", indent,
+            field->name);
+        first = false;
+        if (field->kind == ARIES_SNAPSHOT_FIELD_STRING)
+        {
+            ariesSnapshotPrintString(fp, field, record);
+        }
+        else if (field->count == 1)
+        {
+            ariesSnapshotPrintValue(fp, field, record, 0);
+        }
+        else
+        {
+            fprintf(fp, "[");
+            for (elemIndex = 0; elemIndex < field->count; elemIndex++)
+            {
+                fprintf(fp, "%s", (elemIndex > 0) ? ", " : "");
+                ariesSnapshotPrintValue(fp, field, record, elemIndex);
+            }
+            fprintf(fp, "]");
+        }
+    }
+    fprintf(fp, "\n%s}", indent);
+}
+
+
+/*
+ * Print a record as CSV rows
+ */
+static void ariesSnapshotCsvRecord(
+        FILE* fp,
+        const AriesSnapshotSectionType* schema,
+        const AriesSnapshotFieldType* fields,
+        const AriesSnapshotSectionType* section,
+        const uint8_t* record,
+        const char* sectionName,
+        int index)
+{
+    const AriesSnapshotFieldType* field;
+    uint32_t fieldIndex;
+    int elemIndex;
+
+    for (fieldIndex = 0; fieldIndex < schema->numRecords; fieldIndex++)
+    {
+        field = (const AriesSnapshotFieldType*) ((const uint8_t*) fields +
+            (fieldIndex * schema->recordSize));
+        if (!ariesSnapshotFieldValid(field, section))
+        {
+            continue;
+        }
+
+        if (field->kind == ARIES_SNAPSHOT_FIELD_STRING)
+        {
+            fprintf(fp, "%s,%d,%s,", sectionName, index, field->name);
+            ariesSnapshotPrintString(fp, field, record);
+            fprintf(fp, "\n");
+            continue;
+        }
+        for (elemIndex = 0; elemIndex < field->count; elemIndex++)
+        {
+            if (field->count == 1)
+            {
+                fprintf(fp, "%s,%d,%s,", sectionName, index, field->name);
+            }
+            else
+            {
+                fprintf(fp, "%s,%d,%s[%d],", sectionName, index, field->name,
+                    elemIndex);
+            }
+            ariesSnapshotPrintValue(fp, field, record, elemIndex);
+            fprintf(fp, "\n");
+        }
+    }
+}
+
+
+/*
+ * Get the schema section of a snapshot
+ */
+static AriesErrorType ariesSnapshotGetSchema(
+        AriesSnapshotType* snapshot,
+        const AriesSnapshotSectionType** schema,
+        const AriesSnapshotFieldType** fields)
+{
+    AriesErrorType rc;
+
+    rc = ariesSnapshotGetRecords(snapshot, ARIES_SNAPSHOT_SECTION_SCHEMA,
+        sizeof(AriesSnapshotFieldType), schema);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    *fields = (const AriesSnapshotFieldType*)
+        (snapshot->base + (*schema)->offset);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Print buffer size of a log
+ */
+static int ariesSnapshotLogBufferSize(
+        int logType)
+{
+    if (logType == ARIES_LTSSM_LINK_LOGGER)
+    {
+        return ARIES_MM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE;
+    }
+    return ARIES_PM_PRINT_INFO_NUM_PRINT_BUFFER_SIZE;
+}
+
+
+/*
+ * Convert a snapshot to JSON
+ */
+AriesErrorType ariesSnapshotWriteJson(
+        AriesSnapshotType* snapshot,
+        FILE* fp)
+{
+    const AriesSnapshotSectionType* schema;
+    const AriesSnapshotFieldType* fields;
+    const AriesSnapshotSectionType* section;
+    const uint8_t* data;
+    AriesErrorType rc;
+    uint32_t recordIndex;
+    int logIndex;
+    int logType;
+    int firstOffset;
+    int numBytes;
+    int byteIndex;
+
+    if (fp == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    rc = ariesSnapshotGetSchema(snapshot, &schema, &fields);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "    \"format_version\": \"%d.%d\",\n",
+        snapshot->header->versionMajor, snapshot->header->versionMinor);
+    fprintf(fp, "    \"sdk_version\": \"%.*s\",\n",
+        (int) sizeof(snapshot->header->sdkVersion),
+        snapshot->header->sdkVersion);
+    fprintf(fp, "    \"timestamp\": %lld", (long long)
+        snapshot->header->timestamp);
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_DEVICE,
+        0);
+    if ((section != NULL) && (section->numRecords > 0))
+    {
+        fprintf(fp, ",\n    \"device\": ");
+        ariesSnapshotJsonRecord(fp, schema, fields, section,
+            (snapshot->base + section->offset), "    ");
+    }
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_LINK,
+        0);
+    if ((section != NULL) && (section->numRecords > 0))
+    {
+        fprintf(fp, ",\n    \"link\": ");
+        ariesSnapshotJsonRecord(fp, schema, fields, section,
+            (snapshot->base + section->offset), "    ");
+    }
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_LANE,
+        0);
+    fprintf(fp, ",\n    \"lanes\": [");
+    for (recordIndex = 0; (section != NULL) &&
+        (recordIndex < section->numRecords); recordIndex++)
+    {
+        fprintf(fp, "%s\n        ", (recordIndex > 0) ? "," : "");
+        ariesSnapshotJsonRecord(fp, schema, fields, section,
+            (snapshot->base + section->offset +
+            (recordIndex * section->recordSize)), "        ");
+    }
+    fprintf(fp, "\n    ]");
+
+    fprintf(fp, ",\n    \"logs\": [");
+    for (logIndex = 0; logIndex < snapshot->numLogs; logIndex++)
+    {
+        rc = ariesSnapshotGetLog(snapshot, logIndex, &logType, &firstOffset,
+            &data, &numBytes);
+        if (rc != ARIES_SUCCESS)
+        {
+            return rc;
+        }
+        fprintf(fp, "%s\n        {\n", (logIndex > 0) ? "," : "");
+        fprintf(fp, "            \"log_type\": %d,\n", logType);
+        fprintf(fp, "            \"first_offset\": %d,\n", firstOffset);
+        fprintf(fp, "            \"data\": [");
+        for (byteIndex = 0; byteIndex < numBytes; byteIndex++)
+        {
+            fprintf(fp, "%s%d", (byteIndex > 0) ? "," : "", data[byteIndex]);
+        }
+        fprintf(fp, "]\n        }");
+    }
+    fprintf(fp, "\n    ]\n}\n");
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Convert a snapshot to CSV
+ */
+AriesErrorType ariesSnapshotWriteCsv(
+        AriesSnapshotType* snapshot,
+        FILE* fp)
+{
+    const AriesSnapshotSectionType* schema;
+    const AriesSnapshotFieldType* fields;
+    const AriesSnapshotSectionType* section;
+    const uint8_t* data;
+    AriesErrorType rc;
+    uint32_t recordIndex;
+    int logIndex;
+    int logType;
+    int firstOffset;
+    int numBytes;
+    int byteIndex;
+    int bufferSize;
+
+    if (fp == NULL)
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    rc = ariesSnapshotGetSchema(snapshot, &schema, &fields);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    fprintf(fp, "section,index,field,value\n");
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_DEVICE,
+        0);
+    if ((section != NULL) && (section->numRecords > 0))
+    {
+        ariesSnapshotCsvRecord(fp, schema, fields, section,
+            (snapshot->base + section->offset), "device", 0);
+    }
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_LINK,
+        0);
+    if ((section != NULL) && (section->numRecords > 0))
+    {
+        ariesSnapshotCsvRecord(fp, schema, fields, section,
+            (snapshot->base + section->offset), "link", 0);
+    }
+
+    section = ariesSnapshotFindSection(snapshot, ARIES_SNAPSHOT_SECTION_LANE,
+        0);
+    for (recordIndex = 0; (section != NULL) &&
+        (recordIndex < section->numRecords); recordIndex++)
+    {
+        ariesSnapshotCsvRecord(fp, schema, fields, section,
+            (snapshot->base + section->offset +
+            (recordIndex * section->recordSize)), "lane", recordIndex);
+    }
+
+    for (logIndex = 0; logIndex < snapshot->numLogs; logIndex++)
+    {
+        rc = ariesSnapshotGetLog(snapshot, logIndex, &logType, &firstOffset,
+            &data, &numBytes);
+        if (rc != ARIES_SUCCESS)
+        {
+            return rc;
+        }
+        bufferSize = ariesSnapshotLogBufferSize(logType);
+        for (byteIndex = 0; byteIndex < numBytes; byteIndex++)
+        {
+            fprintf(fp, "log,%d,%d,%d\n", logType,
+                ((firstOffset + byteIndex) % bufferSize), data[byteIndex]);
+        }
+    }
+
+    return ARIES_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
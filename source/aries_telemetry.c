@@ -0,0 +1,250 @@
+/*
+ * Copyright 2020 Astera Labs, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may not
+ * use this file except in compliance with the License. You may obtain a copy
+ * of the License at:
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * @file aries_telemetry.c
+ * @brief Implementation of the link telemetry ring.
+ *
+ * Each slot carries a sequence number, as in a seqlock: it is odd while the
+ * producer writes the slot, and 2*(n+1) once sample n is in it. A reader
+ * copies a slot and keeps the copy only if the sequence number was the
+ * expected one before and after the copy.
+ */
+
+#include "../include/aries_telemetry.h"
+
+#include <string.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Initialize a telemetry ring over caller allocated slots
+ */
+AriesErrorType ariesTelemetryRingInit(
+        AriesTelemetryRingType* ring,
+        AriesTelemetrySlotType* slots,
+        uint32_t numSlots)
+{
+    if ((ring == NULL) || (slots == NULL) || (numSlots == 0) ||
+        ((numSlots & (numSlots - 1)) != 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    memset(slots, 0, numSlots * sizeof(AriesTelemetrySlotType));
+    ring->slots = slots;
+    ring->numSlots = numSlots;
+    ring->head = 0;
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Fill a telemetry sample from the last polled state of a link
+ */
+AriesErrorType ariesTelemetrySampleFromLink(
+        AriesLinkType* link,
+        AriesTelemetrySampleType* sample)
+{
+    struct timespec ts;
+    int laneIndex;
+
+    if ((link == NULL) || (sample == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    sample->timestampUs = ((uint64_t) ts.tv_sec * 1000000) +
+        (ts.tv_nsec / 1000);
+    sample->currentTempC = link->device->currentTempC;
+    sample->maxTempC = link->device->maxTempC;
+    sample->recoveryCount = link->state.recoveryCount;
+    sample->state = link->state.state;
+    sample->rate = link->state.rate;
+    sample->curWidth = link->state.curWidth;
+    sample->linkMinFoM = link->state.linkMinFoM;
+    sample->linkOkay = link->state.linkOkay;
+    sample->overtempAlert = link->device->overtempAlert;
+    for (laneIndex = 0; laneIndex < 16; laneIndex++)
+    {
+        sample->usppDPLLCode[laneIndex] =
+            link->state.usppState.rxState[laneIndex].DPLLCode;
+        sample->dsppDPLLCode[laneIndex] =
+            link->state.dsppState.rxState[laneIndex].DPLLCode;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Append a sample to the ring (single producer)
+ */
+AriesErrorType ariesTelemetryRingPush(
+        AriesTelemetryRingType* ring,
+        AriesTelemetrySampleType* sample)
+{
+    AriesTelemetrySlotType* slot;
+    uint64_t head;
+
+    if ((ring == NULL) || (sample == NULL))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    slot = &ring->slots[head & (ring->numSlots - 1)];
+
+    // Mark slot as being written before any of the sample is overwritten
+    __atomic_store_n(&slot->seq, (2 * head) + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&slot->sample, sample, sizeof(AriesTelemetrySampleType));
+
+    __atomic_store_n(&slot->seq, (2 * head) + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Record the last polled state of a link in the ring
+ */
+AriesErrorType ariesTelemetryRingRecord(
+        AriesTelemetryRingType* ring,
+        AriesLinkType* link)
+{
+    AriesTelemetrySampleType sample;
+    AriesErrorType rc;
+
+    rc = ariesTelemetrySampleFromLink(link, &sample);
+    if (rc != ARIES_SUCCESS)
+    {
+        return rc;
+    }
+
+    return ariesTelemetryRingPush(ring, &sample);
+}
+
+
+/*
+ * Read samples from the ring, oldest first, starting at a sample number
+ */
+AriesErrorType ariesTelemetryRingRead(
+        AriesTelemetryRingType* ring,
+        uint64_t* cursor,
+        AriesTelemetrySampleType* samples,
+        int maxSamples,
+        int* numSamples,
+        uint64_t* numLost)
+{
+    AriesTelemetrySlotType* slot;
+    uint64_t head;
+    uint64_t next;
+    uint64_t lost = 0;
+    uint64_t seqBefore;
+    uint64_t seqAfter;
+    int count = 0;
+
+    if ((ring == NULL) || (cursor == NULL) || (samples == NULL) ||
+        (numSamples == NULL) || (maxSamples < 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    next = *cursor;
+    if (next > head)
+    {
+        next = head;
+    }
+
+    // Samples older than the ring depth are gone
+    if ((head - next) > ring->numSlots)
+    {
+        lost += (head - ring->numSlots) - next;
+        next = head - ring->numSlots;
+    }
+
+    while ((next < head) && (count < maxSamples))
+    {
+        slot = &ring->slots[next & (ring->numSlots - 1)];
+
+        seqBefore = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        memcpy(&samples[count], &slot->sample,
+            sizeof(AriesTelemetrySampleType));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seqAfter = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+
+        // Keep the copy only if it is sample 'next' and was not overwritten
+        // while copying
+        if ((seqBefore == ((2 * next) + 2)) && (seqAfter == seqBefore))
+        {
+            count++;
+        }
+        else
+        {
+            lost++;
+        }
+        next++;
+    }
+
+    *cursor = next;
+    *numSamples = count;
+    if (numLost != NULL)
+    {
+        *numLost = lost;
+    }
+
+    return ARIES_SUCCESS;
+}
+
+
+/*
+ * Read the most recent samples of the ring, oldest first
+ */
+AriesErrorType ariesTelemetryRingReadLatest(
+        AriesTelemetryRingType* ring,
+        AriesTelemetrySampleType* samples,
+        int maxSamples,
+        int* numSamples)
+{
+    uint64_t head;
+    uint64_t cursor = 0;
+
+    if ((ring == NULL) || (maxSamples < 0))
+    {
+        return ARIES_INVALID_ARGUMENT;
+    }
+
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (head > (uint64_t) maxSamples)
+    {
+        cursor = head - maxSamples;
+    }
+
+    return ariesTelemetryRingRead(ring, &cursor, samples, maxSamples,
+        numSamples, NULL);
+}
+
+#ifdef __cplusplus
+}
+#endif